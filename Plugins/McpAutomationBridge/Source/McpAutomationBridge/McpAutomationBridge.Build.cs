@@ -120,6 +120,9 @@ PublicDependencyModuleNames.AddRange(new string[]
             // Add OpenSSL for TLS support (requires WITH_SSL)
             AddEngineThirdPartyPrivateStaticDependencies(Target, "OpenSSL");
 
+            // zlib for WebSocket permessage-deflate (RFC 7692)
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
             PrivateDependencyModuleNames.AddRange(new string[]
             {
 "LandscapeEditor","LandscapeEditorUtilities","Foliage","FoliageEdit",
@@ -170,6 +170,8 @@
 // Globals used by registry helpers and fast-mode simulations
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeAssetPathCache.h"
+#include "McpBridgeClassIndex.h"
 
 #if WITH_EDITOR
 #include "Editor.h"  // GEditor for McpSafeLoadMap
@@ -604,13 +606,8 @@ static inline FString TryResolveAssetPath(const FString &InPath,
   return Norm.bIsValid ? Norm.Path : FString();
 }
 
-/**
- * Resolves an asset path from a partial path or short name.
- * 1. Checks if InputPath exists exactly.
- * 2. If not, and InputPath is a short name, searches AssetRegistry.
- * 3. Returns the full package name if found uniquely.
- */
-static inline FString ResolveAssetPath(const FString &InputPath) {
+// ResolveAssetPath without the cache.
+static inline FString ResolveAssetPathUncached(const FString &InputPath) {
   if (InputPath.IsEmpty())
     return FString();
 
@@ -631,8 +628,7 @@ static inline FString ResolveAssetPath(const FString &InputPath) {
   // 3. Search by name if it's a short name (no slashes)
   // UE 5.7+ compatible: Use GetAssetsByPath + manual name filtering instead of FARFilter::AssetName
   // PERFORMANCE NOTE: This scans all assets under /Game when given a short name (no slashes).
-  // For large projects, this could be slow if called frequently. Consider caching results
-  // or providing full paths when possible.
+  // ResolveAssetPath caches the outcome, so each short name pays for it once.
   if (!InputPath.Contains(TEXT("/"))) {
     FString ShortName = FPaths::GetBaseFilename(InputPath);
     
@@ -673,6 +669,29 @@ static inline FString ResolveAssetPath(const FString &InputPath) {
   return FString();
 }
 
+/**
+ * Resolves an asset path from a partial path or short name.
+ * 1. Checks if InputPath exists exactly.
+ * 2. If not, and InputPath is a short name, searches AssetRegistry.
+ * 3. Returns the full package name if found uniquely.
+ * Results, including misses, are remembered in FMcpAssetPathCache.
+ */
+static inline FString ResolveAssetPath(const FString &InputPath) {
+  if (InputPath.IsEmpty())
+    return FString();
+
+  FMcpAssetPathCache &Cache = FMcpAssetPathCache::Get();
+  if (const FMcpAssetPathCache::FEntry *Cached =
+          Cache.Find(EMcpAssetPathLookup::ResolveAssetPath, InputPath)) {
+    return Cached->bFound ? Cached->Path : FString();
+  }
+  const FString Resolved = ResolveAssetPathUncached(InputPath);
+  Cache.Add(EMcpAssetPathLookup::ResolveAssetPath, InputPath,
+            {Resolved, FString(), !Resolved.IsEmpty()});
+  return Resolved;
+}
+
+
 /**
  * Safe asset saving helper - marks package dirty and notifies asset registry.
  * DO NOT use UEditorAssetLibrary::SaveAsset() - it triggers modal dialogs that
@@ -1312,9 +1331,9 @@ static inline bool McpSafeLoadMap(const FString& MapPath, bool bForceCleanup = t
 
 #if WITH_EDITOR
 // Resolve a UClass by a variety of heuristics: try full path lookup, attempt
-// to load an asset by path (UBlueprint or UClass), then fall back to scanning
-// loaded classes by name or path suffix. This replaces previous usages of
-// FindObject<...>(ANY_PACKAGE, ...) which is deprecated.
+// to load an asset by path (UBlueprint or UClass), then fall back to looking
+// up loaded classes by name or path suffix in FMcpClassIndex. This replaces
+// previous usages of FindObject<...>(ANY_PACKAGE, ...) which is deprecated.
 static inline UClass *ResolveClassByName(const FString &ClassNameOrPath) {
   if (ClassNameOrPath.IsEmpty())
     return nullptr;
@@ -1370,31 +1389,17 @@ static inline UClass *ResolveClassByName(const FString &ClassNameOrPath) {
     }
   }
 
-  // 3) Fallback: iterate loaded classes and match by short name or path suffix
-  UClass *BestMatch = nullptr;
-  for (TObjectIterator<UClass> It; It; ++It) {
-    UClass *C = *It;
-    if (!C)
-      continue;
-
-    // Exact short name match
-    if (C->GetName().Equals(ClassNameOrPath, ESearchCase::IgnoreCase)) {
-      // Prefer /Script/ (native) classes over others if multiple match
-      if (C->GetPathName().StartsWith(TEXT("/Script/")))
-        return C;
-      if (!BestMatch)
-        BestMatch = C;
-    }
-    // Match on ".ClassName" suffix (path-based short form)
-    else if (C->GetPathName().EndsWith(
-                 FString::Printf(TEXT(".%s"), *ClassNameOrPath),
-                 ESearchCase::IgnoreCase)) {
-      if (!BestMatch)
-        BestMatch = C;
-    }
+  // 3) Fallback: loaded classes by short name, preferring /Script/ (native)
+  // classes if several match, or by ".ClassName" path suffix for a qualified
+  // name. A miss scans every loaded class once, so only one lookup runs.
+  FMcpClassIndex &ClassIndex = FMcpClassIndex::Get();
+  int32 Separator = INDEX_NONE;
+  if (ClassNameOrPath.FindLastCharByPredicate(
+          [](TCHAR C) { return C == TEXT('.') || C == TEXT(':'); },
+          Separator)) {
+    return ClassIndex.FindClassByPathSuffix(ClassNameOrPath);
   }
-
-  return BestMatch;
+  return ClassIndex.FindClassByShortName(ClassNameOrPath);
 }
 #endif
 
@@ -2739,6 +2744,30 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
     }
   }
 
+  // The remaining methods are slow; reuse what they found for this spelling
+  // last time. A miss is only remembered for them: Blueprints already in
+  // memory were checked above.
+  FMcpAssetPathCache &Cache = FMcpAssetPathCache::Get();
+  if (const FMcpAssetPathCache::FEntry *Found =
+          Cache.Find(EMcpAssetPathLookup::BlueprintObject, Req)) {
+    // Copied: loading can raise the Asset Registry notifications that evict
+    // cache entries, Found's included.
+    const FMcpAssetPathCache::FEntry Cached = *Found;
+    if (!Cached.bFound) {
+      OutError = Cached.Error;
+      return nullptr;
+    }
+    if (UBlueprint *BP = LoadObject<UBlueprint>(nullptr, *Cached.Path)) {
+      OutNormalized = FPackageName::ObjectPathToPackageName(Cached.Path);
+      return BP;
+    }
+    Cache.Remove(EMcpAssetPathLookup::BlueprintObject, Req);
+  }
+  auto RememberFound = [&Cache, &Req](const UBlueprint *BP) {
+    Cache.Add(EMcpAssetPathLookup::BlueprintObject, Req,
+              {BP->GetPathName(), FString(), true});
+  };
+
   // Method 3: TObjectIterator fallback - iterate all blueprints to find by path
   // This is slower but guaranteed to find in-memory assets that weren't properly registered
   for (TObjectIterator<UBlueprint> It; It; ++It) {
@@ -2751,6 +2780,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
           BPPath.Equals(Path, ESearchCase::IgnoreCase) ||
           BPPath.Equals(Req, ESearchCase::IgnoreCase)) {
         OutNormalized = PackagePath;
+        RememberFound(BP);
         return BP;
       }
       // Also check if the package paths match
@@ -2760,6 +2790,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
       }
       if (BPPackagePath.Equals(PackagePath, ESearchCase::IgnoreCase)) {
         OutNormalized = PackagePath;
+        RememberFound(BP);
         return BP;
       }
     }
@@ -2769,6 +2800,7 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
   if (UEditorAssetLibrary::DoesAssetExist(ObjectPath)) {
     if (UBlueprint* BP = LoadObject<UBlueprint>(nullptr, *ObjectPath)) {
       OutNormalized = PackagePath;
+      RememberFound(BP);
       return BP;
     }
   }
@@ -2794,11 +2826,14 @@ static inline UBlueprint *LoadBlueprintAsset(const FString &Req,
       OutNormalized = Found.ToSoftObjectPath().ToString();
       if (OutNormalized.Contains(TEXT(".")))
         OutNormalized = OutNormalized.Left(OutNormalized.Find(TEXT(".")));
+      RememberFound(BP);
       return BP;
     }
   }
 
   OutError = FString::Printf(TEXT("Blueprint asset not found: %s"), *Req);
+  Cache.Add(EMcpAssetPathLookup::BlueprintObject, Req,
+            {FString(), OutError, false});
   return nullptr;
 }
 #endif
@@ -2882,7 +2917,19 @@ static inline bool FindBlueprintNormalizedPath(const FString &Req,
     }
   }
 
-  if (UEditorAssetLibrary::DoesAssetExist(CheckPath)) {
+  FMcpAssetPathCache &Cache = FMcpAssetPathCache::Get();
+  if (const FMcpAssetPathCache::FEntry *Cached =
+          Cache.Find(EMcpAssetPathLookup::BlueprintPackage, CheckPath)) {
+    if (Cached->bFound) {
+      OutNormalized = CheckPath;
+    }
+    return Cached->bFound;
+  }
+
+  const bool bExists = UEditorAssetLibrary::DoesAssetExist(CheckPath);
+  Cache.Add(EMcpAssetPathLookup::BlueprintPackage, CheckPath,
+            {CheckPath, FString(), bExists});
+  if (bExists) {
     OutNormalized = CheckPath;
     return true;
   }
@@ -2942,16 +2989,9 @@ static inline UClass *ResolveUClass(const FString &Input) {
       return Found;
   }
 
-  // 5. Native class search by iteration (slow fallback, but useful for obscure
-  // plugins)
+  // 5. Loaded class search by short name (useful for obscure plugins)
   // Only doing this for exact short name matches to avoid false positives
-  for (TObjectIterator<UClass> It; It; ++It) {
-    if (It->GetName() == Input) {
-      return *It;
-    }
-  }
-
-  return nullptr;
+  return FMcpClassIndex::Get().FindClassByShortName(Input);
 }
 
 // Standardized Response Helpers
@@ -36,6 +36,21 @@ UMcpAutomationBridgeSettings::UMcpAutomationBridgeSettings()
     HeartbeatTimeoutSeconds = 10.0f; // drop connections after 10s without heartbeat
     ListenBacklog = 10; // typical listen backlog
     AcceptSleepSeconds = 0.01f; // brief sleepers to reduce CPU when idle
+    bUseSocketReactor = true; // share one I/O thread per listener across clients
+    ConcurrentReadOnlyRequestLimit = 4; // per-action worker lane for read-only queries
+    MaxInFlightRequestsPerConnection = 16; // pipelined window offered in bridge_ack
+    bAllowMessagePackEncoding = true; // binary responses only for clients that ask
+    MaxResponseChunkBytes = 1024 * 1024; // cap on response_chunk size for clients that ask
+    SendQueueHighWaterBytes = 4 * 1024 * 1024; // pause best-effort traffic to slow clients
+    MaxSendQueueBytes = 64 * 1024 * 1024; // disconnect clients that stop reading
+    JobFrameBudgetMs = 8.0f; // leaves most of a 60 Hz frame to the editor
+    JobProgressIntervalSeconds = 1.0f; // keeps the request alive on the server
+    LogBatchIntervalMs = 100; // log lines reach clients within a tenth of a second
+    LogBatchMaxRecords = 256;
+    bEnablePerMessageDeflate = false; // opt-in; pays off on LAN links, not loopback
+    DeflateMaxWindowBits = 15;
+    DeflateMinMessageBytes = 1024;
+    bDeflateNoContextTakeover = false;
     TickerIntervalSeconds = 0.1f; // subsystem tick every 100ms
 
     // Default logging behavior
@@ -43,6 +58,8 @@ UMcpAutomationBridgeSettings::UMcpAutomationBridgeSettings()
     bApplyLogVerbosityToAll = false;
     // Per-socket telemetry (off by default to avoid noise)
     bEnableSocketTelemetry = false;
+    // Prometheus scrape endpoint on the listeners (opt-in)
+    bEnableMetricsEndpoint = false;
 }
 
 /**
@@ -9,15 +9,26 @@
 #include "Dom/JsonObject.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/PlatformProcess.h"
 #include "HAL/PlatformTime.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpBridgeActorIndex.h"
+#include "McpBridgeAssetPathCache.h"
+#include "McpBridgeAutomationJob.h"
+#include "McpBridgeClassIndex.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeLogStream.h"
+#include "McpBridgeOpenMetrics.h"
+#include "McpBridgeTrace.h"
 #include "McpBridgeWebSocket.h"
 #include "McpConnectionManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Guid.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -109,6 +120,30 @@ void UMcpAutomationBridgeSubsystem::Initialize(
 
   // Initialize the handler registry
   InitializeHandlers();
+  InitializeActionAliases();
+  FMcpActorIndex::Get().Startup();
+  FMcpClassIndex::Get().Startup();
+  FMcpAssetPathCache::Get().Startup();
+
+  // Let read-only handlers bypass the game-thread queue when enabled.
+  const UMcpAutomationBridgeSettings *BridgeSettings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  if (BridgeSettings && BridgeSettings->ConcurrentReadOnlyRequestLimit > 0) {
+    bAcceptingConcurrentRequests = true;
+    ConnectionManager->SetOnConcurrentRequest(
+        FMcpConcurrentRequestCallback::CreateUObject(
+            this, &UMcpAutomationBridgeSubsystem::TryDispatchConcurrentRequest));
+  }
+  ConnectionManager->SetOnCollectMetrics(
+      FMcpCollectMetricsCallback::CreateUObject(
+          this, &UMcpAutomationBridgeSubsystem::CollectBridgeMetrics));
+  // A client that disconnects without unsubscribing must not keep log
+  // capture running.
+  ConnectionManager->SetOnSocketClosed(
+      FMcpSocketClosedCallback::CreateWeakLambda(
+          this, [this](TSharedPtr<FMcpBridgeWebSocket> Socket) {
+            RemoveLogSubscriber(Socket);
+          }));
 
   // Start the connection manager
   ConnectionManager->Start();
@@ -150,6 +185,24 @@ void UMcpAutomationBridgeSubsystem::Deinitialize() {
            TEXT("McpAutomationBridgeSubsystem deinitializing."));
   }
 
+  // Worker-lane requests reference this subsystem and its connection
+  // manager; stop accepting new ones and let in-flight ones finish first.
+  bAcceptingConcurrentRequests = false;
+  const double WorkerDrainDeadline = FPlatformTime::Seconds() + 5.0;
+  while (ConcurrentRequestsInFlight.GetValue() > 0 &&
+         FPlatformTime::Seconds() < WorkerDrainDeadline) {
+    FPlatformProcess::Sleep(0.001f);
+  }
+  if (ConcurrentRequestsInFlight.GetValue() > 0) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("%d worker-lane automation requests still running at "
+                "shutdown."),
+           ConcurrentRequestsInFlight.GetValue());
+  }
+
+  // Jobs still running get an error response while connections are open.
+  AbortAutomationJobs();
+
   if (ConnectionManager.IsValid()) {
     ConnectionManager->Stop();
     ConnectionManager.Reset();
@@ -161,6 +214,10 @@ void UMcpAutomationBridgeSubsystem::Deinitialize() {
     LogCaptureDevice.Reset();
   }
 
+  FMcpActorIndex::Get().Shutdown();
+  FMcpClassIndex::Get().Shutdown();
+  FMcpAssetPathCache::Get().Shutdown();
+
   Super::Deinitialize();
 }
 
@@ -224,10 +281,10 @@ bool UMcpAutomationBridgeSubsystem::SendRawMessage(const FString &Message) {
  * @return true to remain registered and continue receiving ticks.
  */
 bool UMcpAutomationBridgeSubsystem::Tick(float DeltaTime) {
-  // Check if we have pending requests that were deferred due to unsafe engine
-  // states
-  if (bPendingRequestsScheduled && !GIsSavingPackage &&
-      !IsGarbageCollecting() && !IsAsyncLoading()) {
+  // Pending requests normally drain on the tick after they are queued (see
+  // SchedulePendingAutomationDrain); this only backs that up.
+  if (NumPendingAutomationRequests > 0 && !bPendingDrainScheduled &&
+      !GIsSavingPackage && !IsGarbageCollecting() && !IsAsyncLoading()) {
     ProcessPendingAutomationRequests();
   }
   return true;
@@ -256,12 +313,53 @@ void UMcpAutomationBridgeSubsystem::SendAutomationResponse(
     TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
     const bool bSuccess, const FString &Message,
     const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
+  // A batch item replying from inside its handler is folded into the
+  // aggregated batch response (see HandleAutomationBatch).
+  if (!CapturingBatchItemId.IsEmpty() && IsInGameThread() &&
+      RequestId == CapturingBatchItemId) {
+    CapturedBatchItemResponse.bResponded = true;
+    CapturedBatchItemResponse.bSuccess = bSuccess;
+    CapturedBatchItemResponse.Message = Message;
+    CapturedBatchItemResponse.Result = Result;
+    CapturedBatchItemResponse.ErrorCode = ErrorCode;
+    return;
+  }
   if (ConnectionManager.IsValid()) {
     ConnectionManager->SendAutomationResponse(TargetSocket, RequestId, bSuccess,
                                               Message, Result, ErrorCode);
   }
 }
 
+/**
+ * @brief Send a success response whose result is streamed as UTF-8 JSON.
+ *
+ * Batch items still need the result as a DOM, so while a batch is capturing
+ * the streamed text is parsed back and routed through SendAutomationResponse.
+ *
+ * @param TargetSocket Optional socket to target the response.
+ * @param RequestId Identifier of the automation request being answered.
+ * @param Message Human-readable success message.
+ * @param WriteResult Writes the members of the result object.
+ */
+void UMcpAutomationBridgeSubsystem::SendAutomationResponseStreamed(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    const FString &Message,
+    TFunctionRef<void(FMcpJsonStreamWriter &)> WriteResult) {
+  if ((!CapturingBatchItemId.IsEmpty() && IsInGameThread() &&
+       RequestId == CapturingBatchItemId) ||
+      !ConnectionManager.IsValid()) {
+    FMcpJsonStreamWriter Writer;
+    Writer.BeginObject();
+    WriteResult(Writer);
+    Writer.EndObject();
+    SendAutomationResponse(TargetSocket, RequestId, true, Message,
+                           Writer.ParsePayload(), FString());
+    return;
+  }
+  ConnectionManager->SendAutomationResponseStreamed(
+      TargetSocket, RequestId, true, Message, FString(), WriteResult);
+}
+
 /**
  * @brief Log a failure and send a standardized automation error response.
  *
@@ -307,42 +405,243 @@ void UMcpAutomationBridgeSubsystem::SendProgressUpdate(
   }
 }
 
+/**
+ * @brief Forward a droppable message to the connection manager.
+ *
+ * @param Message The raw message string to send.
+ * @return `true` if a socket that is keeping up accepted the message,
+ * `false` if it was dropped.
+ */
+bool UMcpAutomationBridgeSubsystem::SendBestEffortMessage(
+    const FString &Message) {
+  if (ConnectionManager.IsValid()) {
+    return ConnectionManager->SendBestEffortMessage(Message);
+  }
+  return false;
+}
+
 /**
  * @brief Records telemetry for an automation request with outcome details.
  *
  * Forwards the request identifier, success flag, human-readable message, and
  * error code to the connection manager for telemetry/logging.
  *
- * @param RequestId Unique identifier of the automation request.
+ * @param RequestingSocket Socket the request arrived on.
+ * @param RequestId Identifier of the automation request; unique per socket.
  * @param bSuccess `true` if the request completed successfully, `false`
  * otherwise.
  * @param Message Human-readable message describing the outcome or context.
  * @param ErrorCode Short error identifier (empty if none).
  */
 void UMcpAutomationBridgeSubsystem::RecordAutomationTelemetry(
+    const TSharedPtr<FMcpBridgeWebSocket> &RequestingSocket,
     const FString &RequestId, const bool bSuccess, const FString &Message,
     const FString &ErrorCode) {
   if (ConnectionManager.IsValid()) {
-    ConnectionManager->RecordAutomationTelemetry(RequestId, bSuccess, Message,
-                                                 ErrorCode);
+    ConnectionManager->RecordAutomationTelemetry(
+        RequestingSocket.Get(), RequestId, bSuccess, Message, ErrorCode);
   }
 }
 
 /**
  * @brief Registers an automation action handler for the given action string.
  *
- * If a non-empty handler is provided, stores it under Action (replacing any
- * existing handler for the same key). If Handler is null/invalid, the call is a
- * no-op.
+ * If a non-empty handler is provided, stores it as the first handler tried for
+ * Action (replacing any handler previously registered for the same key, which
+ * is counted and reported as a duplicate). If Handler is null/invalid, the
+ * call is a no-op. Handlers declared thread-safe and read-only additionally
+ * get a worker lane so their requests can run without waiting for the game
+ * thread.
  *
  * @param Action The action identifier string used to look up the handler.
  * @param Handler Callable invoked when the specified action is requested.
+ * @param Traits Execution traits declared by the handler.
  */
 void UMcpAutomationBridgeSubsystem::RegisterHandler(
-    const FString &Action, FAutomationHandler Handler) {
-  if (Handler) {
-    AutomationHandlers.Add(Action, Handler);
+    const FString &Action, FAutomationHandler Handler,
+    const FAutomationHandlerTraits &Traits) {
+  if (!Handler) {
+    return;
+  }
+
+  TSharedPtr<FConcurrentHandlerLane, ESPMode::ThreadSafe> Lane;
+  if (Traits.bThreadSafeReadOnly) {
+    const UMcpAutomationBridgeSettings *Settings =
+        GetDefault<UMcpAutomationBridgeSettings>();
+    const int32 MaxConcurrency =
+        Traits.MaxConcurrency > 0
+            ? Traits.MaxConcurrency
+            : (Settings ? Settings->ConcurrentReadOnlyRequestLimit : 0);
+    if (MaxConcurrency > 0) {
+      Lane = MakeShared<FConcurrentHandlerLane, ESPMode::ThreadSafe>();
+      Lane->Handler = Handler;
+      Lane->MaxConcurrency = MaxConcurrency;
+      Lane->ConcurrentPayloadFlag = Traits.ConcurrentPayloadFlag;
+    }
+  }
+
+  FAutomationActionRoute &Route = AutomationHandlers.FindOrAdd(FName(*Action));
+  Route.Priority = Traits.Priority;
+  Route.bTransactional = Traits.bTransactional;
+  if (Route.bHasRegisteredHandler) {
+    ++DuplicateActionRegistrations;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Automation action '%s' registered more than once; the later "
+                "handler replaces the earlier one."),
+           *Action);
+    Route.Candidates[0].Handler = MoveTemp(Handler);
+  } else {
+    FAutomationRouteCandidate Candidate;
+    Candidate.Label = Action;
+    Candidate.Handler = MoveTemp(Handler);
+    Route.Candidates.Insert(MoveTemp(Candidate), 0);
+    Route.bHasRegisteredHandler = true;
+  }
+
+  FWriteScopeLock WriteLock(ConcurrentHandlerLanesLock);
+  if (Lane.IsValid()) {
+    ConcurrentHandlerLanes.Add(Action, Lane);
+  } else {
+    ConcurrentHandlerLanes.Remove(Action);
+  }
+}
+
+/**
+ * @brief Adds the deferred request queue depth and the engine-state deferral
+ * counters to a GET /metrics response. Called from socket I/O threads, so it
+ * reads only atomics.
+ */
+void UMcpAutomationBridgeSubsystem::CollectBridgeMetrics(
+    FMcpOpenMetricsWriter &Writer) {
+  Writer.BeginFamily(TEXT("mcp_bridge_queued_requests"), TEXT("gauge"),
+                     TEXT("Automation requests waiting for the game thread."));
+  Writer.WriteSample(TEXT("mcp_bridge_queued_requests"),
+                     NumPendingAutomationRequests.Load());
+
+  Writer.BeginFamily(TEXT("mcp_bridge_engine_state_deferrals"),
+                     TEXT("counter"),
+                     TEXT("Automation requests requeued because the engine "
+                          "was saving, collecting garbage or async loading."));
+  const FMcpMetricLabel Saving[] = {{TEXT("reason"), TEXT("saving")}};
+  const FMcpMetricLabel GarbageCollection[] = {
+      {TEXT("reason"), TEXT("garbage_collection")}};
+  const FMcpMetricLabel AsyncLoading[] = {
+      {TEXT("reason"), TEXT("async_loading")}};
+  Writer.WriteSample(TEXT("mcp_bridge_engine_state_deferrals_total"),
+                     NumDeferredForSaving.Load(), Saving);
+  Writer.WriteSample(TEXT("mcp_bridge_engine_state_deferrals_total"),
+                     NumDeferredForGarbageCollection.Load(), GarbageCollection);
+  Writer.WriteSample(TEXT("mcp_bridge_engine_state_deferrals_total"),
+                     NumDeferredForAsyncLoading.Load(), AsyncLoading);
+
+  Writer.BeginFamily(TEXT("mcp_bridge_log_records_dropped"), TEXT("counter"),
+                     TEXT("Streamed log lines lost because the capture ring "
+                          "was full or the subscriber was falling behind."));
+  const FMcpMetricLabel Overflow[] = {{TEXT("reason"), TEXT("overflow")}};
+  const FMcpMetricLabel Backpressure[] = {
+      {TEXT("reason"), TEXT("backpressure")}};
+  Writer.WriteSample(TEXT("mcp_bridge_log_records_dropped_total"),
+                     FMcpLogStream::GetNumOverflowDrops(), Overflow);
+  Writer.WriteSample(TEXT("mcp_bridge_log_records_dropped_total"),
+                     FMcpLogStream::GetNumBackpressureDrops(), Backpressure);
+}
+
+/**
+ * @brief Runs a request on a worker thread if its handler has a free lane.
+ *
+ * Called from socket I/O threads. Returns false (leaving the request to the
+ * game-thread queue) when the action has no worker lane, its concurrency
+ * limit is reached, the subsystem is shutting down, or the engine is saving
+ * or collecting garbage. Responses and telemetry use the same connection
+ * manager path as game-thread requests.
+ *
+ * @return `true` if the request was scheduled on a worker thread.
+ */
+bool UMcpAutomationBridgeSubsystem::TryDispatchConcurrentRequest(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  TSharedPtr<FConcurrentHandlerLane, ESPMode::ThreadSafe> Lane;
+  {
+    FReadScopeLock ReadLock(ConcurrentHandlerLanesLock);
+    if (const TSharedPtr<FConcurrentHandlerLane, ESPMode::ThreadSafe> *Found =
+            ConcurrentHandlerLanes.Find(Action)) {
+      Lane = *Found;
+    }
+  }
+  if (!Lane.IsValid() || GIsSavingPackage || IsGarbageCollecting()) {
+    return false;
+  }
+  if (!Lane->ConcurrentPayloadFlag.IsEmpty() &&
+      !GetJsonBoolField(Payload, Lane->ConcurrentPayloadFlag)) {
+    return false;
+  }
+
+  // Count the request before checking for shutdown so Deinitialize() either
+  // sees it in flight or this thread sees the lane closed.
+  ConcurrentRequestsInFlight.Increment();
+  if (!bAcceptingConcurrentRequests) {
+    ConcurrentRequestsInFlight.Decrement();
+    return false;
+  }
+  if (Lane->InFlight.Increment() > Lane->MaxConcurrency) {
+    Lane->InFlight.Decrement();
+    ConcurrentRequestsInFlight.Decrement();
+    return false;
+  }
+
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->StartRequestTelemetry(RequestingSocket.Get(), RequestId,
+                                             Action);
+    ConnectionManager->RegisterRequestSocket(RequestId, RequestingSocket);
   }
+
+  Async(EAsyncExecution::ThreadPool, [this, Lane, RequestId, Action, Payload,
+                                      RequestingSocket]() {
+    MCP_TRACE_SCOPE("McpBridge.Dispatch");
+    MCP_TRACE_SCOPE_TEXT(*Action);
+    McpTraceRequestDispatched(RequestId, Action);
+    const double StartSeconds = FPlatformTime::Seconds();
+    if (ConnectionManager.IsValid()) {
+      ConnectionManager->MarkRequestHandlerStart(RequestingSocket.Get(),
+                                                 RequestId);
+    }
+    bool bHandled = false;
+    try {
+      bHandled = Lane->Handler(RequestId, Action, Payload, RequestingSocket);
+    } catch (const std::exception &E) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("Unhandled exception processing automation request %s on "
+                  "worker lane: %s"),
+             *RequestId, ANSI_TO_TCHAR(E.what()));
+      bHandled = true;
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Internal error: %s"), ANSI_TO_TCHAR(E.what())),
+          TEXT("INTERNAL_ERROR"));
+    } catch (...) {
+      bHandled = true;
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("Internal error (unknown)."),
+                          TEXT("INTERNAL_ERROR"));
+    }
+    if (!bHandled) {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("Unknown automation action: %s"), *Action),
+          TEXT("UNKNOWN_ACTION"));
+    }
+
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("ProcessAutomationRequest: Completed on worker lane "
+                "RequestId=%s action='%s' (%.3f ms)"),
+           *RequestId, *Action,
+           (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+    Lane->InFlight.Decrement();
+    ConcurrentRequestsInFlight.Decrement();
+  });
+  return true;
 }
 
 /**
@@ -369,18 +668,24 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleExecuteEditorFunction(R, A, P, S);
                   });
+  // Property and container handlers only Modify() the object they change and
+  // never save, so undoing a transaction around them reverts them completely.
+  FAutomationHandlerTraits PropertyEditTraits;
+  PropertyEditTraits.bTransactional = true;
   RegisterHandler(TEXT("set_object_property"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleSetObjectProperty(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("get_object_property"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleGetObjectProperty(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
 
   // Containers (Arrays, Maps, Sets)
   RegisterHandler(TEXT("array_append"),
@@ -388,118 +693,149 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArrayAppend(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("array_remove"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArrayRemove(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("array_insert"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArrayInsert(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("array_get_element"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArrayGetElement(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("array_set_element"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArraySetElement(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("array_clear"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleArrayClear(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
 
   RegisterHandler(TEXT("map_set_value"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleMapSetValue(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("map_get_value"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleMapGetValue(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("map_remove_key"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleMapRemoveKey(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("map_has_key"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleMapHasKey(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("map_get_keys"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleMapGetKeys(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("map_clear"), [this](const FString &R, const FString &A,
-                                            const TSharedPtr<FJsonObject> &P,
-                                            TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleMapClear(R, A, P, S);
-  });
+                  },
+                  PropertyEditTraits);
+  RegisterHandler(TEXT("map_clear"),
+                  [this](const FString &R, const FString &A,
+                         const TSharedPtr<FJsonObject> &P,
+                         TSharedPtr<FMcpBridgeWebSocket> S) {
+                    return HandleMapClear(R, A, P, S);
+                  },
+                  PropertyEditTraits);
 
-  RegisterHandler(TEXT("set_add"), [this](const FString &R, const FString &A,
-                                          const TSharedPtr<FJsonObject> &P,
-                                          TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleSetAdd(R, A, P, S);
-  });
+  RegisterHandler(TEXT("set_add"),
+                  [this](const FString &R, const FString &A,
+                         const TSharedPtr<FJsonObject> &P,
+                         TSharedPtr<FMcpBridgeWebSocket> S) {
+                    return HandleSetAdd(R, A, P, S);
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("set_remove"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleSetRemove(R, A, P, S);
-                  });
+                  },
+                  PropertyEditTraits);
   RegisterHandler(TEXT("set_contains"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleSetContains(R, A, P, S);
-                  });
-  RegisterHandler(TEXT("set_clear"), [this](const FString &R, const FString &A,
-                                            const TSharedPtr<FJsonObject> &P,
-                                            TSharedPtr<FMcpBridgeWebSocket> S) {
-    return HandleSetClear(R, A, P, S);
-  });
+                  },
+                  PropertyEditTraits);
+  RegisterHandler(TEXT("set_clear"),
+                  [this](const FString &R, const FString &A,
+                         const TSharedPtr<FJsonObject> &P,
+                         TSharedPtr<FMcpBridgeWebSocket> S) {
+                    return HandleSetClear(R, A, P, S);
+                  },
+                  PropertyEditTraits);
 
-  // Asset Dependency
+  // Asset Dependency (AssetRegistry reads only, safe on worker threads).
+  // By default they include in-memory (unsaved) assets, which only the game
+  // thread can see; a client that asks for onDiskOnly gets the registry's
+  // on-disk state from the worker lane instead.
+  FAutomationHandlerTraits AssetRegistryReadTraits;
+  AssetRegistryReadTraits.bThreadSafeReadOnly = true;
+  AssetRegistryReadTraits.ConcurrentPayloadFlag = TEXT("onDiskOnly");
   RegisterHandler(TEXT("get_asset_references"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleGetAssetReferences(R, A, P, S);
-                  });
+                  },
+                  AssetRegistryReadTraits);
   RegisterHandler(TEXT("get_asset_dependencies"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleGetAssetDependencies(R, A, P, S);
-                  });
+                  },
+                  AssetRegistryReadTraits);
 
-  // Asset Workflow
+  // Asset Workflow. Bulk operations can hold the game thread for a long time,
+  // so while they wait they yield to other queued requests.
+  FAutomationHandlerTraits BulkOperationTraits;
+  BulkOperationTraits.Priority = EMcpRequestPriority::Low;
   RegisterHandler(TEXT("fixup_redirectors"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleFixupRedirectors(R, A, P, S);
-                  });
+                  },
+                  BulkOperationTraits);
   RegisterHandler(TEXT("source_control_checkout"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
@@ -511,19 +847,22 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleSourceControlSubmit(R, A, P, S);
-                  });
+                  },
+                  BulkOperationTraits);
   RegisterHandler(TEXT("bulk_rename_assets"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleBulkRenameAssets(R, A, P, S);
-                  });
+                  },
+                  BulkOperationTraits);
   RegisterHandler(TEXT("bulk_delete_assets"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleBulkDeleteAssets(R, A, P, S);
-                  });
+                  },
+                  BulkOperationTraits);
   RegisterHandler(TEXT("generate_thumbnail"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
@@ -830,7 +1169,8 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                          const TSharedPtr<FJsonObject> &P,
                          TSharedPtr<FMcpBridgeWebSocket> S) {
                     return HandleSearchAssets(R, A, P, S);
-                  });
+                  },
+                  AssetRegistryReadTraits);
 
   RegisterHandler(TEXT("find_by_tag"),
                   [this](const FString &R, const FString &A,
@@ -1106,7 +1446,10 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                     return HandleMiscAction(R, A, P, S);
                   });
 
-  // PIE State Handler - for checking Play-In-Editor state
+  // PIE State Handler - for checking Play-In-Editor state. Clients poll it
+  // while waiting on the editor, so it is scheduled ahead of queued work.
+  FAutomationHandlerTraits StatusQueryTraits;
+  StatusQueryTraits.Priority = EMcpRequestPriority::High;
   RegisterHandler(TEXT("check_pie_state"),
                   [this](const FString &R, const FString &A,
                          const TSharedPtr<FJsonObject> &P,
@@ -1136,6 +1479,24 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
                     SendAutomationError(S, R, TEXT("PIE state check requires editor build"), TEXT("NOT_AVAILABLE"));
                     return true;
 #endif
+                  },
+                  StatusQueryTraits);
+
+  // Request latency percentiles and queue state, scraped by dashboards
+  RegisterHandler(TEXT("get_bridge_metrics"),
+                  [this](const FString &R, const FString &A,
+                         const TSharedPtr<FJsonObject> &P,
+                         TSharedPtr<FMcpBridgeWebSocket> S) {
+                    return HandleGetBridgeMetrics(R, A, P, S);
+                  },
+                  StatusQueryTraits);
+
+  // Batched sub-requests (also reachable as the automation_batch frame type)
+  RegisterHandler(TEXT("automation_batch"),
+                  [this](const FString &R, const FString &A,
+                         const TSharedPtr<FJsonObject> &P,
+                         TSharedPtr<FMcpBridgeWebSocket> S) {
+                    return HandleAutomationBatch(R, A, P, S);
                   });
 }
 
@@ -1143,38 +1504,456 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
 // subsystem was busy. This implementation lives in the primary subsystem
 // translation unit to ensure the symbol is available at link time for
 /**
- * @brief Processes all queued automation requests on the game thread.
+ * @brief Queues an automation request for the game thread. Callable from any
+ * thread; never blocks.
+ *
+ * @param Request The request to run once the game thread drains the queue.
+ */
+void UMcpAutomationBridgeSubsystem::EnqueuePendingAutomationRequest(
+    FPendingAutomationRequest &&Request) {
+  Request.EnqueueSeconds = FPlatformTime::Seconds();
+  McpTraceRequestQueued(Request.RequestId, Request.Action);
+  PendingAutomationRequests.Enqueue(MoveTemp(Request));
+  ++NumPendingAutomationRequests;
+  SchedulePendingAutomationDrain();
+}
+
+/**
+ * @brief Registers a one-shot core ticker callback that drains the pending
+ * queue on the next engine tick, unless one is already registered.
+ */
+void UMcpAutomationBridgeSubsystem::SchedulePendingAutomationDrain() {
+  if (bPendingDrainScheduled.Exchange(true)) {
+    return;
+  }
+  FTSTicker::GetCoreTicker().AddTicker(
+      FTickerDelegate::CreateWeakLambda(this,
+                                        [this](float) {
+                                          ProcessPendingAutomationRequests();
+                                          return false;
+                                        }),
+      0.0f);
+}
+
+/**
+ * @brief Processes queued automation requests on the game thread.
  *
  * Ensures execution on the game thread (re-dispatches if called from another
- * thread), moves the shared pending-request queue into a local list under a
- * lock, clears the shared queue and the scheduled flag, then dispatches each
- * request to ProcessAutomationRequest.
+ * thread). While saving, garbage collection or async loading is in progress
+ * the drain is retried on the next tick. Otherwise newly queued requests are
+ * moved into the priority scheduler, and the requests scheduled when the
+ * drain starts are dispatched to ProcessAutomationRequest in the order
+ * PopScheduledAutomationRequest picks; anything they queue again waits for
+ * the next drain.
  */
 void UMcpAutomationBridgeSubsystem::ProcessPendingAutomationRequests() {
   if (!IsInGameThread()) {
-    AsyncTask(ENamedThreads::GameThread,
-              [this]() { this->ProcessPendingAutomationRequests(); });
+    SchedulePendingAutomationDrain();
     return;
   }
 
-  TArray<FPendingAutomationRequest> LocalQueue;
-  {
-    FScopeLock Lock(&PendingAutomationRequestsMutex);
-    if (PendingAutomationRequests.Num() == 0) {
-      bPendingRequestsScheduled = false;
-      return;
-    }
-    LocalQueue = MoveTemp(PendingAutomationRequests);
-    PendingAutomationRequests.Empty();
-    bPendingRequestsScheduled = false;
+  // Cleared before dequeuing so a request queued from here on schedules a
+  // drain of its own.
+  bPendingDrainScheduled = false;
+  if (NumPendingAutomationRequests <= 0) {
+    return;
+  }
+  if (GIsSavingPackage || IsGarbageCollecting() || IsAsyncLoading()) {
+    SchedulePendingAutomationDrain();
+    return;
   }
 
-  for (const FPendingAutomationRequest &Req : LocalQueue) {
+  MCP_TRACE_SCOPE("McpBridge.DrainQueue");
+  FPendingAutomationRequest Req;
+  while (PendingAutomationRequests.Dequeue(Req)) {
+    SchedulePendingAutomationRequest(MoveTemp(Req));
+  }
+
+  int32 Remaining = NumScheduledAutomationRequests;
+  while (Remaining-- > 0 && PopScheduledAutomationRequest(Req)) {
+    --NumPendingAutomationRequests;
     ProcessAutomationRequest(Req.RequestId, Req.Action, Req.Payload,
                              Req.RequestingSocket);
   }
 }
 
+namespace {
+// Share of dispatches each priority class gets while several are waiting,
+// indexed by EMcpRequestPriority.
+constexpr int32 McpPriorityClassWeights[] = {4, 2, 1};
+static_assert(UE_ARRAY_COUNT(McpPriorityClassWeights) ==
+                  static_cast<int32>(EMcpRequestPriority::Count),
+              "One weight per request priority");
+} // namespace
+
+/**
+ * @brief Picks the scheduling class of a queued request: the priority the
+ * client put in the request envelope, else the default its handler was
+ * registered with, else Normal.
+ */
+EMcpRequestPriority UMcpAutomationBridgeSubsystem::ResolveRequestPriority(
+    const FMcpBridgeWebSocket *RequestingSocket, const FString &RequestId,
+    const FString &Action) const {
+  EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
+  if (ConnectionManager.IsValid() &&
+      ConnectionManager->FindRequestPriority(RequestingSocket, RequestId,
+                                             Priority)) {
+    return Priority;
+  }
+  // FNAME_Find keeps arbitrary client strings out of the name table.
+  const FName Key(*Action, FNAME_Find);
+  if (!Key.IsNone()) {
+    if (const FAutomationActionRoute *Route = AutomationHandlers.Find(Key)) {
+      return Route->Priority;
+    }
+  }
+  return Priority;
+}
+
+bool UMcpAutomationBridgeSubsystem::IsTransactionalAction(
+    const FString &Action) const {
+  const FName Key(*Action, FNAME_Find);
+  if (Key.IsNone()) {
+    return false;
+  }
+  const FAutomationActionRoute *Route = AutomationHandlers.Find(Key);
+  return Route && Route->bTransactional;
+}
+
+/**
+ * @brief Files a request dequeued from PendingAutomationRequests under its
+ * priority class and requesting socket. Game thread only.
+ */
+void UMcpAutomationBridgeSubsystem::SchedulePendingAutomationRequest(
+    FPendingAutomationRequest &&Request) {
+  Request.Priority = ResolveRequestPriority(Request.RequestingSocket.Get(),
+                                            Request.RequestId, Request.Action);
+  FPendingPriorityClass &Class =
+      PendingPriorityClasses[static_cast<int32>(Request.Priority)];
+  const FMcpBridgeWebSocket *Socket = Request.RequestingSocket.Get();
+  FPendingSocketQueue *Queue = Class.SocketQueues.FindByPredicate(
+      [Socket](const FPendingSocketQueue &Candidate) {
+        return Candidate.Socket == Socket;
+      });
+  if (!Queue) {
+    Queue = &Class.SocketQueues.AddDefaulted_GetRef();
+    Queue->Socket = Socket;
+  }
+  Queue->Requests.Add(MoveTemp(Request));
+  ++Class.NumQueued;
+  ++NumScheduledAutomationRequests;
+}
+
+/**
+ * @brief Removes the next request to dispatch from the scheduler. Game thread
+ * only.
+ *
+ * Classes are served by weighted round-robin: the highest priority class
+ * that still has credit goes first, and credits are refilled from
+ * McpPriorityClassWeights once every waiting class has spent its own. An
+ * idle bridge therefore runs a newly queued high priority request next,
+ * while a steady stream of them still lets lower classes through. Within a
+ * class the sockets take turns, one request each, oldest first. The time
+ * the request spent queued is added to its class's wait metrics.
+ *
+ * @return `false` if nothing is scheduled.
+ */
+bool UMcpAutomationBridgeSubsystem::PopScheduledAutomationRequest(
+    FPendingAutomationRequest &OutRequest) {
+  if (NumScheduledAutomationRequests <= 0) {
+    return false;
+  }
+
+  constexpr int32 NumClasses = static_cast<int32>(EMcpRequestPriority::Count);
+  FPendingPriorityClass *Class = nullptr;
+  for (int32 Pass = 0; Pass < 2 && !Class; ++Pass) {
+    for (FPendingPriorityClass &Candidate : PendingPriorityClasses) {
+      if (Candidate.NumQueued > 0 && Candidate.Credits > 0) {
+        Class = &Candidate;
+        break;
+      }
+    }
+    if (!Class) {
+      for (int32 Index = 0; Index < NumClasses; ++Index) {
+        PendingPriorityClasses[Index].Credits = McpPriorityClassWeights[Index];
+      }
+    }
+  }
+  if (!Class) {
+    return false;
+  }
+
+  --Class->Credits;
+  FPendingSocketQueue &Queue = Class->SocketQueues[Class->NextSocketQueue];
+  OutRequest = MoveTemp(Queue.Requests[0]);
+  Queue.Requests.RemoveAt(0);
+  if (Queue.Requests.Num() == 0) {
+    // The following socket's queue moves into this slot and is next.
+    Class->SocketQueues.RemoveAt(Class->NextSocketQueue);
+  } else {
+    ++Class->NextSocketQueue;
+  }
+  if (Class->NextSocketQueue >= Class->SocketQueues.Num()) {
+    Class->NextSocketQueue = 0;
+  }
+  --Class->NumQueued;
+  --NumScheduledAutomationRequests;
+
+  const double WaitSeconds =
+      FMath::Max(0.0, FPlatformTime::Seconds() - OutRequest.EnqueueSeconds);
+  ++Class->NumDispatched;
+  Class->TotalWaitSeconds += WaitSeconds;
+  Class->MaxWaitSeconds = FMath::Max(Class->MaxWaitSeconds, WaitSeconds);
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("Dispatching queued %s request %s (%s) after %.3f ms"),
+         LexToString(OutRequest.Priority), *OutRequest.RequestId,
+         *OutRequest.Action, WaitSeconds * 1000.0);
+  return true;
+}
+
+/**
+ * @brief Reports the pending queue per priority class. Game thread only.
+ *
+ * @return Object with "queued" (all pending requests) and "priorities",
+ * which maps each class name to its scheduled depth, dispatch count and
+ * average and maximum queue wait in milliseconds.
+ */
+TSharedPtr<FJsonObject>
+UMcpAutomationBridgeSubsystem::GetPendingQueueMetrics() const {
+  TSharedPtr<FJsonObject> Metrics = MakeShared<FJsonObject>();
+  Metrics->SetNumberField(TEXT("queued"), NumPendingAutomationRequests.Load());
+  TSharedPtr<FJsonObject> Priorities = MakeShared<FJsonObject>();
+  for (int32 Index = 0; Index < static_cast<int32>(EMcpRequestPriority::Count);
+       ++Index) {
+    const FPendingPriorityClass &Class = PendingPriorityClasses[Index];
+    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetNumberField(TEXT("queued"), Class.NumQueued);
+    Entry->SetNumberField(TEXT("dispatched"),
+                          static_cast<double>(Class.NumDispatched));
+    Entry->SetNumberField(TEXT("avgWaitMs"),
+                          Class.NumDispatched > 0
+                              ? Class.TotalWaitSeconds * 1000.0 /
+                                    Class.NumDispatched
+                              : 0.0);
+    Entry->SetNumberField(TEXT("maxWaitMs"), Class.MaxWaitSeconds * 1000.0);
+    Priorities->SetObjectField(
+        LexToString(static_cast<EMcpRequestPriority>(Index)), Entry);
+  }
+  Metrics->SetObjectField(TEXT("priorities"), Priorities);
+  return Metrics;
+}
+
+/**
+ * @brief Handles get_bridge_metrics: per-action request counts and latency
+ * percentiles (total plus queueWait, dispatch, handler and send phases), the
+ * pending queue per priority and the number of running jobs.
+ *
+ * @param Payload Optional "actions" array limiting the actions reported.
+ * @return Always `true`.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleGetBridgeMetrics(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  TSet<FString> ActionFilter;
+  const TArray<TSharedPtr<FJsonValue>> *Actions = nullptr;
+  if (Payload.IsValid() && Payload->TryGetArrayField(TEXT("actions"), Actions) &&
+      Actions) {
+    for (const TSharedPtr<FJsonValue> &Value : *Actions) {
+      FString Name;
+      if (Value.IsValid() && Value->TryGetString(Name)) {
+        ActionFilter.Add(Name.ToLower());
+      }
+    }
+  }
+
+  TSharedPtr<FJsonObject> Result =
+      ConnectionManager.IsValid()
+          ? TSharedPtr<FJsonObject>(
+                ConnectionManager->GetAutomationMetrics(ActionFilter))
+          : MakeShared<FJsonObject>();
+  Result->SetObjectField(TEXT("queue"), GetPendingQueueMetrics());
+  Result->SetNumberField(TEXT("runningJobs"), RunningAutomationJobs.Num());
+  SendAutomationResponse(RequestingSocket, RequestId, true,
+                         TEXT("Bridge metrics"), Result);
+  return true;
+}
+
+#if WITH_EDITOR
+namespace {
+void McpLogPendingQueueMetrics() {
+  UMcpAutomationBridgeSubsystem *Subsystem =
+      GEditor ? GEditor->GetEditorSubsystem<UMcpAutomationBridgeSubsystem>()
+              : nullptr;
+  if (!Subsystem) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+           TEXT("QueueStats: the automation bridge is not running."));
+    return;
+  }
+  FString Text;
+  TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+  FJsonSerializer::Serialize(Subsystem->GetPendingQueueMetrics().ToSharedRef(),
+                             Writer);
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("QueueStats: %s"),
+         *Text);
+}
+
+FAutoConsoleCommand GMcpBridgeQueueStatsCommand(
+    TEXT("McpAutomationBridge.QueueStats"),
+    TEXT("Logs the pending automation request queue depth and queue wait "
+         "time per request priority."),
+    FConsoleCommandDelegate::CreateStatic(&McpLogPendingQueueMetrics));
+} // namespace
+#endif
+
+/**
+ * @brief Runs the first slice of a handler's job and, unless that finishes
+ * it, keeps advancing it on the per-frame job ticker.
+ *
+ * @param RequestId Request the job answers; progress updates use it too.
+ * @param RequestingSocket Socket the request arrived on, for the abort error.
+ * @param Job The job; it sends the final response itself.
+ */
+void UMcpAutomationBridgeSubsystem::StartAutomationJob(
+    const FString &RequestId, TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+    TSharedRef<FMcpAutomationJob> Job) {
+  check(IsInGameThread());
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  const double BudgetSeconds =
+      Settings ? Settings->JobFrameBudgetMs / 1000.0 : 0.0;
+
+  FRunningAutomationJob Running;
+  Running.RequestId = RequestId;
+  Running.RequestingSocket = MoveTemp(RequestingSocket);
+  Running.Job = Job;
+  Running.LastProgressSeconds = FPlatformTime::Seconds();
+
+  // A batch item's response is only captured while its handler is running.
+  if (BudgetSeconds <= 0.0 ||
+      (!CapturingBatchItemId.IsEmpty() && RequestId == CapturingBatchItemId)) {
+    while (!StepAutomationJob(Running, MAX_dbl)) {
+    }
+    return;
+  }
+  if (StepAutomationJob(Running, FPlatformTime::Seconds() + BudgetSeconds)) {
+    return;
+  }
+  RunningAutomationJobs.Add(MoveTemp(Running));
+  if (!AutomationJobTickHandle.IsValid()) {
+    AutomationJobTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(
+            this, &UMcpAutomationBridgeSubsystem::TickAutomationJobs),
+        0.0f);
+  }
+}
+
+/**
+ * @brief Calls the job's Step once and sends a progress_update when one is
+ * due. A job that throws is answered with INTERNAL_ERROR and counts as
+ * finished.
+ *
+ * @return `true` if the job is finished.
+ */
+bool UMcpAutomationBridgeSubsystem::StepAutomationJob(
+    FRunningAutomationJob &Running, double DeadlineSeconds) {
+  FMcpJobSlice Slice(DeadlineSeconds);
+  try {
+    if (Running.Job->Step(Slice)) {
+      return true;
+    }
+  } catch (const std::exception &E) {
+    SendAutomationError(
+        Running.RequestingSocket, Running.RequestId,
+        FString::Printf(TEXT("Internal error: %s"), ANSI_TO_TCHAR(E.what())),
+        TEXT("INTERNAL_ERROR"));
+    return true;
+  } catch (...) {
+    SendAutomationError(Running.RequestingSocket, Running.RequestId,
+                        TEXT("Internal error (unknown)."),
+                        TEXT("INTERNAL_ERROR"));
+    return true;
+  }
+
+  if (Slice.WasProgressReported()) {
+    Running.ProgressPercent = Slice.GetProgressPercent();
+    Running.ProgressMessage = Slice.GetProgressMessage();
+  }
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  const double IntervalSeconds =
+      Settings ? Settings->JobProgressIntervalSeconds : 1.0;
+  const double NowSeconds = FPlatformTime::Seconds();
+  if (NowSeconds - Running.LastProgressSeconds >= IntervalSeconds) {
+    Running.LastProgressSeconds = NowSeconds;
+    SendProgressUpdate(Running.RequestId, Running.ProgressPercent,
+                       Running.ProgressMessage, true);
+  }
+  return false;
+}
+
+/**
+ * @brief Per-frame ticker advancing running jobs within JobFrameBudgetMs.
+ *
+ * Jobs take turns starting after the one that ran last, so with more jobs
+ * than fit in one frame each still advances every few frames. Nothing runs
+ * while saving, garbage collection or async loading is in progress.
+ *
+ * @return `false` (unregistering the ticker) once no jobs are left.
+ */
+bool UMcpAutomationBridgeSubsystem::TickAutomationJobs(float DeltaTime) {
+  if (GIsSavingPackage || IsGarbageCollecting() || IsAsyncLoading()) {
+    return true;
+  }
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  const double BudgetSeconds =
+      Settings ? FMath::Max(0.0, Settings->JobFrameBudgetMs / 1000.0) : 0.0;
+  const double DeadlineSeconds = FPlatformTime::Seconds() + BudgetSeconds;
+
+  int32 Turns = RunningAutomationJobs.Num();
+  while (Turns-- > 0 && RunningAutomationJobs.Num() > 0) {
+    if (NextAutomationJob >= RunningAutomationJobs.Num()) {
+      NextAutomationJob = 0;
+    }
+    // Taken out of the array while it runs: a step may start another job.
+    FRunningAutomationJob Running =
+        MoveTemp(RunningAutomationJobs[NextAutomationJob]);
+    RunningAutomationJobs.RemoveAt(NextAutomationJob);
+    if (!StepAutomationJob(Running, DeadlineSeconds)) {
+      RunningAutomationJobs.Insert(MoveTemp(Running), NextAutomationJob);
+      ++NextAutomationJob;
+    }
+    if (FPlatformTime::Seconds() >= DeadlineSeconds) {
+      break;
+    }
+  }
+
+  if (RunningAutomationJobs.Num() == 0) {
+    AutomationJobTickHandle.Reset();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Stops every running job and answers its request with JOB_ABORTED.
+ */
+void UMcpAutomationBridgeSubsystem::AbortAutomationJobs() {
+  if (AutomationJobTickHandle.IsValid()) {
+    FTSTicker::GetCoreTicker().RemoveTicker(AutomationJobTickHandle);
+    AutomationJobTickHandle.Reset();
+  }
+  TArray<FRunningAutomationJob> Jobs = MoveTemp(RunningAutomationJobs);
+  RunningAutomationJobs.Reset();
+  for (FRunningAutomationJob &Running : Jobs) {
+    Running.Job->Abort();
+    SendAutomationError(Running.RequestingSocket, Running.RequestId,
+                        TEXT("The editor shut down before the job finished."),
+                        TEXT("JOB_ABORTED"));
+  }
+}
+
 // ============================================================================
 // ExecuteEditorCommands Implementation
 // ============================================================================
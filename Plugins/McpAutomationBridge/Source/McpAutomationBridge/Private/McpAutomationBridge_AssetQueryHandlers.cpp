@@ -4,6 +4,9 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeListQuery.h"
+#include "McpBridgeResponseStream.h"
 
 #if WITH_EDITOR
 #include "EditorAssetLibrary.h"
@@ -345,9 +348,47 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
       Payload->TryGetBoolField(TEXT("recursiveClasses"), bRecursiveClasses);
     Filter.bRecursiveClasses = bRecursiveClasses;
 
+    // In-memory (unsaved) assets are included, as assets created through the
+    // bridge are not saved yet, unless the client asks for onDiskOnly. Only
+    // onDiskOnly requests are served by the worker lane, which cannot
+    // enumerate in-memory assets, so the result does not depend on which
+    // thread served the request.
+    const bool bOnDiskOnly = GetJsonBoolField(Payload, TEXT("onDiskOnly"));
+    Filter.bIncludeOnlyOnDiskAssets = bOnDiskOnly;
+
+    // fields / limit / cursor. The scope covers every filter input so a
+    // cursor cannot be replayed against a different search.
+    FString QueryScope = FString::Printf(TEXT("search_assets|%d|%d|%d"),
+                                         bRecursivePaths ? 1 : 0,
+                                         bRecursiveClasses ? 1 : 0,
+                                         bOnDiskOnly ? 1 : 0);
+    for (const FName &PackagePath : Filter.PackagePaths) {
+      QueryScope += TEXT("|") + PackagePath.ToString();
+    }
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+    for (const FTopLevelAssetPath &ClassPath : Filter.ClassPaths) {
+      QueryScope += TEXT("|") + ClassPath.ToString();
+    }
+#else
+    for (const FName &ClassName : Filter.ClassNames) {
+      QueryScope += TEXT("|") + ClassName.ToString();
+    }
+#endif
+    static const TCHAR *const AssetFields[] = {
+        TEXT("assetName"), TEXT("assetPath"), TEXT("classPath")};
+    FMcpListQuery Query;
+    FString QueryErrorCode;
+    FString QueryError;
+    if (!Query.Parse(Payload, AssetFields, QueryScope, 100, QueryErrorCode,
+                     QueryError)) {
+      SendAutomationError(RequestingSocket, RequestId, QueryError,
+                          QueryErrorCode);
+      return true;
+    }
+
     // Execute Query with safety limit
     FAssetRegistryModule &AssetRegistryModule =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+        FModuleManager::GetModuleChecked<FAssetRegistryModule>(
             "AssetRegistry");
     IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
     
@@ -359,41 +400,61 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetQueryAction(
     TArray<FAssetData> AssetDataList;
     AssetRegistry.GetAssets(Filter, AssetDataList);
 
-    // Apply Limit
-    int32 Limit = 100;
-    if (Payload->HasField(TEXT("limit")))
-      Payload->TryGetNumberField(TEXT("limit"), Limit);
-    if (Limit > 0 && AssetDataList.Num() > Limit) {
-      AssetDataList.SetNum(Limit);
+    // Apply Limit. Registry order is not stable between calls, so results
+    // that span pages are sorted to keep page boundaries consistent.
+    const int32 Limit = Query.GetLimit();
+    const int32 Start = FMath::Min(Query.GetStart(), AssetDataList.Num());
+    if (Start > 0 || (Limit > 0 && AssetDataList.Num() > Limit)) {
+      AssetDataList.Sort([](const FAssetData &A, const FAssetData &B) {
+        const int32 Order = A.PackageName.Compare(B.PackageName);
+        return Order != 0 ? Order < 0
+                          : A.AssetName.Compare(B.AssetName) < 0;
+      });
     }
-
-    // Build Response
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> AssetsArray;
-
-    for (const FAssetData &Data : AssetDataList) {
-      TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-      AssetObj->SetStringField(TEXT("assetName"), Data.AssetName.ToString());
+    const int32 End =
+        Limit > 0 ? FMath::Min(AssetDataList.Num(), Start + Limit)
+                  : AssetDataList.Num();
+    const int32 NextPosition = End < AssetDataList.Num() ? End : INDEX_NONE;
+
+    // Build Response (streamed: an unlimited search can return every asset
+    // in the project)
+    SendAutomationResponseStreamed(
+        RequestingSocket, RequestId, TEXT("Assets found."),
+        [&AssetDataList, &Query, Start, End, NextPosition,
+         bOnDiskOnly](FMcpJsonStreamWriter &Writer) {
+          const bool bWantName = Query.WantsField(TEXT("assetName"));
+          const bool bWantPath = Query.WantsField(TEXT("assetPath"));
+          const bool bWantClass = Query.WantsField(TEXT("classPath"));
+
+          Writer.WriteBool(TEXT("success"), true);
+          Writer.WriteBool(TEXT("onDiskOnly"), bOnDiskOnly);
+          FMcpStreamedArray Assets(Writer, TEXT("assets"));
+          for (int32 Index = Start; Index < End; ++Index) {
+            const FAssetData &Data = AssetDataList[Index];
+            FMcpJsonStreamWriter &Item = Assets.BeginItem();
+            Item.BeginObject();
+            if (bWantName)
+              Item.WriteString(TEXT("assetName"), Data.AssetName.ToString());
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
-      AssetObj->SetStringField(TEXT("assetPath"),
+            if (bWantPath)
+              Item.WriteString(TEXT("assetPath"),
                                Data.GetSoftObjectPath().ToString());
-      AssetObj->SetStringField(TEXT("classPath"),
+            if (bWantClass)
+              Item.WriteString(TEXT("classPath"),
                                Data.AssetClassPath.ToString());
 #else
-      AssetObj->SetStringField(TEXT("assetPath"),
+            if (bWantPath)
+              Item.WriteString(TEXT("assetPath"),
                                Data.ToSoftObjectPath().ToString());
-      AssetObj->SetStringField(TEXT("classPath"),
-                               Data.AssetClass.ToString());
+            if (bWantClass)
+              Item.WriteString(TEXT("classPath"), Data.AssetClass.ToString());
 #endif
-      AssetsArray.Add(MakeShared<FJsonValueObject>(AssetObj));
-    }
-
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetArrayField(TEXT("assets"), AssetsArray);
-    Result->SetNumberField(TEXT("count"), AssetsArray.Num());
-
-    SendAutomationResponse(RequestingSocket, RequestId, true,
-                           TEXT("Assets found."), Result);
+            Item.EndObject();
+            Assets.EndItem();
+          }
+          Writer.WriteInteger(TEXT("count"), Assets.End());
+          Query.WritePageInfo(Writer, NextPosition);
+        });
     return true;
   }
 #if WITH_EDITOR
@@ -448,14 +509,24 @@ bool UMcpAutomationBridgeSubsystem::HandleSearchAssets(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
-  // Build a payload with subAction for the existing handler
+  // This route may run on a worker lane, so it only ever reaches the
+  // search_assets branch; the other subActions need the game thread and are
+  // available through asset_query.
   TSharedPtr<FJsonObject> RoutedPayload = Payload;
   if (Payload.IsValid()) {
-    // Clone and add subAction if not present
-    if (!Payload->HasField(TEXT("subAction"))) {
-      RoutedPayload = MakeShared<FJsonObject>(*Payload);
-      RoutedPayload->SetStringField(TEXT("subAction"), TEXT("search_assets"));
+    FString SubAction;
+    if (Payload->TryGetStringField(TEXT("subAction"), SubAction) &&
+        !SubAction.IsEmpty() && SubAction != TEXT("search_assets")) {
+      SendAutomationError(
+          RequestingSocket, RequestId,
+          FString::Printf(TEXT("search_assets does not accept subAction "
+                               "'%s'; use asset_query instead."),
+                          *SubAction),
+          TEXT("INVALID_SUBACTION"));
+      return true;
     }
+    RoutedPayload = MakeShared<FJsonObject>(*Payload);
+    RoutedPayload->SetStringField(TEXT("subAction"), TEXT("search_assets"));
   }
   
   // Delegate to HandleAssetQueryAction with "asset_query" as the action
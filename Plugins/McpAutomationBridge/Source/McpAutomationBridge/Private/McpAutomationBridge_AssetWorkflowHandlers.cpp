@@ -6,9 +6,11 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeAutomationJob.h"
 #include "Misc/EngineVersionComparison.h"
 #include "Misc/ScopeExit.h"
 #include "UObject/MetaData.h"
+#include "UObject/StrongObjectPtr.h"
 
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/Paths.h"
@@ -911,82 +913,107 @@ bool UMcpAutomationBridgeSubsystem::HandleBulkDeleteAssets(
     }
   }
 
-  TArray<UObject *> ObjectsToDelete;
-  TArray<FString> ValidPaths;
+  // Loading the assets is the slow part for large sets, so it runs one asset
+  // per unit of work; the delete itself needs them all and runs at the end.
+  // The loaded assets are kept alive across frames until then.
+  struct FBulkDeleteState {
+    TArray<TStrongObjectPtr<UObject>> Loaded;
+    TArray<FString> ValidPaths;
+  };
+  TSharedRef<FBulkDeleteState> State = MakeShared<FBulkDeleteState>();
 
-  for (const FString &AssetPath : AssetPaths) {
+  auto LoadAsset = [State, AssetPaths](int32 Index) {
+    const FString &AssetPath = AssetPaths[Index];
     if (UEditorAssetLibrary::DoesAssetExist(AssetPath)) {
       if (UObject *Asset = UEditorAssetLibrary::LoadAsset(AssetPath)) {
-        ObjectsToDelete.Add(Asset);
-        ValidPaths.Add(AssetPath);
+        State->Loaded.Emplace(Asset);
+        State->ValidPaths.Add(AssetPath);
       }
     }
-  }
+  };
 
-  if (ObjectsToDelete.Num() == 0) {
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetBoolField(TEXT("success"), false);
-    Result->SetStringField(TEXT("error"), TEXT("No valid assets found"));
-    SendAutomationResponse(RequestingSocket, RequestId, false,
-                           TEXT("No valid assets"), Result,
-                           TEXT("NO_VALID_ASSETS"));
-    return true;
-  }
+  auto DeleteLoaded = [this, State, bShowConfirmation, bFixupRedirectors,
+                       RequestId, RequestingSocket]() {
+    // Released before deleting so the job's references do not keep the
+    // assets alive.
+    TArray<UObject *> ObjectsToDelete;
+    for (const TStrongObjectPtr<UObject> &Asset : State->Loaded) {
+      ObjectsToDelete.Add(Asset.Get());
+    }
+    State->Loaded.Empty();
+    const TArray<FString> &ValidPaths = State->ValidPaths;
+
+    if (ObjectsToDelete.Num() == 0) {
+      TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+      Result->SetBoolField(TEXT("success"), false);
+      Result->SetStringField(TEXT("error"), TEXT("No valid assets found"));
+      SendAutomationResponse(RequestingSocket, RequestId, false,
+                             TEXT("No valid assets"), Result,
+                             TEXT("NO_VALID_ASSETS"));
+      return;
+    }
 
-  int32 DeletedCount =
-      ObjectTools::DeleteObjects(ObjectsToDelete, bShowConfirmation);
+    int32 DeletedCount =
+        ObjectTools::DeleteObjects(ObjectsToDelete, bShowConfirmation);
 
-  if (bFixupRedirectors && DeletedCount > 0) {
-    FAssetRegistryModule &AssetRegistryModule =
-        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
-            TEXT("AssetRegistry"));
-    IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+    if (bFixupRedirectors && DeletedCount > 0) {
+      FAssetRegistryModule &AssetRegistryModule =
+          FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+              TEXT("AssetRegistry"));
+      IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
 
-    FARFilter Filter;
+      FARFilter Filter;
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-    Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/CoreUObject"),
-                                             TEXT("ObjectRedirector")));
+      Filter.ClassPaths.Add(FTopLevelAssetPath(TEXT("/Script/CoreUObject"),
+                                               TEXT("ObjectRedirector")));
 #else
-    Filter.ClassNames.Add(FName(TEXT("ObjectRedirector")));
+      Filter.ClassNames.Add(FName(TEXT("ObjectRedirector")));
 #endif
 
-    TArray<FAssetData> RedirectorAssets;
-    AssetRegistry.GetAssets(Filter, RedirectorAssets);
+      TArray<FAssetData> RedirectorAssets;
+      AssetRegistry.GetAssets(Filter, RedirectorAssets);
 
-    if (RedirectorAssets.Num() > 0) {
-      TArray<UObjectRedirector *> Redirectors;
-      for (const FAssetData &Asset : RedirectorAssets) {
-        if (UObjectRedirector *Redirector =
-                Cast<UObjectRedirector>(Asset.GetAsset())) {
-          Redirectors.Add(Redirector);
+      if (RedirectorAssets.Num() > 0) {
+        TArray<UObjectRedirector *> Redirectors;
+        for (const FAssetData &Asset : RedirectorAssets) {
+          if (UObjectRedirector *Redirector =
+                  Cast<UObjectRedirector>(Asset.GetAsset())) {
+            Redirectors.Add(Redirector);
+          }
         }
-      }
 
-      if (Redirectors.Num() > 0) {
-        IAssetTools &AssetTools =
-            FModuleManager::LoadModuleChecked<FAssetToolsModule>(
-                TEXT("AssetTools"))
-                .Get();
-        AssetTools.FixupReferencers(Redirectors);
+        if (Redirectors.Num() > 0) {
+          IAssetTools &AssetTools =
+              FModuleManager::LoadModuleChecked<FAssetToolsModule>(
+                  TEXT("AssetTools"))
+                  .Get();
+          AssetTools.FixupReferencers(Redirectors);
+        }
       }
     }
-  }
 
-  TArray<TSharedPtr<FJsonValue>> DeletedArray;
-  for (const FString &Path : ValidPaths) {
-    DeletedArray.Add(MakeShared<FJsonValueString>(Path));
-  }
+    TArray<TSharedPtr<FJsonValue>> DeletedArray;
+    for (const FString &Path : ValidPaths) {
+      DeletedArray.Add(MakeShared<FJsonValueString>(Path));
+    }
 
-  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-  Result->SetBoolField(TEXT("success"), DeletedCount > 0);
-  Result->SetArrayField(TEXT("deleted"), DeletedArray);
-  Result->SetNumberField(TEXT("requested"), ObjectsToDelete.Num());
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), DeletedCount > 0);
+    Result->SetArrayField(TEXT("deleted"), DeletedArray);
+    Result->SetNumberField(TEXT("requested"), ObjectsToDelete.Num());
 
-  SendAutomationResponse(
-      RequestingSocket, RequestId, DeletedCount > 0,
-      FString::Printf(TEXT("Deleted %d of %d assets"), DeletedCount,
-                      ObjectsToDelete.Num()),
-      Result, DeletedCount > 0 ? FString() : TEXT("BULK_DELETE_FAILED"));
+    SendAutomationResponse(
+        RequestingSocket, RequestId, DeletedCount > 0,
+        FString::Printf(TEXT("Deleted %d of %d assets"), DeletedCount,
+                        ObjectsToDelete.Num()),
+        Result, DeletedCount > 0 ? FString() : TEXT("BULK_DELETE_FAILED"));
+  };
+
+  StartAutomationJob(RequestId, RequestingSocket,
+                     MakeShared<FMcpIndexedJob>(AssetPaths.Num(),
+                                                TEXT("Loading assets to delete"),
+                                                MoveTemp(LoadAsset),
+                                                MoveTemp(DeleteLoaded)));
   return true;
 #else
   SendAutomationResponse(RequestingSocket, RequestId, false,
@@ -3244,119 +3271,119 @@ bool UMcpAutomationBridgeSubsystem::HandleGenerateLODs(
     return true;
   }
 
-  // Dispatch to Game Thread
-  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(this);
-  TArray<FString> PathsCopy = Paths;
-
-  AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, RequestId,
-                                        RequestingSocket, PathsCopy, NumLODs]() {
-    UMcpAutomationBridgeSubsystem *Subsystem = WeakSubsystem.Get();
-    if (!Subsystem)
-      return;
-
+  // One asset per unit of work, so the editor keeps rendering between mesh
+  // builds; progress updates are sent by the job runner.
+  struct FLodJobState {
     int32 SuccessCount = 0;
     TArray<FString> NotFoundPaths;
     TArray<FString> NotMeshPaths;
+  };
+  TSharedRef<FLodJobState> State = MakeShared<FLodJobState>();
 
-    for (const FString &Path : PathsCopy) {
-      // Send progress update to prevent timeout
-      Subsystem->SendProgressUpdate(RequestId, -1.0f, 
-          FString::Printf(TEXT("Processing LOD generation for: %s"), *Path), true);
-      
-      UObject *Obj = LoadObject<UObject>(nullptr, *Path);
-      
-      if (!Obj) {
-        NotFoundPaths.Add(Path);
-        continue;
+  auto GenerateForPath = [State, Paths, NumLODs](int32 Index) {
+    const FString &Path = Paths[Index];
+    UObject *Obj = LoadObject<UObject>(nullptr, *Path);
+    
+    if (!Obj) {
+      State->NotFoundPaths.Add(Path);
+      return;
+    }
+    
+    // Try Static Mesh
+    if (UStaticMesh *Mesh = Cast<UStaticMesh>(Obj)) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+             TEXT("Generating %d LODs for static mesh %s"), NumLODs, *Path);
+
+      Mesh->Modify();
+      Mesh->SetNumSourceModels(NumLODs);
+
+      // Configure LOD reduction settings with progressive reduction
+      for (int32 LODIndex = 1; LODIndex < NumLODs; LODIndex++) {
+        FStaticMeshSourceModel &SourceModel = Mesh->GetSourceModel(LODIndex);
+        FMeshReductionSettings &ReductionSettings =
+            SourceModel.ReductionSettings;
+
+        // Progressive reduction: 50%, 25%, 12.5%...
+        float ReductionPercent =
+            1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
+        ReductionSettings.PercentTriangles = ReductionPercent;
+        ReductionSettings.PercentVertices = ReductionPercent;
+
+        // Enable reduction for this LOD level
+        SourceModel.BuildSettings.bRecomputeNormals = false;
+        SourceModel.BuildSettings.bRecomputeTangents = false;
+        SourceModel.BuildSettings.bUseMikkTSpace = true;
       }
-      
-      // Try Static Mesh
-      if (UStaticMesh *Mesh = Cast<UStaticMesh>(Obj)) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-               TEXT("Generating %d LODs for static mesh %s"), NumLODs, *Path);
-
-        Mesh->Modify();
-        Mesh->SetNumSourceModels(NumLODs);
-
-        // Configure LOD reduction settings with progressive reduction
-        for (int32 LODIndex = 1; LODIndex < NumLODs; LODIndex++) {
-          FStaticMeshSourceModel &SourceModel = Mesh->GetSourceModel(LODIndex);
-          FMeshReductionSettings &ReductionSettings =
-              SourceModel.ReductionSettings;
-
-          // Progressive reduction: 50%, 25%, 12.5%...
-          float ReductionPercent =
-              1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
-          ReductionSettings.PercentTriangles = ReductionPercent;
-          ReductionSettings.PercentVertices = ReductionPercent;
-
-          // Enable reduction for this LOD level
-          SourceModel.BuildSettings.bRecomputeNormals = false;
-          SourceModel.BuildSettings.bRecomputeTangents = false;
-          SourceModel.BuildSettings.bUseMikkTSpace = true;
-        }
 
-        // Build the mesh with new LOD settings
-        Mesh->Build();
-        Mesh->PostEditChange();
-        McpSafeAssetSave(Mesh);
+      // Build the mesh with new LOD settings
+      Mesh->Build();
+      Mesh->PostEditChange();
+      McpSafeAssetSave(Mesh);
 
-        SuccessCount++;
-      } else {
-        // Asset exists but is not a static mesh
-        NotMeshPaths.Add(Path);
-      }
+      State->SuccessCount++;
+    } else {
+      // Asset exists but is not a static mesh
+      State->NotMeshPaths.Add(Path);
     }
+  };
 
+  auto SendResult = [this, State, Paths, NumLODs, RequestId,
+                     RequestingSocket]() {
     TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
     
     // CRITICAL FIX: Return proper success/failure based on actual results
     // Previously always returned success=true even when 0 meshes processed
-    bool bSuccess = SuccessCount > 0;
+    bool bSuccess = State->SuccessCount > 0;
     Resp->SetBoolField(TEXT("success"), bSuccess);
-    Resp->SetNumberField(TEXT("processed"), SuccessCount);
-    Resp->SetNumberField(TEXT("requested"), PathsCopy.Num());
+    Resp->SetNumberField(TEXT("processed"), State->SuccessCount);
+    Resp->SetNumberField(TEXT("requested"), Paths.Num());
     Resp->SetNumberField(TEXT("lodCount"), NumLODs);
     
     // Add details about failures
-    if (NotFoundPaths.Num() > 0) {
+    if (State->NotFoundPaths.Num() > 0) {
       TArray<TSharedPtr<FJsonValue>> NotFoundArray;
-      for (const FString& P : NotFoundPaths) {
+      for (const FString& P : State->NotFoundPaths) {
         NotFoundArray.Add(MakeShared<FJsonValueString>(P));
       }
       Resp->SetArrayField(TEXT("notFoundPaths"), NotFoundArray);
-      Resp->SetNumberField(TEXT("notFoundCount"), NotFoundPaths.Num());
+      Resp->SetNumberField(TEXT("notFoundCount"), State->NotFoundPaths.Num());
     }
     
-    if (NotMeshPaths.Num() > 0) {
+    if (State->NotMeshPaths.Num() > 0) {
       TArray<TSharedPtr<FJsonValue>> NotMeshArray;
-      for (const FString& P : NotMeshPaths) {
+      for (const FString& P : State->NotMeshPaths) {
         NotMeshArray.Add(MakeShared<FJsonValueString>(P));
       }
       Resp->SetArrayField(TEXT("notMeshPaths"), NotMeshArray);
-      Resp->SetNumberField(TEXT("notMeshCount"), NotMeshPaths.Num());
+      Resp->SetNumberField(TEXT("notMeshCount"), State->NotMeshPaths.Num());
     }
     
     FString Message;
     FString ErrorCode;
     
     if (bSuccess) {
-      Message = FString::Printf(TEXT("Generated LODs for %d mesh(es)"), SuccessCount);
-    } else if (NotFoundPaths.Num() > 0 && NotMeshPaths.Num() == 0) {
-      Message = FString::Printf(TEXT("No assets found. %d path(s) not found."), NotFoundPaths.Num());
+      Message = FString::Printf(TEXT("Generated LODs for %d mesh(es)"), State->SuccessCount);
+    } else if (State->NotFoundPaths.Num() > 0 && State->NotMeshPaths.Num() == 0) {
+      Message = FString::Printf(TEXT("No assets found. %d path(s) not found."), State->NotFoundPaths.Num());
       ErrorCode = TEXT("ASSET_NOT_FOUND");
-    } else if (NotMeshPaths.Num() > 0 && NotFoundPaths.Num() == 0) {
-      Message = FString::Printf(TEXT("No static meshes found. %d asset(s) are not meshes."), NotMeshPaths.Num());
+    } else if (State->NotMeshPaths.Num() > 0 && State->NotFoundPaths.Num() == 0) {
+      Message = FString::Printf(TEXT("No static meshes found. %d asset(s) are not meshes."), State->NotMeshPaths.Num());
       ErrorCode = TEXT("INVALID_ASSET_TYPE");
     } else {
       Message = FString::Printf(TEXT("No LODs generated. %d not found, %d not meshes."), 
-                                NotFoundPaths.Num(), NotMeshPaths.Num());
+                                State->NotFoundPaths.Num(), State->NotMeshPaths.Num());
       ErrorCode = TEXT("LOD_GENERATION_FAILED");
     }
     
-    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess,
-                                      Message, Resp, ErrorCode);
-  });
+    SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message,
+                           Resp, ErrorCode);
+  };
+
+  StartAutomationJob(RequestId, RequestingSocket,
+                     MakeShared<FMcpIndexedJob>(Paths.Num(),
+                                                TEXT("Generating LODs"),
+                                                MoveTemp(GenerateForPath),
+                                                MoveTemp(SendResult)));
 
   return true;
 #else
@@ -0,0 +1,276 @@
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformTime.h"
+#include "McpAutomationBridgeGlobals.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "Misc/ScopeExit.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "ScopedTransaction.h"
+#endif
+
+namespace {
+// Upper bound on sub-requests per batch; the whole batch holds the game
+// thread, so a runaway client cannot stall the editor indefinitely.
+constexpr int32 McpMaxAutomationBatchItems = 1000;
+} // namespace
+
+/**
+ * @brief Handles "automation_batch": runs a list of sub-requests back to back
+ * in one game-thread dispatch and replies with a single aggregated response.
+ *
+ * Payload fields:
+ *  - items: array of { requestId?, action, payload? } objects, run in order.
+ *  - transaction: true, or a description string, to wrap every item in one
+ *    FScopedTransaction (a single undo step).
+ *  - onError: "stop" (default) skips the remaining items after the first
+ *    failure; "continue" runs every item. With a transaction, a stopped
+ *    batch is also undone. Undo only reverts what the transaction recorded,
+ *    so of the items that succeeded before the failure only those whose
+ *    handler is registered as transactional (FAutomationHandlerTraits::
+ *    bTransactional: the property and container actions) are reported as
+ *    "rolled_back"; the rest are "not_reverted", as asset creation, saves,
+ *    deletes, files on disk and source control are left as they are.
+ *
+ * Each item's handler response is captured instead of being sent as its own
+ * frame. An item whose handler replies later (after returning) is reported as
+ * "pending" and its response is delivered separately under the item's
+ * requestId, which defaults to "<batch requestId>#<index>".
+ *
+ * @param RequestId Identifier of the batch; echoed in the aggregated response.
+ * @param Action Top-level action name; must be "automation_batch".
+ * @param Payload JSON payload carrying the items and batch options.
+ * @param RequestingSocket Websocket to which the response will be sent.
+ * @return true if the action was "automation_batch" and a response was sent.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleAutomationBatch(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  if (!Action.Equals(TEXT("automation_batch"), ESearchCase::IgnoreCase))
+    return false;
+
+  if (!CapturingBatchItemId.IsEmpty()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("automation_batch cannot be nested."),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *Items = nullptr;
+  if (!Payload.IsValid() || !Payload->TryGetArrayField(TEXT("items"), Items) ||
+      !Items || Items->Num() == 0) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("automation_batch requires a non-empty 'items' "
+                             "array."),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+  if (Items->Num() > McpMaxAutomationBatchItems) {
+    SendAutomationError(
+        RequestingSocket, RequestId,
+        FString::Printf(TEXT("automation_batch accepts at most %d items (got "
+                             "%d)."),
+                        McpMaxAutomationBatchItems, Items->Num()),
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const FString OnError = GetJsonStringField(Payload, TEXT("onError"));
+  const bool bContinueOnError =
+      OnError.Equals(TEXT("continue"), ESearchCase::IgnoreCase);
+  if (!OnError.IsEmpty() && !bContinueOnError &&
+      !OnError.Equals(TEXT("stop"), ESearchCase::IgnoreCase)) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        FString::Printf(TEXT("Unknown onError mode '%s'; "
+                                             "expected 'stop' or 'continue'."),
+                                        *OnError),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  bool bUseTransaction = false;
+  FString TransactionDescription = TEXT("MCP Automation Batch");
+  if (!Payload->TryGetBoolField(TEXT("transaction"), bUseTransaction)) {
+    FString Description;
+    if (Payload->TryGetStringField(TEXT("transaction"), Description) &&
+        !Description.IsEmpty()) {
+      bUseTransaction = true;
+      TransactionDescription = Description;
+    }
+  }
+
+  const double StartSeconds = FPlatformTime::Seconds();
+  int32 Succeeded = 0;
+  int32 Failed = 0;
+  int32 Pending = 0;
+  int32 Skipped = 0;
+  bool bRolledBack = false;
+  TArray<TSharedPtr<FJsonValue>> ItemResults;
+  ItemResults.Reserve(Items->Num());
+
+  {
+#if WITH_EDITOR
+    TUniquePtr<FScopedTransaction> Transaction;
+    // Where the batch's own undo record will land, so a rollback never undoes
+    // an earlier transaction. Starting a transaction drops any redo entries.
+    int32 ExpectedQueueLength = INDEX_NONE;
+    if (bUseTransaction) {
+      if (GEditor && GEditor->Trans) {
+        ExpectedQueueLength = GEditor->Trans->GetQueueLength() -
+                              GEditor->Trans->GetUndoCount() + 1;
+      }
+      Transaction = MakeUnique<FScopedTransaction>(
+          FText::FromString(TransactionDescription));
+    }
+#endif
+
+    bool bStopped = false;
+    for (int32 Index = 0; Index < Items->Num(); ++Index) {
+      const TSharedPtr<FJsonObject> *ItemObj = nullptr;
+      const bool bIsObject = (*Items)[Index].IsValid() &&
+                             (*Items)[Index]->TryGetObject(ItemObj) &&
+                             ItemObj && ItemObj->IsValid();
+
+      FString ItemRequestId;
+      FString ItemAction;
+      TSharedPtr<FJsonObject> ItemPayload;
+      if (bIsObject) {
+        (*ItemObj)->TryGetStringField(TEXT("requestId"), ItemRequestId);
+        (*ItemObj)->TryGetStringField(TEXT("action"), ItemAction);
+        const TSharedPtr<FJsonObject> *ItemPayloadObj = nullptr;
+        if ((*ItemObj)->TryGetObjectField(TEXT("payload"), ItemPayloadObj) &&
+            ItemPayloadObj) {
+          ItemPayload = *ItemPayloadObj;
+        }
+      }
+      if (ItemRequestId.IsEmpty() || ItemRequestId == RequestId) {
+        ItemRequestId = FString::Printf(TEXT("%s#%d"), *RequestId, Index);
+      }
+
+      TSharedPtr<FJsonObject> ItemResult = MakeShared<FJsonObject>();
+      ItemResult->SetNumberField(TEXT("index"), Index);
+      ItemResult->SetStringField(TEXT("requestId"), ItemRequestId);
+      ItemResult->SetStringField(TEXT("action"), ItemAction);
+      ItemResults.Add(MakeShared<FJsonValueObject>(ItemResult));
+
+      if (bStopped) {
+        ItemResult->SetStringField(TEXT("status"), TEXT("skipped"));
+        ++Skipped;
+        continue;
+      }
+
+      if (ItemAction.IsEmpty() || ItemAction.Len() > 128 ||
+          ItemAction.Equals(TEXT("automation_batch"),
+                            ESearchCase::IgnoreCase)) {
+        ItemResult->SetStringField(TEXT("status"), TEXT("failed"));
+        ItemResult->SetBoolField(TEXT("success"), false);
+        ItemResult->SetStringField(
+            TEXT("message"), TEXT("Batch item needs an 'action' other than "
+                                  "automation_batch."));
+        ItemResult->SetStringField(TEXT("error"), TEXT("INVALID_ARGUMENT"));
+        ++Failed;
+        bStopped = !bContinueOnError;
+        continue;
+      }
+
+      CapturingBatchItemId = ItemRequestId;
+      CapturedBatchItemResponse = FAutomationBatchItemResponse();
+      {
+        ON_SCOPE_EXIT { CapturingBatchItemId.Reset(); };
+        try {
+          DispatchAutomationAction(ItemRequestId, ItemAction, ItemPayload,
+                                   RequestingSocket);
+        } catch (const std::exception &E) {
+          SendAutomationError(RequestingSocket, ItemRequestId,
+                              FString::Printf(TEXT("Internal error: %s"),
+                                              ANSI_TO_TCHAR(E.what())),
+                              TEXT("INTERNAL_ERROR"));
+        } catch (...) {
+          SendAutomationError(RequestingSocket, ItemRequestId,
+                              TEXT("Internal error (unknown)."),
+                              TEXT("INTERNAL_ERROR"));
+        }
+      }
+
+      const FAutomationBatchItemResponse &Response = CapturedBatchItemResponse;
+      if (!Response.bResponded) {
+        ItemResult->SetStringField(TEXT("status"), TEXT("pending"));
+        ++Pending;
+        continue;
+      }
+
+      ItemResult->SetStringField(TEXT("status"), Response.bSuccess
+                                                     ? TEXT("succeeded")
+                                                     : TEXT("failed"));
+      ItemResult->SetBoolField(TEXT("success"), Response.bSuccess);
+      if (!Response.Message.IsEmpty())
+        ItemResult->SetStringField(TEXT("message"), Response.Message);
+      ItemResult->SetStringField(TEXT("error"), Response.ErrorCode);
+      if (Response.Result.IsValid())
+        ItemResult->SetObjectField(TEXT("result"), Response.Result);
+
+      if (Response.bSuccess) {
+        ++Succeeded;
+      } else {
+        ++Failed;
+        bStopped = !bContinueOnError;
+      }
+    }
+    CapturedBatchItemResponse = FAutomationBatchItemResponse();
+
+#if WITH_EDITOR
+    // A stopped batch must not leave its earlier items applied while the
+    // response reports failure: close the transaction and undo it whole.
+    if (Transaction.IsValid() && bStopped) {
+      Transaction.Reset();
+      if (GEditor && GEditor->Trans &&
+          GEditor->Trans->GetUndoCount() == 0 &&
+          GEditor->Trans->GetQueueLength() == ExpectedQueueLength) {
+        bRolledBack = GEditor->UndoTransaction(false);
+      }
+    }
+#endif
+  }
+
+  if (bRolledBack) {
+    for (const TSharedPtr<FJsonValue> &Value : ItemResults) {
+      const TSharedPtr<FJsonObject> &ItemResult = Value->AsObject();
+      if (ItemResult->GetStringField(TEXT("status")) == TEXT("succeeded")) {
+        const bool bReverted = IsTransactionalAction(
+            ItemResult->GetStringField(TEXT("action")));
+        ItemResult->SetStringField(TEXT("status"), bReverted
+                                                       ? TEXT("rolled_back")
+                                                       : TEXT("not_reverted"));
+      }
+    }
+  }
+
+  TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetArrayField(TEXT("items"), ItemResults);
+  Result->SetNumberField(TEXT("total"), Items->Num());
+  Result->SetNumberField(TEXT("succeeded"), Succeeded);
+  Result->SetNumberField(TEXT("failed"), Failed);
+  Result->SetNumberField(TEXT("pending"), Pending);
+  Result->SetNumberField(TEXT("skipped"), Skipped);
+  Result->SetStringField(TEXT("onError"), bContinueOnError ? TEXT("continue")
+                                                           : TEXT("stop"));
+  Result->SetBoolField(TEXT("transaction"), bUseTransaction);
+  // Without a rollback, items with status "succeeded" stay applied; with
+  // one, items with status "not_reverted" do.
+  Result->SetBoolField(TEXT("rolledBack"), bRolledBack);
+  Result->SetNumberField(TEXT("durationMs"),
+                         (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+  const FString Summary = FString::Printf(
+      TEXT("Batch ran %d of %d items: %d succeeded, %d failed, %d pending, %d "
+           "skipped%s"),
+      Items->Num() - Skipped, Items->Num(), Succeeded, Failed, Pending,
+      Skipped, bRolledBack ? TEXT("; transaction rolled back") : TEXT(""));
+  SendAutomationResponse(RequestingSocket, RequestId, Failed == 0, Summary,
+                         Result,
+                         Failed == 0 ? FString() : TEXT("BATCH_ITEM_FAILED"));
+  return true;
+}
@@ -465,15 +465,7 @@ bool FBlueprintCreationHandlers::HandleBlueprintCreate(
         }
       }
       if (!ResolvedParent) {
-        for (TObjectIterator<UClass> It; It; ++It) {
-          UClass *C = *It;
-          if (!C)
-            continue;
-          if (C->GetName().Equals(ParentClassSpec, ESearchCase::IgnoreCase)) {
-            ResolvedParent = C;
-            break;
-          }
-        }
+        ResolvedParent = FMcpClassIndex::Get().FindClassByShortName(ParentClassSpec);
       }
     }
   }
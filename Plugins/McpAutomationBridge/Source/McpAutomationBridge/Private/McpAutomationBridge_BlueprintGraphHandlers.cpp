@@ -2,6 +2,8 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeResponseStream.h"
 #include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
@@ -122,16 +124,13 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
   // Special case: list_node_types doesn't require a blueprint - it lists all UK2Node types globally
   if (EarlySubAction == TEXT("list_node_types")) {
     TArray<TSharedPtr<FJsonValue>> NodeTypes;
-    for (TObjectIterator<UClass> It; It; ++It) {
-      if (!It->IsChildOf(UK2Node::StaticClass()))
-        continue;
-      if (It->HasAnyClassFlags(CLASS_Abstract))
-        continue;
-
+    TArray<UClass *> NodeClasses;
+    FMcpClassIndex::GetConcreteClasses(UK2Node::StaticClass(), NodeClasses);
+    for (UClass *NodeClass : NodeClasses) {
       TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
-      TypeObj->SetStringField(TEXT("className"), It->GetName());
+      TypeObj->SetStringField(TEXT("className"), NodeClass->GetName());
       TypeObj->SetStringField(TEXT("displayName"),
-                              It->GetDisplayNameText().ToString());
+                              NodeClass->GetDisplayNameText().ToString());
       NodeTypes.Add(MakeShared<FJsonValueObject>(TypeObj));
     }
 
@@ -490,16 +489,14 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
         NamesToTry.Add(FString::Printf(TEXT("UK2Node_%s"), *TypeName));
       }
 
-      for (TObjectIterator<UClass> It; It; ++It) {
-        if (!It->IsChildOf(UEdGraphNode::StaticClass()))
-          continue;
-        if (It->HasAnyClassFlags(CLASS_Abstract))
-          continue;
-
-        FString ClassName = It->GetName();
-        for (const FString &NameToMatch : NamesToTry) {
-          if (ClassName.Equals(NameToMatch, ESearchCase::IgnoreCase)) {
-            return *It;
+      TArray<UClass *> Candidates;
+      for (const FString &NameToMatch : NamesToTry) {
+        Candidates.Reset();
+        FMcpClassIndex::Get().FindClassesByShortName(NameToMatch, Candidates);
+        for (UClass *Candidate : Candidates) {
+          if (Candidate->IsChildOf(UEdGraphNode::StaticClass()) &&
+              !Candidate->HasAnyClassFlags(CLASS_Abstract)) {
+            return Candidate;
           }
         }
       }
@@ -839,74 +836,80 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
     }
     return true;
   } else if (SubAction == TEXT("get_nodes")) {
-    TArray<TSharedPtr<FJsonValue>> NodesArray;
-
-    for (UEdGraphNode *Node : TargetGraph->Nodes) {
-      if (!Node)
-        continue;
-
-      TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
-      NodeObj->SetStringField(TEXT("nodeId"), Node->NodeGuid.ToString());
-      NodeObj->SetStringField(TEXT("nodeName"), Node->GetName());
-      NodeObj->SetStringField(TEXT("nodeType"), Node->GetClass()->GetName());
-      NodeObj->SetStringField(
-          TEXT("nodeTitle"),
-          Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-      NodeObj->SetStringField(TEXT("comment"), Node->NodeComment);
-      NodeObj->SetNumberField(TEXT("x"), Node->NodePosX);
-      NodeObj->SetNumberField(TEXT("y"), Node->NodePosY);
-
-      TArray<TSharedPtr<FJsonValue>> PinsArray;
-      for (UEdGraphPin *Pin : Node->Pins) {
-        if (!Pin)
-          continue;
-
-        TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
-        PinObj->SetStringField(TEXT("pinName"), Pin->PinName.ToString());
-        PinObj->SetStringField(TEXT("pinType"),
-                               Pin->PinType.PinCategory.ToString());
-        PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input
-                                                      ? TEXT("Input")
-                                                      : TEXT("Output"));
-
-        // Add pin sub-category object type if applicable
-        if (Pin->PinType.PinCategory == TEXT("object") ||
-            Pin->PinType.PinCategory == TEXT("class") ||
-            Pin->PinType.PinCategory == TEXT("struct")) {
-          if (Pin->PinType.PinSubCategoryObject.IsValid()) {
-            PinObj->SetStringField(
-                TEXT("pinSubType"),
-                Pin->PinType.PinSubCategoryObject->GetName());
-          }
-        }
-
-        TArray<TSharedPtr<FJsonValue>> LinkedToFileArray;
-        for (UEdGraphPin *LinkedPin : Pin->LinkedTo) {
-          if (LinkedPin && LinkedPin->GetOwningNode()) {
-            TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
-            LinkObj->SetStringField(
-                TEXT("nodeId"),
-                LinkedPin->GetOwningNode()->NodeGuid.ToString());
-            LinkObj->SetStringField(TEXT("pinName"),
-                                    LinkedPin->PinName.ToString());
-            LinkedToFileArray.Add(MakeShared<FJsonValueObject>(LinkObj));
+    // Large graphs carry thousands of nodes with all their pins and links;
+    // write them out node by node instead of building the whole tree.
+    SendAutomationResponseStreamed(
+        RequestingSocket, RequestId, TEXT("Nodes retrieved."),
+        [TargetGraph, Blueprint](FMcpJsonStreamWriter &Writer) {
+          FMcpStreamedArray Nodes(Writer, TEXT("nodes"));
+          for (UEdGraphNode *Node : TargetGraph->Nodes) {
+            if (!Node)
+              continue;
+
+            FMcpJsonStreamWriter &NodeWriter = Nodes.BeginItem();
+            NodeWriter.BeginObject();
+            NodeWriter.WriteString(TEXT("nodeId"), Node->NodeGuid.ToString());
+            NodeWriter.WriteString(TEXT("nodeName"), Node->GetName());
+            NodeWriter.WriteString(TEXT("nodeType"),
+                                   Node->GetClass()->GetName());
+            NodeWriter.WriteString(
+                TEXT("nodeTitle"),
+                Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            NodeWriter.WriteString(TEXT("comment"), Node->NodeComment);
+            NodeWriter.WriteInteger(TEXT("x"), Node->NodePosX);
+            NodeWriter.WriteInteger(TEXT("y"), Node->NodePosY);
+
+            NodeWriter.BeginArray(TEXT("pins"));
+            for (UEdGraphPin *Pin : Node->Pins) {
+              if (!Pin)
+                continue;
+
+              NodeWriter.BeginObject();
+              NodeWriter.WriteString(TEXT("pinName"), Pin->PinName.ToString());
+              NodeWriter.WriteString(TEXT("pinType"),
+                                     Pin->PinType.PinCategory.ToString());
+              NodeWriter.WriteString(TEXT("direction"),
+                                     Pin->Direction == EGPD_Input
+                                         ? TEXT("Input")
+                                         : TEXT("Output"));
+
+              // Add pin sub-category object type if applicable
+              if (Pin->PinType.PinCategory == TEXT("object") ||
+                  Pin->PinType.PinCategory == TEXT("class") ||
+                  Pin->PinType.PinCategory == TEXT("struct")) {
+                if (Pin->PinType.PinSubCategoryObject.IsValid()) {
+                  NodeWriter.WriteString(
+                      TEXT("pinSubType"),
+                      Pin->PinType.PinSubCategoryObject->GetName());
+                }
+              }
+
+              NodeWriter.BeginArray(TEXT("linkedTo"));
+              for (UEdGraphPin *LinkedPin : Pin->LinkedTo) {
+                if (LinkedPin && LinkedPin->GetOwningNode()) {
+                  NodeWriter.BeginObject();
+                  NodeWriter.WriteString(
+                      TEXT("nodeId"),
+                      LinkedPin->GetOwningNode()->NodeGuid.ToString());
+                  NodeWriter.WriteString(TEXT("pinName"),
+                                         LinkedPin->PinName.ToString());
+                  NodeWriter.EndObject();
+                }
+              }
+              NodeWriter.EndArray();
+              NodeWriter.EndObject();
+            }
+            NodeWriter.EndArray();
+            NodeWriter.EndObject();
+            Nodes.EndItem();
           }
-        }
-        PinObj->SetArrayField(TEXT("linkedTo"), LinkedToFileArray);
-        PinsArray.Add(MakeShared<FJsonValueObject>(PinObj));
-      }
-      NodeObj->SetArrayField(TEXT("pins"), PinsArray);
+          Nodes.End();
 
-      NodesArray.Add(MakeShared<FJsonValueObject>(NodeObj));
-    }
-
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetArrayField(TEXT("nodes"), NodesArray);
-    Result->SetStringField(TEXT("graphName"), TargetGraph->GetName());
-    AddAssetVerification(Result, Blueprint);
-
-    SendAutomationResponse(RequestingSocket, RequestId, true,
-                           TEXT("Nodes retrieved."), Result);
+          Writer.WriteString(TEXT("graphName"), TargetGraph->GetName());
+          TSharedPtr<FJsonObject> Verification = MakeShared<FJsonObject>();
+          AddAssetVerification(Verification, Blueprint);
+          Writer.WriteJsonObjectFields(*Verification);
+        });
     return true;
   } else if (SubAction == TEXT("break_pin_links")) {
     const FScopedTransaction Transaction(
@@ -1293,16 +1296,13 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
   } else if (SubAction == TEXT("list_node_types")) {
     // List all available UK2Node types for AI discoverability
     TArray<TSharedPtr<FJsonValue>> NodeTypes;
-    for (TObjectIterator<UClass> It; It; ++It) {
-      if (!It->IsChildOf(UK2Node::StaticClass()))
-        continue;
-      if (It->HasAnyClassFlags(CLASS_Abstract))
-        continue;
-
+    TArray<UClass *> NodeClasses;
+    FMcpClassIndex::GetConcreteClasses(UK2Node::StaticClass(), NodeClasses);
+    for (UClass *NodeClass : NodeClasses) {
       TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
-      TypeObj->SetStringField(TEXT("className"), It->GetName());
+      TypeObj->SetStringField(TEXT("className"), NodeClass->GetName());
       TypeObj->SetStringField(TEXT("displayName"),
-                              It->GetDisplayNameText().ToString());
+                              NodeClass->GetDisplayNameText().ToString());
       NodeTypes.Add(MakeShared<FJsonValueObject>(TypeObj));
     }
 
@@ -5,6 +5,10 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeActorIndex.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeListQuery.h"
+#include "McpBridgeResponseStream.h"
 #include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
@@ -86,62 +90,40 @@ AActor *UMcpAutomationBridgeSubsystem::FindActorByName(const FString &Target, bo
   if (Target.IsEmpty() || !GEditor)
     return nullptr;
 
+  // Lookups go through the per-world actor index rather than walking every
+  // actor in the level.
+  FMcpActorIndex &ActorIndex = FMcpActorIndex::Get();
+
   // Priority: PIE World if active
   if (GEditor->PlayWorld) {
-    for (TActorIterator<AActor> It(GEditor->PlayWorld); It; ++It) {
-      AActor *A = *It;
-      if (!A)
-        continue;
-      if (A->GetActorLabel().Equals(Target, ESearchCase::IgnoreCase) ||
-          A->GetName().Equals(Target, ESearchCase::IgnoreCase) ||
-          A->GetPathName().Equals(Target, ESearchCase::IgnoreCase)) {
-        return A;
-      }
+    if (AActor *A = ActorIndex.FindExact(GEditor->PlayWorld, Target)) {
+      return A;
     }
-    // If not found in PIE, do we fall back to Editor World?
-    // Probably not, because interacting with Editor world during PIE is
-    // confusing. But for "Editor subsystems" usage, we usually want Editor
-    // world. Let's fallback if not found, just in case.
-  }
-
-  UEditorActorSubsystem *ActorSS =
-      GEditor->GetEditorSubsystem<UEditorActorSubsystem>();
-  if (!ActorSS)
-    return nullptr;
-
-  TArray<AActor *> AllActors = ActorSS->GetAllLevelActors();
-  AActor *ExactMatch = nullptr;
-  TArray<AActor *> FuzzyMatches;
-
-  for (AActor *A : AllActors) {
-    if (!A)
-      continue;
-    if (A->GetActorLabel().Equals(Target, ESearchCase::IgnoreCase) ||
-        A->GetName().Equals(Target, ESearchCase::IgnoreCase) ||
-        A->GetPathName().Equals(Target, ESearchCase::IgnoreCase)) {
-      ExactMatch = A;
-      break;
+    // The editor world is not searched while PIE runs:
+    // UEditorActorSubsystem::GetAllLevelActors, which this used to go
+    // through, refuses to enumerate it then, and editing the editor world
+    // from a PIE session is confusing anyway.
+  } else if (UWorld *EditorWorld = GEditor->GetEditorWorldContext().World()) {
+    if (AActor *ExactMatch = ActorIndex.FindExact(
+            EditorWorld, Target, EMcpActorIndexKey::All,
+            ESearchCase::IgnoreCase, /*bOutlinerActorsOnly=*/true)) {
+      return ExactMatch;
     }
-    // Collect fuzzy matches ONLY if exact matching is not required
+
+    // Fuzzy (label substring) matching ONLY if exact matching is not required
     // CRITICAL FIX: Fuzzy matching can cause delete operations to delete wrong actors
     // (e.g., "TestActor_Copy" matches when searching for "TestActor")
-    if (!bExactMatchOnly && A->GetActorLabel().Contains(Target, ESearchCase::IgnoreCase)) {
-      FuzzyMatches.Add(A);
-    }
-  }
-
-  if (ExactMatch) {
-    return ExactMatch;
-  }
-
-  // If no exact match, check fuzzy matches ONLY if exact matching is not required
-  if (!bExactMatchOnly) {
-    if (FuzzyMatches.Num() == 1) {
-      return FuzzyMatches[0];
-    } else if (FuzzyMatches.Num() > 1) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("FindActorByName: Ambiguous match for '%s'. Found %d matches."),
-             *Target, FuzzyMatches.Num());
+    if (!bExactMatchOnly) {
+      TArray<AActor *> FuzzyMatches;
+      const int32 NumFuzzyMatches = ActorIndex.FindLabelsContaining(
+          EditorWorld, Target, /*bOutlinerActorsOnly=*/true, FuzzyMatches, 1);
+      if (NumFuzzyMatches == 1) {
+        return FuzzyMatches[0];
+      } else if (NumFuzzyMatches > 1) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("FindActorByName: Ambiguous match for '%s'. Found %d matches."),
+               *Target, NumFuzzyMatches);
+      }
     }
   }
 
@@ -2110,38 +2092,80 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorFindByClass(
     }
   }
 
-  TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-  TArray<TSharedPtr<FJsonValue>> ActorsArray;
-
-  if (UWorld* World = GEditor->GetEditorWorldContext().World()) {
-    UClass* ClassToFind = nullptr;
+  static const TCHAR *const FindByClassFields[] = {TEXT("name"), TEXT("path")};
+  FMcpListQuery Query;
+  FString QueryErrorCode;
+  FString QueryError;
+  if (!Query.Parse(Payload, FindByClassFields,
+                   FString::Printf(TEXT("find_by_class|%s"), *ClassName), 0,
+                   QueryErrorCode, QueryError)) {
+    SendStandardErrorResponse(this, Socket, RequestId, QueryErrorCode,
+                              QueryError, nullptr);
+    return true;
+  }
 
+  UWorld* World = GEditor->GetEditorWorldContext().World();
+  UClass* ClassToFind = nullptr;
+  if (World) {
     // CRITICAL FIX: Use ResolveClassByName for proper engine class resolution
     // This handles: full paths, short names like "StaticMeshActor", and loads classes if needed
     // Without this, FindObject only finds already-loaded classes, missing engine classes like
     // AStaticMeshActor, APawn, etc. that haven't been accessed yet
     ClassToFind = ResolveClassByName(ClassName);
-
-    if (ClassToFind) {
-      for (TActorIterator<AActor> It(World, ClassToFind); It; ++It) {
-        if (AActor* Actor = *It) {
-          TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-          ActorObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
-          ActorObj->SetStringField(TEXT("path"), Actor->GetPathName());
-          ActorsArray.Add(MakeShared<FJsonValueObject>(ActorObj));
-        }
-      }
-    } else {
+    if (!ClassToFind) {
       // Class not found - return empty result (this is valid for searches)
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("HandleControlActorFindByClass: Class '%s' not found"), *ClassName);
     }
   }
 
-  Data->SetArrayField(TEXT("actors"), ActorsArray);
-  Data->SetNumberField(TEXT("count"), ActorsArray.Num());
-  SendStandardSuccessResponse(this, Socket, RequestId,
-                              FString::Printf(TEXT("Found %d actors"), ActorsArray.Num()), Data);
+  // Same shape as SendStandardSuccessResponse, written straight to the send
+  // buffer. The message carries the count, so the actors are collected first.
+  TArray<AActor*> Matches;
+  int32 NextPosition = INDEX_NONE;
+  if (World && ClassToFind) {
+    // The actor iterator cannot seek, so a cursor skips the positions the
+    // previous pages already returned.
+    int32 Position = 0;
+    for (TActorIterator<AActor> It(World, ClassToFind); It; ++It, ++Position) {
+      if (Position < Query.GetStart())
+        continue;
+      if (Query.IsPageFull(Matches.Num())) {
+        NextPosition = Position;
+        break;
+      }
+      if (AActor* Actor = *It)
+        Matches.Add(Actor);
+    }
+  }
+
+  SendAutomationResponseStreamed(
+      Socket, RequestId,
+      FString::Printf(TEXT("Found %d actors"), Matches.Num()),
+      [&Matches, &Query, NextPosition](FMcpJsonStreamWriter &Writer) {
+        const bool bWantName = Query.WantsField(TEXT("name"));
+        const bool bWantPath = Query.WantsField(TEXT("path"));
+
+        Writer.WriteBool(TEXT("success"), true);
+        Writer.BeginObject(TEXT("data"));
+        FMcpStreamedArray Actors(Writer, TEXT("data.actors"));
+        for (AActor* Actor : Matches) {
+          FMcpJsonStreamWriter &Item = Actors.BeginItem();
+          Item.BeginObject();
+          if (bWantName)
+            Item.WriteString(TEXT("name"), Actor->GetActorLabel());
+          if (bWantPath)
+            Item.WriteString(TEXT("path"), Actor->GetPathName());
+          Item.EndObject();
+          Actors.EndItem();
+        }
+        Writer.WriteInteger(TEXT("count"), Actors.End());
+        Query.WritePageInfo(Writer, NextPosition);
+        Writer.EndObject();
+        Writer.BeginArray(TEXT("warnings"));
+        Writer.EndArray();
+        Writer.WriteNull(TEXT("error"));
+      });
   return true;
 #else
   return false;
@@ -4023,34 +4047,79 @@ bool UMcpAutomationBridgeSubsystem::HandleControlActorList(
     return true;
   }
 
-  const TArray<AActor *> &AllActors = ActorSS->GetAllLevelActors();
-  TArray<TSharedPtr<FJsonValue>> ActorsArray;
-
-  for (AActor *Actor : AllActors) {
-    if (!Actor)
-      continue;
-    const FString Label = Actor->GetActorLabel();
-    const FString Name = Actor->GetName();
-    if (!Filter.IsEmpty() && !Label.Contains(Filter) && !Name.Contains(Filter))
-      continue;
-
-    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
-    Entry->SetStringField(TEXT("label"), Label);
-    Entry->SetStringField(TEXT("name"), Name);
-    Entry->SetStringField(TEXT("path"), Actor->GetPathName());
-    Entry->SetStringField(TEXT("class"), Actor->GetClass()
-                                             ? Actor->GetClass()->GetPathName()
-                                             : TEXT(""));
-    ActorsArray.Add(MakeShared<FJsonValueObject>(Entry));
+  static const TCHAR *const ActorListFields[] = {TEXT("label"), TEXT("name"),
+                                                 TEXT("path"), TEXT("class")};
+  FMcpListQuery Query;
+  FString QueryErrorCode;
+  FString QueryError;
+  if (!Query.Parse(Payload, ActorListFields,
+                   FString::Printf(TEXT("list_actors|%s"), *Filter), 0,
+                   QueryErrorCode, QueryError)) {
+    SendStandardErrorResponse(this, Socket, RequestId, QueryErrorCode,
+                              QueryError, nullptr);
+    return true;
   }
 
-  TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
-  Data->SetArrayField(TEXT("actors"), ActorsArray);
-  Data->SetNumberField(TEXT("count"), ActorsArray.Num());
-  if (!Filter.IsEmpty())
-    Data->SetStringField(TEXT("filter"), Filter);
-  SendStandardSuccessResponse(this, Socket, RequestId, TEXT("Actors listed"),
-                              Data);
+  const TArray<AActor *> &AllActors = ActorSS->GetAllLevelActors();
+
+  // Large maps produce tens of thousands of entries, so the result is
+  // streamed into the send buffer rather than built as a JSON tree. The
+  // shape matches SendStandardSuccessResponse.
+  SendAutomationResponseStreamed(
+      Socket, RequestId, TEXT("Actors listed"),
+      [&AllActors, &Filter, &Query](FMcpJsonStreamWriter &Writer) {
+        const bool bWantLabel = Query.WantsField(TEXT("label"));
+        const bool bWantName = Query.WantsField(TEXT("name"));
+        const bool bWantPath = Query.WantsField(TEXT("path"));
+        const bool bWantClass = Query.WantsField(TEXT("class"));
+
+        Writer.WriteBool(TEXT("success"), true);
+        Writer.BeginObject(TEXT("data"));
+        FMcpStreamedArray Actors(Writer, TEXT("data.actors"));
+        int32 Position = Query.GetStart();
+        for (; Position < AllActors.Num(); ++Position) {
+          if (Query.IsPageFull(Actors.Num()))
+            break;
+          AActor *Actor = AllActors[Position];
+          if (!Actor)
+            continue;
+          // Labels and names are only built when filtered on or returned.
+          FString Label;
+          FString Name;
+          if (bWantLabel || !Filter.IsEmpty())
+            Label = Actor->GetActorLabel();
+          if (bWantName || !Filter.IsEmpty())
+            Name = Actor->GetName();
+          if (!Filter.IsEmpty() && !Label.Contains(Filter) &&
+              !Name.Contains(Filter))
+            continue;
+
+          FMcpJsonStreamWriter &Item = Actors.BeginItem();
+          Item.BeginObject();
+          if (bWantLabel)
+            Item.WriteString(TEXT("label"), Label);
+          if (bWantName)
+            Item.WriteString(TEXT("name"), Name);
+          if (bWantPath)
+            Item.WriteString(TEXT("path"), Actor->GetPathName());
+          if (bWantClass)
+            Item.WriteString(TEXT("class"),
+                             Actor->GetClass()
+                                 ? Actor->GetClass()->GetPathName()
+                                 : FString());
+          Item.EndObject();
+          Actors.EndItem();
+        }
+        Writer.WriteInteger(TEXT("count"), Actors.End());
+        Query.WritePageInfo(Writer, Position < AllActors.Num() ? Position
+                                                               : INDEX_NONE);
+        if (!Filter.IsEmpty())
+          Writer.WriteString(TEXT("filter"), Filter);
+        Writer.EndObject();
+        Writer.BeginArray(TEXT("warnings"));
+        Writer.EndArray();
+        Writer.WriteNull(TEXT("error"));
+      });
   return true;
 #else
   return false;
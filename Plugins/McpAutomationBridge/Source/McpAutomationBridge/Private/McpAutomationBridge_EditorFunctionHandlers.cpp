@@ -865,14 +865,12 @@ bool UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction(
 
     // Quick factory lookup by short name if full resolution failed
     if (!FactoryUClass) {
-      for (TObjectIterator<UClass> It; It; ++It) {
-        if (It->GetName().Equals(FactoryClass) ||
-            It->GetName().Equals(FactoryClass + TEXT("Factory"))) {
-          if (It->IsChildOf(UFactory::StaticClass())) {
-            FactoryUClass = *It;
-            break;
-          }
-        }
+      FMcpClassIndex &ClassIndex = FMcpClassIndex::Get();
+      FactoryUClass = ClassIndex.FindClassByShortName(
+          FactoryClass, UFactory::StaticClass());
+      if (!FactoryUClass) {
+        FactoryUClass = ClassIndex.FindClassByShortName(
+            FactoryClass + TEXT("Factory"), UFactory::StaticClass());
       }
     }
 
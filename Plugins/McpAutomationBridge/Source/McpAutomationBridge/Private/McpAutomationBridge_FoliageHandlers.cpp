@@ -2,6 +2,8 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeResponseStream.h"
 
 #if WITH_EDITOR
 #include "EditorAssetLibrary.h"
@@ -432,8 +434,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
     return true;
   }
 
-  TArray<TSharedPtr<FJsonValue>> InstancesArray;
-
+  UFoliageType *FoliageType = nullptr;
   if (!FoliageTypePath.IsEmpty()) {
     if (!UEditorAssetLibrary::DoesAssetExist(FoliageTypePath)) {
       // If asked for a specific type that doesn't exist, return empty list
@@ -447,48 +448,56 @@ bool UMcpAutomationBridgeSubsystem::HandleGetFoliageInstances(
       return true;
     }
 
-    UFoliageType *FoliageType =
-        LoadObject<UFoliageType>(nullptr, *FoliageTypePath);
-    if (FoliageType) {
-      FFoliageInfo *Info = IFA->FindInfo(FoliageType);
-      if (Info) {
-        for (const FFoliageInstance &Inst : Info->Instances) {
-          TSharedPtr<FJsonObject> InstObj = MakeShared<FJsonObject>();
-          InstObj->SetNumberField(TEXT("x"), Inst.Location.X);
-          InstObj->SetNumberField(TEXT("y"), Inst.Location.Y);
-          InstObj->SetNumberField(TEXT("z"), Inst.Location.Z);
-          InstObj->SetNumberField(TEXT("pitch"), Inst.Rotation.Pitch);
-          InstObj->SetNumberField(TEXT("yaw"), Inst.Rotation.Yaw);
-          InstObj->SetNumberField(TEXT("roll"), Inst.Rotation.Roll);
-          InstancesArray.Add(MakeShared<FJsonValueObject>(InstObj));
-        }
-      }
-    }
-  } else {
-    IFA->ForEachFoliageInfo([&](UFoliageType *Type, FFoliageInfo &Info) {
-      for (const FFoliageInstance &Inst : Info.Instances) {
-        TSharedPtr<FJsonObject> InstObj = MakeShared<FJsonObject>();
-        InstObj->SetStringField(TEXT("foliageType"), Type->GetPathName());
-        InstObj->SetNumberField(TEXT("x"), Inst.Location.X);
-        InstObj->SetNumberField(TEXT("y"), Inst.Location.Y);
-        InstObj->SetNumberField(TEXT("z"), Inst.Location.Z);
-        InstancesArray.Add(MakeShared<FJsonValueObject>(InstObj));
-      }
-      return true;
-    });
+    FoliageType = LoadObject<UFoliageType>(nullptr, *FoliageTypePath);
   }
 
-  TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
-  Resp->SetBoolField(TEXT("success"), true);
-  Resp->SetArrayField(TEXT("instances"), InstancesArray);
-  Resp->SetNumberField(TEXT("count"), InstancesArray.Num());
-  
-  // Add verification data
-  Resp->SetStringField(TEXT("foliageActorPath"), IFA->GetPathName());
-  Resp->SetBoolField(TEXT("existsAfter"), true);
+  // Instance lists can run into the hundreds of thousands, so they are
+  // streamed (and chunked for clients that negotiated it) rather than built
+  // as a JSON tree.
+  SendAutomationResponseStreamed(
+      RequestingSocket, RequestId, TEXT("Foliage instances retrieved"),
+      [&](FMcpJsonStreamWriter &Writer) {
+        Writer.WriteBool(TEXT("success"), true);
+        FMcpStreamedArray Instances(Writer, TEXT("instances"));
+        if (!FoliageTypePath.IsEmpty()) {
+          const FFoliageInfo *Info =
+              FoliageType ? IFA->FindInfo(FoliageType) : nullptr;
+          if (Info) {
+            for (const FFoliageInstance &Inst : Info->Instances) {
+              FMcpJsonStreamWriter &Item = Instances.BeginItem();
+              Item.BeginObject();
+              Item.WriteNumber(TEXT("x"), Inst.Location.X);
+              Item.WriteNumber(TEXT("y"), Inst.Location.Y);
+              Item.WriteNumber(TEXT("z"), Inst.Location.Z);
+              Item.WriteNumber(TEXT("pitch"), Inst.Rotation.Pitch);
+              Item.WriteNumber(TEXT("yaw"), Inst.Rotation.Yaw);
+              Item.WriteNumber(TEXT("roll"), Inst.Rotation.Roll);
+              Item.EndObject();
+              Instances.EndItem();
+            }
+          }
+        } else {
+          IFA->ForEachFoliageInfo([&](UFoliageType *Type, FFoliageInfo &Info) {
+            const FString TypePath = Type->GetPathName();
+            for (const FFoliageInstance &Inst : Info.Instances) {
+              FMcpJsonStreamWriter &Item = Instances.BeginItem();
+              Item.BeginObject();
+              Item.WriteString(TEXT("foliageType"), TypePath);
+              Item.WriteNumber(TEXT("x"), Inst.Location.X);
+              Item.WriteNumber(TEXT("y"), Inst.Location.Y);
+              Item.WriteNumber(TEXT("z"), Inst.Location.Z);
+              Item.EndObject();
+              Instances.EndItem();
+            }
+            return true;
+          });
+        }
+        Writer.WriteInteger(TEXT("count"), Instances.End());
 
-  SendAutomationResponse(RequestingSocket, RequestId, true,
-                         TEXT("Foliage instances retrieved"), Resp, FString());
+        // Add verification data
+        Writer.WriteString(TEXT("foliageActorPath"), IFA->GetPathName());
+        Writer.WriteBool(TEXT("existsAfter"), true);
+      });
   return true;
 #else
   SendAutomationResponse(RequestingSocket, RequestId, false,
@@ -2,6 +2,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpBridgeTrace.h"
 
 bool UMcpAutomationBridgeSubsystem::HandleInsightsAction(const FString& RequestId, const FString& Action, const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
 {
@@ -34,12 +35,34 @@ bool UMcpAutomationBridgeSubsystem::HandleInsightsAction(const FString& RequestI
         {
              GEngine->Exec(nullptr, TEXT("Trace.Start"));
         }
+
+        // Bridge request scopes and events go on their own channel so a
+        // capture of an agent session shows which request the editor was
+        // busy with.
+        bool bBridgeChannel = false;
+#if MCP_BRIDGE_TRACE_ENABLED
+        if (GetJsonBoolField(Payload, TEXT("includeBridgeChannel"), true))
+        {
+            bBridgeChannel = UE::Trace::ToggleChannel(MCP_BRIDGE_TRACE_CHANNEL_NAME, true);
+        }
+#endif
+        Result->SetBoolField(TEXT("bridgeChannel"), bBridgeChannel);
         Result->SetStringField(TEXT("action"), TEXT("start_trace"));
         Result->SetStringField(TEXT("status"), TEXT("started"));
         SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Trace session started."), Result);
         return true;
     }
 
+    if (SubAction == TEXT("stop_session"))
+    {
+        GEngine->Exec(nullptr, TEXT("Trace.Stop"));
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("action"), TEXT("stop_trace"));
+        Result->SetStringField(TEXT("status"), TEXT("stopped"));
+        SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Trace session stopped."), Result);
+        return true;
+    }
+
     SendAutomationError(RequestingSocket, RequestId, TEXT("Unknown subAction."), TEXT("INVALID_SUBACTION"));
     return true;
 }
@@ -2,6 +2,9 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeListQuery.h"
+#include "McpBridgeResponseStream.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -2079,19 +2082,52 @@ TSharedPtr<FJsonObject> Resp = MakeShared<FJsonObject>();
       return true;
     }
     
-    TArray<TSharedPtr<FJsonValue>> ActorsArray;
-    for (AActor* Actor : TargetLevel->Actors) {
-      if (Actor) {
-        ActorsArray.Add(MakeShared<FJsonValueString>(Actor->GetName()));
-      }
+    const FString ResolvedLevelPath = TargetLevel->GetOutermost() ? TargetLevel->GetOutermost()->GetName() : TEXT("");
+
+    // Without "fields" each actor is its name, as before; with it, each actor
+    // becomes an object holding just the requested fields.
+    static const TCHAR* const LevelActorFields[] = {TEXT("name"), TEXT("path"), TEXT("class")};
+    FMcpListQuery Query;
+    FString QueryErrorCode;
+    FString QueryError;
+    if (!Query.Parse(Payload, LevelActorFields, FString::Printf(TEXT("get_level_actors|%s"), *ResolvedLevelPath), 0,
+                     QueryErrorCode, QueryError)) {
+      SendAutomationResponse(RequestingSocket, RequestId, false, QueryError, nullptr, QueryErrorCode);
+      return true;
     }
-    
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("levelPath"), TargetLevel->GetOutermost() ? TargetLevel->GetOutermost()->GetName() : TEXT(""));
-    Result->SetNumberField(TEXT("count"), ActorsArray.Num());
-    Result->SetArrayField(TEXT("actors"), ActorsArray);
-    
-    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Level actors retrieved"), Result);
+
+    SendAutomationResponseStreamed(
+        RequestingSocket, RequestId, TEXT("Level actors retrieved"),
+        [TargetLevel, &ResolvedLevelPath, &Query](FMcpJsonStreamWriter& Writer) {
+          const bool bObjects = Query.HasFieldSelection();
+          const bool bWantName = Query.WantsField(TEXT("name"));
+          const bool bWantPath = Query.WantsField(TEXT("path"));
+          const bool bWantClass = Query.WantsField(TEXT("class"));
+          const auto& LevelActors = TargetLevel->Actors;
+
+          Writer.WriteString(TEXT("levelPath"), ResolvedLevelPath);
+          FMcpStreamedArray Actors(Writer, TEXT("actors"));
+          int32 Position = Query.GetStart();
+          for (; Position < LevelActors.Num(); ++Position) {
+            if (Query.IsPageFull(Actors.Num())) break;
+            AActor* Actor = LevelActors[Position];
+            if (!Actor) continue;
+
+            FMcpJsonStreamWriter& Item = Actors.BeginItem();
+            if (!bObjects) {
+              Item.WriteString(Actor->GetName());
+            } else {
+              Item.BeginObject();
+              if (bWantName) Item.WriteString(TEXT("name"), Actor->GetName());
+              if (bWantPath) Item.WriteString(TEXT("path"), Actor->GetPathName());
+              if (bWantClass) Item.WriteString(TEXT("class"), Actor->GetClass()->GetPathName());
+              Item.EndObject();
+            }
+            Actors.EndItem();
+          }
+          Writer.WriteInteger(TEXT("count"), Actors.End());
+          Query.WritePageInfo(Writer, Position < LevelActors.Num() ? Position : INDEX_NONE);
+        });
     return true;
   }
   if (EffectiveAction == TEXT("get_level_bounds")) {
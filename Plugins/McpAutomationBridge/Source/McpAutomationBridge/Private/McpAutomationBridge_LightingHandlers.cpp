@@ -89,12 +89,12 @@ bool UMcpAutomationBridgeSubsystem::HandleLightingAction(
     AddedNames.Add(TEXT("SpotLight"));
     AddedNames.Add(TEXT("RectLight"));
 
-    for (TObjectIterator<UClass> It; It; ++It) {
-      if (It->IsChildOf(ALight::StaticClass()) &&
-          !It->HasAnyClassFlags(CLASS_Abstract) &&
-          !AddedNames.Contains(It->GetName())) {
-        Types.Add(MakeShared<FJsonValueString>(It->GetName()));
-        AddedNames.Add(It->GetName());
+    TArray<UClass *> LightClasses;
+    FMcpClassIndex::GetConcreteClasses(ALight::StaticClass(), LightClasses);
+    for (UClass *LightClass : LightClasses) {
+      if (!AddedNames.Contains(LightClass->GetName())) {
+        Types.Add(MakeShared<FJsonValueString>(LightClass->GetName()));
+        AddedNames.Add(LightClass->GetName());
       }
     }
 
@@ -2,95 +2,50 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
-#include "Misc/OutputDevice.h"
-#include "Async/Async.h"
+#include "McpAutomationBridgeSettings.h"
+#include "McpBridgeLogStream.h"
 
-// Define a custom output device to capture logs and stream them via the bridge
-class FMcpLogOutputDevice : public FOutputDevice
+namespace
 {
-public:
-    FMcpLogOutputDevice(UMcpAutomationBridgeSubsystem* InSubsystem) 
-        : Subsystem(InSubsystem) 
+    // Reads a string array field as a set of log category names.
+    TSet<FName> McpReadLogCategories(const TSharedPtr<FJsonObject>& Payload, const TCHAR* Field)
     {
-    }
-
-    virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category) override
-    {
-        if (!Subsystem || !Subsystem->IsValidLowLevel())
-        {
-            return;
-        }
-
-        // Filter out very verbose logs if needed, but for now allow all
-        // Prevent infinite recursion if our own logging causes more logging
-        // Filter out highly verbose categories that clutter test output
-        // Use string comparison to be robust against FName issues
-        FString CategoryStr = Category.ToString();
-
-        if (Category == LogMcpAutomationBridgeSubsystem.GetCategoryName() ||
-            CategoryStr == TEXT("LogRHI") ||
-            CategoryStr == TEXT("LogEOSSDK") ||
-            CategoryStr == TEXT("LogCsvProfiler"))
-        {
-            return; 
-        }
-
-        // Filter specific noisy warnings
-        if (Verbosity == ELogVerbosity::Warning && CategoryStr == TEXT("LogSlateStyle"))
+        TSet<FName> Categories;
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (Payload->TryGetArrayField(Field, Values) && Values)
         {
-            // "Missing Resource from 'ProfileVisualizerStyle'" is a known engine warning during 'show collision'
-            if (FString(V).Contains(TEXT("Missing Resource from 'ProfileVisualizerStyle'")))
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
             {
-                return;
+                if (Value.IsValid() && Value->Type == EJson::String && !Value->AsString().IsEmpty())
+                {
+                    Categories.Add(FName(*Value->AsString()));
+                }
             }
         }
+        return Categories;
+    }
 
-        if (CategoryStr == TEXT("LogStats")) 
-        {
-             // "There is no thread with id" is noise during stat commands
-             if (FString(V).Contains(TEXT("There is no thread with id")))
-             {
-                 return;
-             }
-        }
-
-        FString VerbosityString;
-        switch (Verbosity)
+    TArray<TSharedPtr<FJsonValue>> McpLogCategoriesToJson(const TSet<FName>& Categories)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (const FName& Category : Categories)
         {
-            case ELogVerbosity::Fatal: VerbosityString = TEXT("Fatal"); break;
-            case ELogVerbosity::Error: VerbosityString = TEXT("Error"); break;
-            case ELogVerbosity::Warning: VerbosityString = TEXT("Warning"); break;
-            case ELogVerbosity::Display: VerbosityString = TEXT("Display"); break;
-            case ELogVerbosity::Log: VerbosityString = TEXT("Log"); break;
-            case ELogVerbosity::Verbose: VerbosityString = TEXT("Verbose"); break;
-            case ELogVerbosity::VeryVerbose: VerbosityString = TEXT("VeryVerbose"); break;
-            default: VerbosityString = TEXT("Log"); break;
+            Values.Add(MakeShared<FJsonValueString>(Category.ToString()));
         }
-
-        FString Message = FString(V);
-        FString CategoryString = Category.ToString();
-
-        // Dispatch to game thread to ensure safe socket sending if not already there
-        // Actually, SendRawMessage might be thread safe, but let's be safe.
-        // Copy data for lambda capture
-        const FString PayloadJson = FString::Printf(TEXT("{\"event\":\"log\",\"category\":\"%s\",\"verbosity\":\"%s\",\"message\":\"%s\"}"), 
-            *CategoryString, *VerbosityString, *Message.ReplaceCharWithEscapedChar());
-
-        // Use a weak pointer to the subsystem to avoid crashing if it's destroyed
-        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSubsystem(Subsystem);
-
-        AsyncTask(ENamedThreads::GameThread, [WeakSubsystem, PayloadJson]()
-        {
-            if (UMcpAutomationBridgeSubsystem* StrongSubsystem = WeakSubsystem.Get())
-            {
-               StrongSubsystem->SendRawMessage(PayloadJson);
-            }
-        });
+        return Values;
     }
+}
 
-private:
-    UMcpAutomationBridgeSubsystem* Subsystem;
-};
+void UMcpAutomationBridgeSubsystem::RemoveLogSubscriber(const TSharedPtr<FMcpBridgeWebSocket>& Socket)
+{
+    // Capture stops once the last subscriber has left.
+    if (LogCaptureDevice.IsValid() && LogCaptureDevice->RemoveSubscriber(Socket) == 0)
+    {
+        GLog->RemoveOutputDevice(LogCaptureDevice.Get());
+        LogCaptureDevice.Reset();
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming disabled: no subscribers left."));
+    }
+}
 
 bool UMcpAutomationBridgeSubsystem::HandleLogAction(const FString& RequestId, const FString& Action, const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
 {
@@ -109,27 +64,84 @@ bool UMcpAutomationBridgeSubsystem::HandleLogAction(const FString& RequestId, co
 
     if (SubAction == TEXT("subscribe"))
     {
+        if (!RequestingSocket.IsValid())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Log streaming needs a client connection."), TEXT("NO_CONNECTION"));
+            return true;
+        }
+
+        // Category and verbosity filters are checked for every log line
+        // before anything is copied, so a subscriber that only wants a few
+        // categories costs little. messagePattern is matched later, on the
+        // log stream's drain thread.
+        FMcpLogFilter Filter;
+        Filter.Categories = McpReadLogCategories(Payload, TEXT("categories"));
+        Filter.ExcludedCategories = McpReadLogCategories(Payload, TEXT("excludeCategories"));
+
+        FString MinVerbosity;
+        if (Payload->TryGetStringField(TEXT("minVerbosity"), MinVerbosity) && !MinVerbosity.IsEmpty() &&
+            !FMcpLogStream::ParseVerbosity(MinVerbosity, Filter.MaxVerbosity))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("Unknown minVerbosity '%s'. Expected Fatal, Error, Warning, Display, Log, Verbose or VeryVerbose."), *MinVerbosity),
+                TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        FString MessagePattern;
+        if (Payload->TryGetStringField(TEXT("messagePattern"), MessagePattern) && !MessagePattern.IsEmpty())
+        {
+            // FRegexPattern compiles a bad pattern into one that never
+            // matches, so the client would just stop receiving lines.
+            FString PatternError;
+            if (!FMcpLogStream::ValidateMessagePattern(MessagePattern, PatternError))
+            {
+                SendAutomationError(RequestingSocket, RequestId, PatternError, TEXT("INVALID_ARGUMENT"));
+                return true;
+            }
+            Filter.MessagePattern.Emplace(MessagePattern);
+        }
+
         if (!LogCaptureDevice.IsValid())
         {
-            LogCaptureDevice = MakeShared<FMcpLogOutputDevice>(this);
+            const UMcpAutomationBridgeSettings* Settings = GetDefault<UMcpAutomationBridgeSettings>();
+            TSharedPtr<FMcpLogStream> Stream = MakeShared<FMcpLogStream>(
+                Settings ? Settings->LogBatchIntervalMs : 100,
+                Settings ? Settings->LogBatchMaxRecords : 256);
+            if (!Stream->IsRunning())
+            {
+                SendAutomationError(RequestingSocket, RequestId, TEXT("Failed to start the log streaming thread."), TEXT("LOG_STREAM_UNAVAILABLE"));
+                return true;
+            }
+            LogCaptureDevice = Stream;
             GLog->AddOutputDevice(LogCaptureDevice.Get());
             UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming enabled by client request."));
         }
+        if (!LogCaptureDevice->AddSubscriber(RequestingSocket, Filter))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("Log streaming is limited to %d subscribed connections."), FMcpLogStream::MaxSubscribers),
+                TEXT("TOO_MANY_SUBSCRIBERS"));
+            return true;
+        }
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
         Result->SetStringField(TEXT("action"), TEXT("subscribe"));
         Result->SetBoolField(TEXT("subscribed"), true);
+        Result->SetStringField(TEXT("event"), TEXT("log_batch"));
+        Result->SetArrayField(TEXT("categories"), McpLogCategoriesToJson(Filter.Categories));
+        Result->SetArrayField(TEXT("excludeCategories"), McpLogCategoriesToJson(Filter.ExcludedCategories));
+        Result->SetStringField(TEXT("minVerbosity"), ::ToString(Filter.MaxVerbosity));
+        if (!MessagePattern.IsEmpty())
+        {
+            Result->SetStringField(TEXT("messagePattern"), MessagePattern);
+        }
         SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Subscribed to editor logs."), Result);
         return true;
     }
     else if (SubAction == TEXT("unsubscribe"))
     {
-        if (LogCaptureDevice.IsValid())
-        {
-            GLog->RemoveOutputDevice(LogCaptureDevice.Get());
-            LogCaptureDevice.Reset();
-            UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("Log streaming disabled by client request."));
-        }
+        RemoveLogSubscriber(RequestingSocket);
 
         TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
         Result->SetStringField(TEXT("action"), TEXT("unsubscribe"));
@@ -13,6 +13,7 @@
 
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpBridgeActorIndex.h"
 #include "McpBridgeWebSocket.h"
 #include "Misc/EngineVersionComparison.h"
 
@@ -123,17 +124,7 @@ namespace NetworkingHelpers
     // Find actor by name in world
     AActor* FindActorByName(UWorld* World, const FString& ActorName)
     {
-        if (!World) return nullptr;
-        
-        for (TActorIterator<AActor> It(World); It; ++It)
-        {
-            AActor* Actor = *It;
-            if (Actor && Actor->GetName() == ActorName)
-            {
-                return Actor;
-            }
-        }
-        return nullptr;
+        return FMcpActorIndex::Get().FindExact(World, ActorName, EMcpActorIndexKey::Name);
     }
 
     // Get replication condition from string
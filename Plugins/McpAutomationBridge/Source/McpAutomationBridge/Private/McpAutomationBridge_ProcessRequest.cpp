@@ -4,6 +4,7 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeTrace.h"
 #include "McpConnectionManager.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
@@ -34,20 +35,23 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
          *RequestId, *Action,
          ConnectionManager.IsValid() ? ConnectionManager->GetActiveSocketCount()
                                      : 0,
-         PendingAutomationRequests.Num());
+         NumPendingAutomationRequests.Load());
+
+  auto MakePending = [&]() {
+    FPendingAutomationRequest Pending;
+    Pending.RequestId = RequestId;
+    Pending.Action = Action;
+    Pending.Payload = Payload;
+    Pending.RequestingSocket = RequestingSocket;
+    return Pending;
+  };
+
   if (!IsInGameThread()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
            TEXT("Scheduling ProcessAutomationRequest on GameThread: "
                 "RequestId=%s action=%s"),
            *RequestId, *Action);
-    AsyncTask(ENamedThreads::GameThread,
-              [WeakThis = TWeakObjectPtr<UMcpAutomationBridgeSubsystem>(this),
-               RequestId, Action, Payload, RequestingSocket]() {
-                if (UMcpAutomationBridgeSubsystem *Pinned = WeakThis.Get()) {
-                  Pinned->ProcessAutomationRequest(RequestId, Action, Payload,
-                                                   RequestingSocket);
-                }
-              });
+    EnqueuePendingAutomationRequest(MakePending());
     return;
   }
 
@@ -59,17 +63,14 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
            TEXT("Deferring ProcessAutomationRequest due to active "
                 "Serialization/GC/Loading: RequestId=%s Action=%s"),
            *RequestId, *Action);
-
-    FPendingAutomationRequest P;
-    P.RequestId = RequestId;
-    P.Action = Action;
-    P.Payload = Payload;
-    P.RequestingSocket = RequestingSocket;
-    {
-      FScopeLock Lock(&PendingAutomationRequestsMutex);
-      PendingAutomationRequests.Add(MoveTemp(P));
-      bPendingRequestsScheduled = true;
+    if (GIsSavingPackage) {
+      ++NumDeferredForSaving;
+    } else if (IsGarbageCollecting()) {
+      ++NumDeferredForGarbageCollection;
+    } else {
+      ++NumDeferredForAsyncLoading;
     }
+    EnqueuePendingAutomationRequest(MakePending());
     return;
   }
 
@@ -79,24 +80,9 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
          *RequestId, *Action,
          bProcessingAutomationRequest ? TEXT("true") : TEXT("false"));
 
-  const FString LowerAction = Action.ToLower();
-
-  if (ConnectionManager.IsValid()) {
-    ConnectionManager->StartRequestTelemetry(RequestId, Action);
-  }
-
   // Reentrancy guard / enqueue
   if (bProcessingAutomationRequest) {
-    FPendingAutomationRequest P;
-    P.RequestId = RequestId;
-    P.Action = Action;
-    P.Payload = Payload;
-    P.RequestingSocket = RequestingSocket;
-    {
-      FScopeLock Lock(&PendingAutomationRequestsMutex);
-      PendingAutomationRequests.Add(MoveTemp(P));
-      bPendingRequestsScheduled = true;
-    }
+    EnqueuePendingAutomationRequest(MakePending());
     UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
            TEXT("Enqueued automation request %s for action %s (processing in "
                 "progress)."),
@@ -104,20 +90,18 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
     return;
   }
 
+  // Ends the request's queue wait.
+  if (ConnectionManager.IsValid()) {
+    ConnectionManager->StartRequestTelemetry(RequestingSocket.Get(), RequestId,
+                                             Action);
+  }
+  McpTraceRequestDispatched(RequestId, Action);
+
   bProcessingAutomationRequest = true;
   bool bDispatchHandled = false;
   FString ConsumedHandlerLabel = TEXT("unknown-handler");
   const double DispatchStartSeconds = FPlatformTime::Seconds();
 
-  auto HandleAndLog = [&](const TCHAR *HandlerLabel, auto &&Callable) -> bool {
-    const bool bResult = Callable();
-    if (bResult) {
-      bDispatchHandled = true;
-      ConsumedHandlerLabel = HandlerLabel;
-    }
-    return bResult;
-  };
-
   {
     ON_SCOPE_EXIT {
       bProcessingAutomationRequest = false;
@@ -136,13 +120,19 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
                *RequestId, *Action, DurationMs);
       }
 
-      if (bPendingRequestsScheduled) {
-        bPendingRequestsScheduled = false;
-        ProcessPendingAutomationRequests();
+      // Never drained inline: this may itself be running from a drain, and
+      // draining here would recurse once per queued request. Requests
+      // queued by the handler already scheduled a drain for the next tick;
+      // this only makes sure one is pending.
+      if (NumPendingAutomationRequests > 0) {
+        SchedulePendingAutomationDrain();
       }
     };
 
     try {
+      MCP_TRACE_SCOPE("McpBridge.Dispatch");
+      MCP_TRACE_SCOPE_TEXT(*Action);
+
       // Map this requestId to the requesting socket so responses can be
       // delivered reliably
       if (!RequestId.IsEmpty() && RequestingSocket.IsValid() &&
@@ -150,446 +140,9 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
         ConnectionManager->RegisterRequestSocket(RequestId, RequestingSocket);
       }
 
-      // ---------------------------------------------------------
-      // Check Handler Registry (O(1) dispatch)
-      // ---------------------------------------------------------
-      if (const FAutomationHandler *Handler = AutomationHandlers.Find(Action)) {
-        if (HandleAndLog(*Action, [&]() {
-              return (*Handler)(RequestId, Action, Payload, RequestingSocket);
-            })) {
-          return;
-        }
-      }
-
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Starting handler dispatch for "
-                  "action='%s'"),
-             *Action);
-
-      // Prioritize blueprint actions early only for blueprint-like actions to
-      // avoid noisy prefix logs
-      {
-        FString LowerNormalized = LowerAction;
-        LowerNormalized.ReplaceInline(TEXT("-"), TEXT("_"));
-        LowerNormalized.ReplaceInline(TEXT(" "), TEXT("_"));
-        const bool bLooksBlueprint =
-            (LowerNormalized.StartsWith(TEXT("blueprint_")) ||
-             LowerNormalized.StartsWith(TEXT("manage_blueprint")) ||
-             LowerNormalized.Contains(TEXT("_scs")) ||
-             LowerNormalized.Contains(TEXT("scs_")) ||
-             LowerNormalized.Contains(TEXT("scs")));
-        if (bLooksBlueprint) {
-          UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-                 TEXT("ProcessAutomationRequest: Checking "
-                      "HandleBlueprintAction (early)"));
-          if (HandleAndLog(TEXT("HandleBlueprintAction (early)"), [&]() {
-                return HandleBlueprintAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-              })) {
-            UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-                   TEXT("HandleBlueprintAction (early) consumed request"));
-            return;
-          }
-        }
-      }
-
-      // Allow small handlers to short-circuit fast (property/function)
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: About to call "
-                  "HandleExecuteEditorFunction"));
-      if (HandleAndLog(TEXT("HandleExecuteEditorFunction"), [&]() {
-            return HandleExecuteEditorFunction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleExecuteEditorFunction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: HandleExecuteEditorFunction "
-                  "returned false"));
-
-      // Level utilities (top-level aliases)
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleLevelAction"));
-      if (HandleAndLog(TEXT("HandleLevelAction"), [&]() {
-            return HandleLevelAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleLevelAction consumed request"));
-        return;
-      }
-
-      // Try asset actions early (materials, import, list, rename, etc.)
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleAssetAction (early)"));
-      if (HandleAndLog(TEXT("HandleAssetAction (early)"), [&]() {
-            return HandleAssetAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAssetAction (early) consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleSetObjectProperty"), [&]() {
-            return HandleSetObjectProperty(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleGetObjectProperty"), [&]() {
-            return HandleGetObjectProperty(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-
-      // Specialized actions (Array, Map, Set, Landscape, Foliage, Niagara,
-      // Animation, Sequencer, etc.) are now handled by the O(1)
-      // AutomationHandlers registry check at the top of this function. The
-      // linear checks have been removed for performance.
-
-      // Delegate asset/control/blueprint/sequence actions to their handlers
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleAssetAction"));
-      if (HandleAndLog(TEXT("HandleAssetAction"), [&]() {
-            return HandleAssetAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAssetAction consumed request"));
-        return;
-      }
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleControlActorAction"));
-      if (HandleAndLog(TEXT("HandleControlActorAction"), [&]() {
-            return HandleControlActorAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleControlActorAction consumed request"));
-        return;
-      }
-      UE_LOG(
-          LogMcpAutomationBridgeSubsystem, Verbose,
-          TEXT("ProcessAutomationRequest: Checking HandleControlEditorAction"));
-      if (HandleAndLog(TEXT("HandleControlEditorAction"), [&]() {
-            return HandleControlEditorAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleControlEditorAction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleUiAction"));
-      if (HandleAndLog(TEXT("HandleUiAction"), [&]() {
-            return HandleUiAction(RequestId, Action, Payload, RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleUiAction consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleBlueprintAction "
-                  "(late)"));
-      if (HandleAndLog(TEXT("HandleBlueprintAction (late)"), [&]() {
-            return HandleBlueprintAction(RequestId, Action, Payload,
-                                         RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleBlueprintAction (late) consumed request"));
-        return;
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking HandleSequenceAction"));
-      if (HandleAndLog(TEXT("HandleSequenceAction"), [&]() {
-            return HandleSequenceAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleSequenceAction consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleEffectAction"), [&]() {
-            return HandleEffectAction(RequestId, Action, Payload,
-                                      RequestingSocket);
-          }))
-        return;
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-             TEXT("ProcessAutomationRequest: Checking "
-                  "HandleAnimationPhysicsAction"));
-      if (HandleAndLog(TEXT("HandleAnimationPhysicsAction"), [&]() {
-            return HandleAnimationPhysicsAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          })) {
-        UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
-               TEXT("HandleAnimationPhysicsAction consumed request"));
-        return;
-      }
-      if (HandleAndLog(TEXT("HandleAudioAction"), [&]() {
-            return HandleAudioAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleLightingAction"), [&]() {
-            return HandleLightingAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandlePerformanceAction"), [&]() {
-            return HandlePerformanceAction(RequestId, Action, Payload,
-                                           RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleBuildEnvironmentAction"), [&]() {
-            return HandleBuildEnvironmentAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleControlEnvironmentAction"), [&]() {
-            return HandleControlEnvironmentAction(RequestId, Action, Payload,
-                                                  RequestingSocket);
-          }))
-        return;
-
-      // Additional consolidated tool handlers
-      if (HandleAndLog(TEXT("HandleSystemControlAction"), [&]() {
-            return HandleSystemControlAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleConsoleCommandAction"), [&]() {
-            return HandleConsoleCommandAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleInspectAction"), [&]() {
-            return HandleInspectAction(RequestId, Action, Payload,
-                                       RequestingSocket);
-          }))
-        return;
-
-      // 1. Editor Authoring & Graph Editing
-      if (HandleAndLog(TEXT("HandleBlueprintGraphAction"), [&]() {
-            return HandleBlueprintGraphAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleNiagaraGraphAction"), [&]() {
-            return HandleNiagaraGraphAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleMaterialGraphAction"), [&]() {
-            return HandleMaterialGraphAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleBehaviorTreeAction"), [&]() {
-            return HandleBehaviorTreeAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleWorldPartitionAction"), [&]() {
-            return HandleWorldPartitionAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleRenderAction"), [&]() {
-            return HandleRenderAction(RequestId, Action, Payload,
-                                      RequestingSocket);
-          }))
-        return;
-
-      // Phase 6: Geometry Script
-      if (HandleAndLog(TEXT("HandleGeometryAction"), [&]() {
-            return HandleGeometryAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 7: Skeleton & Rigging
-      if (HandleAndLog(TEXT("HandleManageSkeleton"), [&]() {
-            return HandleManageSkeleton(RequestId, Action, Payload, RequestingSocket);
-          }))
-        return;
-
-      // Phase 8: Material Authoring
-      if (HandleAndLog(TEXT("HandleManageMaterialAuthoringAction"), [&]() {
-            return HandleManageMaterialAuthoringAction(RequestId, Action, Payload,
-                                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 9: Texture Management
-      if (HandleAndLog(TEXT("HandleManageTextureAction"), [&]() {
-            return HandleManageTextureAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // Phase 10: Animation Authoring
-      if (HandleAndLog(TEXT("HandleManageAnimationAuthoringAction"), [&]() {
-            return HandleManageAnimationAuthoringAction(RequestId, Action, Payload,
-                                                         RequestingSocket);
-          }))
-        return;
-
-      // Phase 11: Audio Authoring
-      if (HandleAndLog(TEXT("HandleManageAudioAuthoringAction"), [&]() {
-            return HandleManageAudioAuthoringAction(RequestId, Action, Payload,
-                                                    RequestingSocket);
-          }))
-        return;
-
-      // Phase 12: Niagara Authoring
-      if (HandleAndLog(TEXT("HandleManageNiagaraAuthoringAction"), [&]() {
-            return HandleManageNiagaraAuthoringAction(RequestId, Action, Payload,
-                                                       RequestingSocket);
-          }))
-        return;
-
-      // Phase 13: GAS (Gameplay Ability System)
-      if (HandleAndLog(TEXT("HandleManageGASAction"), [&]() {
-            return HandleManageGASAction(RequestId, Action, Payload,
-                                         RequestingSocket);
-          }))
-        return;
-
-      // Phase 14: Character & Movement System
-      if (HandleAndLog(TEXT("HandleManageCharacterAction"), [&]() {
-            return HandleManageCharacterAction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          }))
-        return;
-
-      // Phase 15: Combat & Weapons System
-      if (HandleAndLog(TEXT("HandleManageCombatAction"), [&]() {
-            return HandleManageCombatAction(RequestId, Action, Payload,
-                                            RequestingSocket);
-          }))
-        return;
-
-      // Phase 16: AI System
-      if (HandleAndLog(TEXT("HandleManageAIAction"), [&]() {
-            return HandleManageAIAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Phase 17: Inventory & Items System
-      if (HandleAndLog(TEXT("HandleManageInventoryAction"), [&]() {
-            return HandleManageInventoryAction(RequestId, Action, Payload,
-                                               RequestingSocket);
-          }))
-        return;
-
-      // Phase 18: Interaction System
-      if (HandleAndLog(TEXT("HandleManageInteractionAction"), [&]() {
-            return HandleManageInteractionAction(RequestId, Action, Payload,
-                                                 RequestingSocket);
-          }))
-        return;
-
-      // Phase 19: Widget Authoring System
-      if (HandleAndLog(TEXT("HandleManageWidgetAuthoringAction"), [&]() {
-            return HandleManageWidgetAuthoringAction(RequestId, Action, Payload,
-                                                     RequestingSocket);
-          }))
-        return;
-
-      // Phase 20: Networking & Multiplayer
-      if (HandleAndLog(TEXT("HandleManageNetworkingAction"), [&]() {
-            return HandleManageNetworkingAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-
-      // Phase 21: Game Framework
-      if (HandleAndLog(TEXT("HandleManageGameFrameworkAction"), [&]() {
-            return HandleManageGameFrameworkAction(RequestId, Action, Payload,
-                                                   RequestingSocket);
-          }))
-        return;
-
-      // Phase 22: Sessions & Local Multiplayer
-      if (HandleAndLog(TEXT("HandleManageSessionsAction"), [&]() {
-            return HandleManageSessionsAction(RequestId, Action, Payload,
-                                              RequestingSocket);
-          }))
-        return;
-
-      // Phase 23: Level Structure
-      if (HandleAndLog(TEXT("HandleManageLevelStructureAction"), [&]() {
-            return HandleManageLevelStructureAction(RequestId, Action, Payload,
-                                                    RequestingSocket);
-          }))
-        return;
-
-      // Phase 24: Volumes & Zones
-      if (HandleAndLog(TEXT("HandleManageVolumesAction"), [&]() {
-            return HandleManageVolumesAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // Phase 25: Navigation System
-      if (HandleAndLog(TEXT("HandleManageNavigationAction"), [&]() {
-            return HandleManageNavigationAction(RequestId, Action, Payload,
-                                                RequestingSocket);
-          }))
-        return;
-
-      // Phase 26: Spline System
-      if (HandleAndLog(TEXT("HandleManageSplinesAction"), [&]() {
-            return HandleManageSplinesAction(RequestId, Action, Payload,
-                                             RequestingSocket);
-          }))
-        return;
-
-      // 2. Execution & Build / Test Pipeline
-      if (HandleAndLog(TEXT("HandlePipelineAction"), [&]() {
-            return HandlePipelineAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleTestAction"), [&]() {
-            return HandleTestAction(RequestId, Action, Payload,
-                                    RequestingSocket);
-          }))
-        return;
-
-      // 3. Observability, Logs, Debugging & History
-      if (HandleAndLog(TEXT("HandleLogAction"), [&]() {
-            return HandleLogAction(RequestId, Action, Payload,
-                                   RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleDebugAction"), [&]() {
-            return HandleDebugAction(RequestId, Action, Payload,
-                                     RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleAssetQueryAction"), [&]() {
-            return HandleAssetQueryAction(RequestId, Action, Payload,
-                                          RequestingSocket);
-          }))
-        return;
-      if (HandleAndLog(TEXT("HandleInsightsAction"), [&]() {
-            return HandleInsightsAction(RequestId, Action, Payload,
-                                        RequestingSocket);
-          }))
-        return;
-
-      // Unhandled action
+      ConsumedHandlerLabel = DispatchAutomationAction(RequestId, Action,
+                                                      Payload, RequestingSocket);
       bDispatchHandled = true;
-      ConsumedHandlerLabel = TEXT("SendAutomationError (unknown action)");
-      SendAutomationError(
-          RequestingSocket, RequestId,
-          FString::Printf(TEXT("Unknown automation action: %s"), *Action),
-          TEXT("UNKNOWN_ACTION"));
     } catch (const std::exception &E) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
              TEXT("Unhandled exception processing automation request %s: %s"),
@@ -614,6 +167,433 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
   }
 }
 
+FString UMcpAutomationBridgeSubsystem::DispatchAutomationAction(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+  // Every action a handler understands is registered up front (see
+  // InitializeActionAliases), so unknown actions are rejected here without
+  // probing any handler.
+  FAutomationRouteCandidates Candidates;
+  if (ResolveAutomationRoute(Action, Candidates)) {
+    if (ConnectionManager.IsValid()) {
+      ConnectionManager->MarkRequestHandlerStart(RequestingSocket.Get(),
+                                                 RequestId);
+    }
+    for (const FAutomationRouteCandidate *Candidate : Candidates) {
+      MCP_TRACE_SCOPE_TEXT(*Candidate->Label);
+      if (Candidate->Handler(RequestId, Action, Payload, RequestingSocket)) {
+        return Candidate->Label;
+      }
+    }
+  }
+
+  SendAutomationError(
+      RequestingSocket, RequestId,
+      FString::Printf(TEXT("Unknown automation action: %s"), *Action),
+      TEXT("UNKNOWN_ACTION"));
+  return TEXT("SendAutomationError (unknown action)");
+}
+
+namespace {
+// Leading "word" of an action name ("audio" for "audio_play_sound"), used to
+// bucket prefix routes. Returns NAME_None when no such name exists yet, so
+// unknown segments never grow the name table.
+FName McpActionLeadingSegment(const FString &Action, EFindName FindType) {
+  int32 SeparatorIndex = INDEX_NONE;
+  const int32 SegmentLen = Action.FindChar(TEXT('_'), SeparatorIndex)
+                               ? SeparatorIndex
+                               : Action.Len();
+  if (SegmentLen <= 0 || SegmentLen >= NAME_SIZE) {
+    return NAME_None;
+  }
+  return FName(SegmentLen, *Action, FindType);
+}
+
+// Mirrors the tolerant prefix check in HandleBlueprintAction: any spelling
+// of "blueprint" or "scs" once separators and case are ignored.
+bool McpLooksLikeBlueprintAction(const FString &Action) {
+  TCHAR AlphaNum[NAME_SIZE];
+  int32 Len = 0;
+  for (const TCHAR C : Action) {
+    if (Len >= NAME_SIZE - 1) {
+      break;
+    }
+    if (FChar::IsAlnum(C)) {
+      AlphaNum[Len++] = FChar::ToLower(C);
+    }
+  }
+  AlphaNum[Len] = TEXT('\0');
+  return FCString::Strstr(AlphaNum, TEXT("blueprint")) != nullptr ||
+         FCString::Strstr(AlphaNum, TEXT("scs")) != nullptr;
+}
+} // namespace
+
+/**
+ * @brief Registers the action names served by the consolidated handlers.
+ *
+ * The consolidated Handle*Action functions each accept a family of action
+ * names. They are registered here, after InitializeHandlers(), in the order
+ * the dispatcher used to probe them so that an action claimed by several
+ * handlers is still offered to them in the same order.
+ */
+void UMcpAutomationBridgeSubsystem::InitializeActionAliases() {
+  BlueprintActionRoute.Label = TEXT("HandleBlueprintAction");
+  BlueprintActionRoute.Handler =
+      [this](const FString &R, const FString &A,
+             const TSharedPtr<FJsonObject> &P,
+             TSharedPtr<FMcpBridgeWebSocket> S) {
+        return HandleBlueprintAction(R, A, P, S);
+      };
+
+  RegisterActionAliases(TEXT("HandleExecuteEditorFunction"),
+                        &UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction,
+                        {TEXT("execute_console_command")});
+
+  // Level utilities (top-level aliases)
+  RegisterActionAliases(
+      TEXT("HandleLevelAction"), &UMcpAutomationBridgeSubsystem::HandleLevelAction,
+      {TEXT("save_current_level"), TEXT("create_new_level"),
+       TEXT("stream_level"), TEXT("spawn_light"), TEXT("build_lighting"),
+       TEXT("bake_lightmap"), TEXT("list_levels"), TEXT("export_level"),
+       TEXT("import_level"), TEXT("add_sublevel")});
+
+  // Asset actions sent directly rather than as manage_asset subActions
+  RegisterActionAliases(
+      TEXT("HandleAssetAction"), &UMcpAutomationBridgeSubsystem::HandleAssetAction,
+      {TEXT("import"), TEXT("duplicate"), TEXT("rename"), TEXT("move"),
+       TEXT("delete"), TEXT("delete_asset"), TEXT("delete_assets"),
+       TEXT("create_folder"), TEXT("create_material"),
+       TEXT("create_material_instance"), TEXT("get_dependencies"),
+       TEXT("get_asset_graph"), TEXT("set_tags"), TEXT("set_metadata"),
+       TEXT("get_metadata"), TEXT("validate"), TEXT("list"),
+       TEXT("list_assets"), TEXT("generate_report"),
+       TEXT("add_material_parameter"), TEXT("list_instances"),
+       TEXT("reset_instance_parameters"), TEXT("exists"),
+       TEXT("get_material_stats"), TEXT("bulk_rename"), TEXT("bulk_delete"),
+       TEXT("nanite_rebuild_mesh"), TEXT("source_control_enable"),
+       TEXT("analyze_graph"), TEXT("add_material_node"),
+       TEXT("connect_material_pins"), TEXT("remove_material_node"),
+       TEXT("break_material_connections"), TEXT("get_material_node_details"),
+       TEXT("rebuild_material")});
+
+  RegisterActionPrefixes(TEXT("HandleControlActorAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleControlActorAction,
+                         {TEXT("control_actor")});
+  RegisterActionPrefixes(TEXT("HandleControlEditorAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleControlEditorAction,
+                         {TEXT("control_editor")});
+
+  // system_control is shared: UI sub-tools, then console commands.
+  RegisterActionAliases(TEXT("HandleUiAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleUiAction,
+                        {TEXT("system_control")});
+  RegisterActionAliases(TEXT("HandleConsoleCommandAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleConsoleCommandAction,
+                        {TEXT("system_control")});
+
+  RegisterActionPrefixes(TEXT("HandleSequenceAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleSequenceAction,
+                         {TEXT("sequence_")});
+
+  // Niagara modules and debug shapes
+  RegisterActionAliases(TEXT("HandleEffectAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleEffectAction,
+                        {TEXT("spawn_niagara"), TEXT("set_niagara_parameter"),
+                         TEXT("list_debug_shapes")});
+  RegisterActionPrefixes(
+      TEXT("HandleEffectAction"), &UMcpAutomationBridgeSubsystem::HandleEffectAction,
+      {TEXT("create_effect"), TEXT("add_"), TEXT("set_parameter"),
+       TEXT("bind_parameter"), TEXT("enable_gpu"), TEXT("configure_event")});
+
+  RegisterActionPrefixes(TEXT("HandleAnimationPhysicsAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleAnimationPhysicsAction,
+                         {TEXT("animation_physics")});
+
+  RegisterActionPrefixes(
+      TEXT("HandleAudioAction"), &UMcpAutomationBridgeSubsystem::HandleAudioAction,
+      {TEXT("audio_"), TEXT("create_sound_"), TEXT("play_sound_"),
+       TEXT("set_sound_"), TEXT("push_sound_"), TEXT("pop_sound_"),
+       TEXT("create_audio_"), TEXT("create_ambient_"), TEXT("create_reverb_"),
+       TEXT("enable_audio_"), TEXT("fade_sound"), TEXT("set_doppler_"),
+       TEXT("set_audio_"), TEXT("clear_sound_"), TEXT("set_base_sound_"),
+       TEXT("prime_"), TEXT("spawn_sound_")});
+
+  // spawn_light/build_lighting/bake_lightmap are tried by the level
+  // handler first, as before.
+  RegisterActionAliases(
+      TEXT("HandleLightingAction"), &UMcpAutomationBridgeSubsystem::HandleLightingAction,
+      {TEXT("spawn_light"), TEXT("build_lighting"), TEXT("bake_lightmap")});
+  RegisterActionPrefixes(
+      TEXT("HandleLightingAction"), &UMcpAutomationBridgeSubsystem::HandleLightingAction,
+      {TEXT("spawn_light"), TEXT("spawn_sky_light"), TEXT("create_sky_light"),
+       TEXT("create_light"), TEXT("build_lighting"), TEXT("bake_lightmap"),
+       TEXT("ensure_single_sky_light"), TEXT("create_lighting_enabled_level"),
+       TEXT("create_lightmass_volume"), TEXT("create_dynamic_light"),
+       TEXT("setup_volumetric_fog"), TEXT("setup_global_illumination"),
+       TEXT("configure_shadows"), TEXT("set_exposure"),
+       TEXT("list_light_types"), TEXT("set_ambient_occlusion")});
+
+  RegisterActionPrefixes(
+      TEXT("HandlePerformanceAction"),
+      &UMcpAutomationBridgeSubsystem::HandlePerformanceAction,
+      {TEXT("generate_memory_report"), TEXT("configure_texture_streaming"),
+       TEXT("merge_actors"), TEXT("start_profiling"), TEXT("stop_profiling"),
+       TEXT("show_fps"), TEXT("show_stats"), TEXT("set_scalability"),
+       TEXT("set_resolution_scale"), TEXT("set_vsync"),
+       TEXT("set_frame_rate_limit"), TEXT("configure_nanite"),
+       TEXT("configure_lod"), TEXT("run_benchmark"), TEXT("enable_gpu_timing"),
+       TEXT("apply_baseline_settings"), TEXT("optimize_draw_calls"),
+       TEXT("configure_occlusion_culling"), TEXT("optimize_shaders"),
+       TEXT("configure_world_partition")});
+
+  RegisterActionPrefixes(TEXT("HandleBuildEnvironmentAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleBuildEnvironmentAction,
+                         {TEXT("build_environment")});
+  RegisterActionPrefixes(TEXT("HandleControlEnvironmentAction"),
+                         &UMcpAutomationBridgeSubsystem::HandleControlEnvironmentAction,
+                         {TEXT("control_environment")});
+
+  // Tool-level actions without a dedicated registration
+  RegisterActionAliases(TEXT("HandleNiagaraGraphAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleNiagaraGraphAction,
+                        {TEXT("manage_niagara_graph")});
+  RegisterActionAliases(TEXT("HandleMaterialGraphAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction,
+                        {TEXT("manage_material_graph")});
+  RegisterActionAliases(
+      TEXT("HandleManageAnimationAuthoringAction"),
+      &UMcpAutomationBridgeSubsystem::HandleManageAnimationAuthoringAction,
+      {TEXT("manage_animation_authoring")});
+  RegisterActionPrefixes(
+      TEXT("HandleManageAudioAuthoringAction"),
+      &UMcpAutomationBridgeSubsystem::HandleManageAudioAuthoringAction,
+      {TEXT("manage_audio_authoring")});
+  RegisterActionAliases(
+      TEXT("HandleManageNiagaraAuthoringAction"),
+      &UMcpAutomationBridgeSubsystem::HandleManageNiagaraAuthoringAction,
+      {TEXT("manage_niagara_authoring")});
+  RegisterActionAliases(TEXT("HandleTestAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleTestAction,
+                        {TEXT("manage_tests")});
+  RegisterActionAliases(TEXT("HandleLogAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleLogAction,
+                        {TEXT("manage_logs")});
+  RegisterActionAliases(TEXT("HandleDebugAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleDebugAction,
+                        {TEXT("manage_debug")});
+  RegisterActionAliases(TEXT("HandleInsightsAction"),
+                        &UMcpAutomationBridgeSubsystem::HandleInsightsAction,
+                        {TEXT("manage_insights")});
+
+  // These handlers dispatch on the payload's subAction (or action) field
+  // regardless of the top-level action, and used to pick up requests that a
+  // known tool's own handler declined.
+  auto AddPayloadRouted = [this](const TCHAR *Label,
+                                 FAutomationMemberHandler Handler) {
+    FAutomationRouteCandidate &Candidate = PayloadRoutedHandlers.AddDefaulted_GetRef();
+    Candidate.Label = Label;
+    Candidate.Handler = [this, Handler](const FString &R, const FString &A,
+                                        const TSharedPtr<FJsonObject> &P,
+                                        TSharedPtr<FMcpBridgeWebSocket> S) {
+      return (this->*Handler)(R, A, P, S);
+    };
+  };
+  AddPayloadRouted(TEXT("HandleSystemControlAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleSystemControlAction);
+  AddPayloadRouted(TEXT("HandleManageSessionsAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleManageSessionsAction);
+  AddPayloadRouted(TEXT("HandleManageLevelStructureAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleManageLevelStructureAction);
+  AddPayloadRouted(TEXT("HandleManageVolumesAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleManageVolumesAction);
+  AddPayloadRouted(TEXT("HandleManageNavigationAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleManageNavigationAction);
+  AddPayloadRouted(TEXT("HandleManageSplinesAction"),
+                   &UMcpAutomationBridgeSubsystem::HandleManageSplinesAction);
+
+  ReportSharedActionClaims();
+}
+
+/**
+ * @brief Appends a consolidated handler to the routes of the given actions.
+ *
+ * Unlike RegisterHandler(), an existing route is kept and Handler is tried
+ * after the handlers already registered for that action.
+ */
+void UMcpAutomationBridgeSubsystem::RegisterActionAliases(
+    const TCHAR *Label, FAutomationMemberHandler Handler,
+    std::initializer_list<const TCHAR *> Actions) {
+  for (const TCHAR *Action : Actions) {
+    FAutomationActionRoute &Route = AutomationHandlers.FindOrAdd(FName(Action));
+    FAutomationRouteCandidate &Candidate = Route.Candidates.AddDefaulted_GetRef();
+    Candidate.Label = Label;
+    Candidate.Handler = [this, Handler](const FString &R, const FString &A,
+                                        const TSharedPtr<FJsonObject> &P,
+                                        TSharedPtr<FMcpBridgeWebSocket> S) {
+      return (this->*Handler)(R, A, P, S);
+    };
+  }
+}
+
+/**
+ * @brief Routes every action starting with one of Prefixes to Handler.
+ *
+ * Prefix routes are consulted only for actions with no exact registration.
+ * Within a bucket the longest prefix is tried first, so a specific family
+ * (enable_gpu_timing) is not swallowed by a broader one (enable_gpu).
+ */
+void UMcpAutomationBridgeSubsystem::RegisterActionPrefixes(
+    const TCHAR *Label, FAutomationMemberHandler Handler,
+    std::initializer_list<const TCHAR *> Prefixes) {
+  for (const TCHAR *Prefix : Prefixes) {
+    const FString PrefixString(Prefix);
+    const FName Bucket = McpActionLeadingSegment(PrefixString, FNAME_Add);
+    if (Bucket.IsNone()) {
+      continue;
+    }
+    TArray<FAutomationPrefixRoute> &Routes = AutomationPrefixRoutes.FindOrAdd(Bucket);
+    FAutomationPrefixRoute Route;
+    Route.Prefix = PrefixString;
+    Route.Candidate.Label = Label;
+    Route.Candidate.Handler = [this, Handler](const FString &R, const FString &A,
+                                              const TSharedPtr<FJsonObject> &P,
+                                              TSharedPtr<FMcpBridgeWebSocket> S) {
+      return (this->*Handler)(R, A, P, S);
+    };
+    int32 InsertAt = 0;
+    while (InsertAt < Routes.Num() &&
+           Routes[InsertAt].Prefix.Len() >= PrefixString.Len()) {
+      ++InsertAt;
+    }
+    Routes.Insert(MoveTemp(Route), InsertAt);
+  }
+}
+
+/**
+ * @brief Startup self-check of the action table.
+ *
+ * Logs every action offered to more than one handler and every prefix
+ * family that overlaps another handler's family, so accidental claims show
+ * up in the editor log instead of as misrouted requests.
+ */
+void UMcpAutomationBridgeSubsystem::ReportSharedActionClaims() const {
+  int32 SharedActions = 0;
+  for (const TPair<FName, FAutomationActionRoute> &Pair : AutomationHandlers) {
+    const FAutomationActionRoute &Route = Pair.Value;
+    if (Route.Candidates.Num() < 2) {
+      continue;
+    }
+    ++SharedActions;
+    TArray<FString> Labels;
+    for (const FAutomationRouteCandidate &Candidate : Route.Candidates) {
+      Labels.Add(Candidate.Label);
+    }
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Automation action '%s' is claimed by %d handlers (tried in "
+                "order): %s"),
+           *Pair.Key.ToString(), Labels.Num(),
+           *FString::Join(Labels, TEXT(", ")));
+  }
+
+  int32 PrefixFamilies = 0;
+  int32 OverlappingPrefixes = 0;
+  for (const TPair<FName, TArray<FAutomationPrefixRoute>> &Pair :
+       AutomationPrefixRoutes) {
+    const TArray<FAutomationPrefixRoute> &Routes = Pair.Value;
+    PrefixFamilies += Routes.Num();
+    for (int32 Outer = 0; Outer < Routes.Num(); ++Outer) {
+      for (int32 Inner = Outer + 1; Inner < Routes.Num(); ++Inner) {
+        const FAutomationPrefixRoute &Longer = Routes[Outer];
+        const FAutomationPrefixRoute &Shorter = Routes[Inner];
+        if (Longer.Candidate.Label != Shorter.Candidate.Label &&
+            Longer.Prefix.StartsWith(Shorter.Prefix, ESearchCase::IgnoreCase)) {
+          ++OverlappingPrefixes;
+          UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+                 TEXT("Automation prefix '%s*' (%s) overlaps '%s*' (%s); the "
+                      "longer prefix is tried first."),
+                 *Longer.Prefix, *Longer.Candidate.Label, *Shorter.Prefix,
+                 *Shorter.Candidate.Label);
+        }
+      }
+    }
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("Automation dispatch table: %d actions, %d prefix families, %d "
+              "shared actions, %d overlapping prefixes, %d duplicate "
+              "registrations."),
+         AutomationHandlers.Num(), PrefixFamilies, SharedActions,
+         OverlappingPrefixes, DuplicateActionRegistrations);
+}
+
+/**
+ * @brief Collects the handlers that should be offered Action, in order.
+ *
+ * Exact registrations win; otherwise the blueprint matcher and the prefix
+ * families for the action's leading segment are consulted. Each step is a
+ * hashed lookup, so the cost does not grow with the number of handlers.
+ *
+ * @return `false` if no handler claims Action.
+ */
+bool UMcpAutomationBridgeSubsystem::ResolveAutomationRoute(
+    const FString &Action, FAutomationRouteCandidates &OutCandidates) const {
+  OutCandidates.Reset();
+  if (Action.IsEmpty() || Action.Len() >= NAME_SIZE) {
+    return false;
+  }
+
+  // FNAME_Find keeps arbitrary client strings out of the name table.
+  const FName Key(*Action, FNAME_Find);
+  const FAutomationActionRoute *Route =
+      Key.IsNone() ? nullptr : AutomationHandlers.Find(Key);
+  if (Route) {
+    for (const FAutomationRouteCandidate &Candidate : Route->Candidates) {
+      OutCandidates.Add(&Candidate);
+    }
+  } else {
+    if (BlueprintActionRoute.Handler && McpLooksLikeBlueprintAction(Action)) {
+      OutCandidates.Add(&BlueprintActionRoute);
+    }
+    const FName Bucket = McpActionLeadingSegment(Action, FNAME_Find);
+    if (!Bucket.IsNone()) {
+      if (const TArray<FAutomationPrefixRoute> *Routes =
+              AutomationPrefixRoutes.Find(Bucket)) {
+        for (const FAutomationPrefixRoute &PrefixRoute : *Routes) {
+          if (Action.StartsWith(PrefixRoute.Prefix, ESearchCase::IgnoreCase)) {
+            OutCandidates.Add(&PrefixRoute.Candidate);
+          }
+        }
+      }
+    }
+  }
+
+  if (OutCandidates.Num() == 0) {
+    return false;
+  }
+  for (const FAutomationRouteCandidate &Candidate : PayloadRoutedHandlers) {
+    OutCandidates.Add(&Candidate);
+  }
+  return true;
+}
+
+TArray<FString> UMcpAutomationBridgeSubsystem::GetRegisteredAutomationActions()
+    const {
+  TArray<FString> Actions;
+  Actions.Reserve(AutomationHandlers.Num());
+  for (const TPair<FName, FAutomationActionRoute> &Pair : AutomationHandlers) {
+    Actions.Add(Pair.Key.ToString());
+  }
+  return Actions;
+}
+
+int32 UMcpAutomationBridgeSubsystem::CountAutomationRouteCandidates(
+    const FString &Action) const {
+  FAutomationRouteCandidates Candidates;
+  ResolveAutomationRoute(Action, Candidates);
+  return Candidates.Num();
+}
+
 // ProcessPendingAutomationRequests() intentionally implemented in the
 // primary subsystem translation unit (McpAutomationBridgeSubsystem.cpp)
 // to ensure the linker emits the symbol into the module's object file.
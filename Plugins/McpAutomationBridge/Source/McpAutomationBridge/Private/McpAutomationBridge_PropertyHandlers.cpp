@@ -2611,17 +2611,24 @@ bool UMcpAutomationBridgeSubsystem::HandleGetAssetReferences(
     return true;
   }
 
-  // Get asset registry
+  // Get asset registry. This handler may run on a worker lane, where modules
+  // must not be loaded, so use the already-loaded module. In-memory assets
+  // are looked up too unless the client asks for onDiskOnly; only such
+  // requests reach the worker lane, so the answer does not depend on which
+  // thread served it.
   FAssetRegistryModule &AssetRegistryModule =
-      FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+      FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
   IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+  const bool bOnDiskOnly = GetJsonBoolField(Payload, TEXT("onDiskOnly"));
 
   // Find the asset
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-  FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+  FAssetData AssetData =
+      AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath), bOnDiskOnly);
 #else
   // UE 5.0: GetAssetByObjectPath takes FName
-  FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FName(*AssetPath));
+  FAssetData AssetData =
+      AssetRegistry.GetAssetByObjectPath(FName(*AssetPath), bOnDiskOnly);
 #endif
   if (!AssetData.IsValid()) {
     SendAutomationError(
@@ -2652,6 +2659,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGetAssetReferences(
   ResultPayload->SetStringField(TEXT("packageName"),
                                 AssetData.PackageName.ToString());
   ResultPayload->SetArrayField(TEXT("references"), ReferencesArray);
+  ResultPayload->SetBoolField(TEXT("onDiskOnly"), bOnDiskOnly);
   ResultPayload->SetNumberField(TEXT("referenceCount"), ReferencesArray.Num());
 
   SendAutomationResponse(RequestingSocket, RequestId, true,
@@ -2692,17 +2700,24 @@ bool UMcpAutomationBridgeSubsystem::HandleGetAssetDependencies(
     return true;
   }
 
-  // Get asset registry
+  // Get asset registry. This handler may run on a worker lane, where modules
+  // must not be loaded, so use the already-loaded module. In-memory assets
+  // are looked up too unless the client asks for onDiskOnly; only such
+  // requests reach the worker lane, so the answer does not depend on which
+  // thread served it.
   FAssetRegistryModule &AssetRegistryModule =
-      FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+      FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
   IAssetRegistry &AssetRegistry = AssetRegistryModule.Get();
+  const bool bOnDiskOnly = GetJsonBoolField(Payload, TEXT("onDiskOnly"));
 
   // Find the asset
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-  FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+  FAssetData AssetData =
+      AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath), bOnDiskOnly);
 #else
   // UE 5.0: GetAssetByObjectPath takes FName
-  FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FName(*AssetPath));
+  FAssetData AssetData =
+      AssetRegistry.GetAssetByObjectPath(FName(*AssetPath), bOnDiskOnly);
 #endif
   if (!AssetData.IsValid()) {
     SendAutomationError(
@@ -2733,6 +2748,7 @@ bool UMcpAutomationBridgeSubsystem::HandleGetAssetDependencies(
   ResultPayload->SetStringField(TEXT("packageName"),
                                 AssetData.PackageName.ToString());
   ResultPayload->SetArrayField(TEXT("dependencies"), DependenciesArray);
+  ResultPayload->SetBoolField(TEXT("onDiskOnly"), bOnDiskOnly);
   ResultPayload->SetNumberField(TEXT("dependencyCount"),
                                 DependenciesArray.Num());
 
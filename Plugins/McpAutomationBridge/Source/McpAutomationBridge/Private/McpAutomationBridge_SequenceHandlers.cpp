@@ -2444,12 +2444,13 @@ bool UMcpAutomationBridgeSubsystem::HandleSequenceAction(
     AddedNames.Add(TEXT("audio"));
     AddedNames.Add(TEXT("event"));
 
-    for (TObjectIterator<UClass> It; It; ++It) {
-      if (It->IsChildOf(UMovieSceneTrack::StaticClass()) &&
-          !It->HasAnyClassFlags(CLASS_Abstract) &&
-          !AddedNames.Contains(It->GetName())) {
-        Types.Add(MakeShared<FJsonValueString>(It->GetName()));
-        AddedNames.Add(It->GetName());
+    TArray<UClass *> TrackClasses;
+    FMcpClassIndex::GetConcreteClasses(UMovieSceneTrack::StaticClass(),
+                                       TrackClasses);
+    for (UClass *TrackClass : TrackClasses) {
+      if (!AddedNames.Contains(TrackClass->GetName())) {
+        Types.Add(MakeShared<FJsonValueString>(TrackClass->GetName()));
+        AddedNames.Add(TrackClass->GetName());
       }
     }
 
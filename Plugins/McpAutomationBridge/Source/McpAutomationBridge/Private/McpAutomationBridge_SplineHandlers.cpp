@@ -4,6 +4,7 @@
 
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpBridgeActorIndex.h"
 #include "McpBridgeWebSocket.h"
 #include "Misc/EngineVersionComparison.h"
 
@@ -111,16 +112,7 @@ static FRotator GetJsonRotatorFieldSpline(const TSharedPtr<FJsonObject>& Payload
 // Helper to find actor by name
 static AActor* FindActorByName(UWorld* World, const FString& ActorName)
 {
-    if (!World || ActorName.IsEmpty()) return nullptr;
-    
-    for (TActorIterator<AActor> It(World); It; ++It)
-    {
-        if (It->GetActorLabel() == ActorName || It->GetName() == ActorName)
-        {
-            return *It;
-        }
-    }
-    return nullptr;
+    return FMcpActorIndex::Get().FindExact(World, ActorName, EMcpActorIndexKey::Label | EMcpActorIndexKey::Name);
 }
 
 // Helper to find spline component on actor
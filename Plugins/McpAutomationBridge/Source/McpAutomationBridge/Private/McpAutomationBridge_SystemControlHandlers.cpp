@@ -409,23 +409,22 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
       UExporter* Exporter = nullptr;
       
       // Find appropriate exporter for the asset type and extension
-      for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt) {
-        UClass* CurrentClass = *ClassIt;
-        if (CurrentClass->IsChildOf(UExporter::StaticClass()) && !CurrentClass->HasAnyClassFlags(CLASS_Abstract)) {
-          UExporter* DefaultExporter = Cast<UExporter>(CurrentClass->GetDefaultObject());
-          if (DefaultExporter && DefaultExporter->SupportedClass) {
-            if (Asset->GetClass()->IsChildOf(DefaultExporter->SupportedClass)) {
-              if (DefaultExporter->PreferredFormatIndex < DefaultExporter->FormatExtension.Num()) {
-                FString PreferredExt = DefaultExporter->FormatExtension[DefaultExporter->PreferredFormatIndex].ToLower();
-                if (PreferredExt == Extension || PreferredExt.Contains(Extension)) {
-                  Exporter = DefaultExporter;
-                  break;
-                }
-              }
-              if (!Exporter) {
+      TArray<UClass*> ExporterClasses;
+      FMcpClassIndex::GetConcreteClasses(UExporter::StaticClass(), ExporterClasses);
+      for (UClass* CurrentClass : ExporterClasses) {
+        UExporter* DefaultExporter = Cast<UExporter>(CurrentClass->GetDefaultObject());
+        if (DefaultExporter && DefaultExporter->SupportedClass) {
+          if (Asset->GetClass()->IsChildOf(DefaultExporter->SupportedClass)) {
+            if (DefaultExporter->PreferredFormatIndex < DefaultExporter->FormatExtension.Num()) {
+              FString PreferredExt = DefaultExporter->FormatExtension[DefaultExporter->PreferredFormatIndex].ToLower();
+              if (PreferredExt == Extension || PreferredExt.Contains(Extension)) {
                 Exporter = DefaultExporter;
+                break;
               }
             }
+            if (!Exporter) {
+              Exporter = DefaultExporter;
+            }
           }
         }
       }
@@ -0,0 +1,415 @@
+#include "McpBridgeActorIndex.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/CoreDelegates.h"
+
+#if WITH_EDITOR
+#include "ActorEditorUtils.h"
+#endif
+
+namespace {
+// Packs three characters into one key; 21 bits each covers all of Unicode.
+uint64 McpLabelTrigram(const TCHAR *Chars) {
+  return (static_cast<uint64>(Chars[0] & 0x1FFFFF) << 42) |
+         (static_cast<uint64>(Chars[1] & 0x1FFFFF) << 21) |
+         static_cast<uint64>(Chars[2] & 0x1FFFFF);
+}
+
+FString McpActorLabel(const AActor &Actor) {
+#if WITH_EDITOR
+  return Actor.GetActorLabel();
+#else
+  return Actor.GetName();
+#endif
+}
+
+FString McpActorKeyString(const AActor &Actor, EMcpActorIndexKey Key) {
+  switch (Key) {
+  case EMcpActorIndexKey::Label:
+    return McpActorLabel(Actor);
+  case EMcpActorIndexKey::Name:
+    return Actor.GetName();
+  default:
+    return Actor.GetPathName();
+  }
+}
+} // namespace
+
+FMcpActorIndex &FMcpActorIndex::Get() {
+  static FMcpActorIndex Instance;
+  return Instance;
+}
+
+void FMcpActorIndex::Startup() {
+  if (bStarted || !GEngine) {
+    return;
+  }
+  ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(
+      this, &FMcpActorIndex::HandleActorAdded);
+  ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(
+      this, &FMcpActorIndex::HandleActorDeleted);
+  ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(
+      this, &FMcpActorIndex::HandleActorListChanged);
+#if WITH_EDITOR
+  ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(
+      this, &FMcpActorIndex::HandleActorLabelChanged);
+#endif
+  LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(
+      this, &FMcpActorIndex::HandleLevelChanged);
+  LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(
+      this, &FMcpActorIndex::HandleLevelChanged);
+  WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(
+      this, &FMcpActorIndex::HandleWorldCleanup);
+  // Anything indexed before now missed notifications.
+  Worlds.Empty();
+  bStarted = true;
+}
+
+void FMcpActorIndex::Shutdown() {
+  if (bStarted) {
+    if (GEngine) {
+      GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+      GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+      GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+    }
+#if WITH_EDITOR
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+#endif
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+    FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+    bStarted = false;
+  }
+  Worlds.Empty();
+}
+
+AActor *FMcpActorIndex::FindExact(UWorld *World, const FString &Target,
+                                  EMcpActorIndexKey Keys,
+                                  ESearchCase::Type SearchCase,
+                                  bool bOutlinerActorsOnly) {
+  if (!World || Target.IsEmpty()) {
+    return nullptr;
+  }
+  FWorldIndex &Index = GetIndex(*World);
+  const FString LowerTarget = Target.ToLower();
+
+  struct FKeyMap {
+    EMcpActorIndexKey Key;
+    TMultiMap<FString, int32> FWorldIndex::*Map;
+  };
+  const FKeyMap KeyMaps[] = {
+      {EMcpActorIndexKey::Label, &FWorldIndex::ByLabel},
+      {EMcpActorIndexKey::Name, &FWorldIndex::ByName},
+      {EMcpActorIndexKey::Path, &FWorldIndex::ByPath},
+  };
+
+  // A second pass only runs if the first re-indexed an entry that had gone
+  // stale, since its new keys may match under a map already searched.
+  for (int32 Pass = 0; Pass < 2; ++Pass) {
+    bool bRepaired = false;
+    for (const FKeyMap &KeyMap : KeyMaps) {
+      if (!EnumHasAnyFlags(Keys, KeyMap.Key)) {
+        continue;
+      }
+      TArray<int32, TInlineAllocator<4>> Slots;
+      (Index.*KeyMap.Map).MultiFind(LowerTarget, Slots);
+      Slots.Sort();
+      for (const int32 Slot : Slots) {
+        AActor *Actor = Index.Entries[Slot].Actor.Get();
+        if (!IsValid(Actor)) {
+          RemoveEntry(Index, Slot);
+          continue;
+        }
+        const FString Live = McpActorKeyString(*Actor, KeyMap.Key);
+        if (!Live.Equals(Target, ESearchCase::IgnoreCase)) {
+          // Renamed without a notification reaching us.
+          AddOrUpdateActor(Index, Actor);
+          bRepaired = true;
+          continue;
+        }
+        if (!Live.Equals(Target, SearchCase) ||
+            (bOutlinerActorsOnly && !IsOutlinerActor(Actor))) {
+          continue;
+        }
+        return Actor;
+      }
+    }
+    if (!bRepaired) {
+      break;
+    }
+  }
+  // Entries are only repaired when a lookup lands on them, so an actor
+  // renamed without a notification is still filed under its old keys.
+  return FindExactByScan(*World, Index, Target, Keys, SearchCase,
+                         bOutlinerActorsOnly);
+}
+
+AActor *FMcpActorIndex::FindExactByScan(UWorld &World, FWorldIndex &Index,
+                                        const FString &Target,
+                                        EMcpActorIndexKey Keys,
+                                        ESearchCase::Type SearchCase,
+                                        bool bOutlinerActorsOnly) {
+  const EMcpActorIndexKey KeyOrder[] = {EMcpActorIndexKey::Label,
+                                        EMcpActorIndexKey::Name,
+                                        EMcpActorIndexKey::Path};
+  AActor *Best = nullptr;
+  int32 BestRank = UE_ARRAY_COUNT(KeyOrder);
+  for (TActorIterator<AActor> It(&World, AActor::StaticClass(),
+                                 EActorIteratorFlags::SkipPendingKill);
+       It && BestRank > 0; ++It) {
+    AActor *Actor = *It;
+    // Only a match on an earlier key than the best so far can replace it.
+    for (int32 Rank = 0; Rank < BestRank; ++Rank) {
+      const EMcpActorIndexKey Key = KeyOrder[Rank];
+      if (EnumHasAnyFlags(Keys, Key) &&
+          McpActorKeyString(*Actor, Key).Equals(Target, SearchCase) &&
+          (!bOutlinerActorsOnly || IsOutlinerActor(Actor))) {
+        Best = Actor;
+        BestRank = Rank;
+        break;
+      }
+    }
+  }
+  if (Best) {
+    AddOrUpdateActor(Index, Best);
+  }
+  return Best;
+}
+
+int32 FMcpActorIndex::FindLabelsContaining(UWorld *World,
+                                           const FString &Target,
+                                           bool bOutlinerActorsOnly,
+                                           TArray<AActor *> &OutMatches,
+                                           int32 MaxMatches) {
+  if (!World || Target.IsEmpty()) {
+    return 0;
+  }
+  FWorldIndex &Index = GetIndex(*World);
+  const FString LowerTarget = Target.ToLower();
+
+  int32 NumMatches = 0;
+  TArray<int32> DeadSlots;
+  TArray<AActor *> RenamedActors;
+  auto Consider = [&](int32 Slot) {
+    const FEntry &Entry = Index.Entries[Slot];
+    if (!Entry.Label.Contains(LowerTarget, ESearchCase::CaseSensitive)) {
+      return;
+    }
+    AActor *Actor = Entry.Actor.Get();
+    if (!IsValid(Actor)) {
+      DeadSlots.Add(Slot);
+      return;
+    }
+    const FString LiveLabel = McpActorLabel(*Actor);
+    if (!LiveLabel.Equals(Entry.Label, ESearchCase::IgnoreCase)) {
+      // Relabelled without a notification reaching us; re-indexed below,
+      // once the index is no longer being iterated.
+      RenamedActors.Add(Actor);
+      if (!LiveLabel.Contains(Target, ESearchCase::IgnoreCase)) {
+        return;
+      }
+    }
+    if (bOutlinerActorsOnly && !IsOutlinerActor(Actor)) {
+      return;
+    }
+    if (OutMatches.Num() < MaxMatches) {
+      OutMatches.Add(Actor);
+    }
+    ++NumMatches;
+  };
+
+  if (LowerTarget.Len() < 3) {
+    for (auto It = Index.Entries.CreateConstIterator(); It; ++It) {
+      Consider(It.GetIndex());
+    }
+  } else {
+    if (!Index.bHasLabelTrigrams) {
+      Index.bHasLabelTrigrams = true;
+      for (auto It = Index.Entries.CreateConstIterator(); It; ++It) {
+        AddLabelTrigrams(Index, It.GetIndex());
+      }
+    }
+    // Every match contains each trigram of the target, so checking the
+    // entries under its rarest trigram finds them all.
+    const TSet<int32> *Candidates = nullptr;
+    for (int32 Start = 0; Start + 3 <= LowerTarget.Len(); ++Start) {
+      const TSet<int32> *Slots =
+          Index.LabelTrigrams.Find(McpLabelTrigram(*LowerTarget + Start));
+      if (!Slots) {
+        return 0;
+      }
+      if (!Candidates || Slots->Num() < Candidates->Num()) {
+        Candidates = Slots;
+      }
+    }
+    for (const int32 Slot : *Candidates) {
+      Consider(Slot);
+    }
+  }
+
+  for (const int32 Slot : DeadSlots) {
+    RemoveEntry(Index, Slot);
+  }
+  for (AActor *Actor : RenamedActors) {
+    AddOrUpdateActor(Index, Actor);
+  }
+  return NumMatches;
+}
+
+bool FMcpActorIndex::IsOutlinerActor(const AActor *Actor) {
+  if (!IsValid(Actor) || Actor->IsTemplate()) {
+    return false;
+  }
+#if WITH_EDITOR
+  return Actor->IsEditable() && Actor->IsListedInSceneOutliner() &&
+         !Actor->HasAnyFlags(RF_Transient) &&
+         !FActorEditorUtils::IsABuilderBrush(Actor) &&
+         !Actor->IsA(AWorldSettings::StaticClass());
+#else
+  return true;
+#endif
+}
+
+FMcpActorIndex::FWorldIndex &FMcpActorIndex::GetIndex(UWorld &World) {
+  FWorldIndex &Index = Worlds.FindOrAdd(TObjectKey<UWorld>(&World));
+  if (Index.bStale || !bStarted) {
+    Rebuild(World, Index);
+  }
+  return Index;
+}
+
+FMcpActorIndex::FWorldIndex *
+FMcpActorIndex::FindCurrentIndex(const AActor *Actor) {
+  UWorld *World = Actor ? Actor->GetWorld() : nullptr;
+  FWorldIndex *Index = World ? Worlds.Find(World) : nullptr;
+  // A stale index is rebuilt whole on its next lookup anyway.
+  return Index && !Index->bStale ? Index : nullptr;
+}
+
+void FMcpActorIndex::Rebuild(UWorld &World, FWorldIndex &Index) {
+  Index = FWorldIndex();
+  // All levels, hidden ones included, as UEditorActorSubsystem walks them.
+  for (TActorIterator<AActor> It(&World, AActor::StaticClass(),
+                                 EActorIteratorFlags::SkipPendingKill);
+       It; ++It) {
+    AddOrUpdateActor(Index, *It);
+  }
+  Index.bStale = false;
+}
+
+void FMcpActorIndex::AddOrUpdateActor(FWorldIndex &Index, AActor *Actor) {
+  if (!IsValid(Actor)) {
+    return;
+  }
+  const TObjectKey<AActor> ActorKey(Actor);
+  int32 Slot = INDEX_NONE;
+  if (const int32 *Existing = Index.EntryByActor.Find(ActorKey)) {
+    Slot = *Existing;
+    UnindexEntry(Index, Slot);
+  } else {
+    FEntry NewEntry;
+    NewEntry.Key = ActorKey;
+    NewEntry.Actor = Actor;
+    Slot = Index.Entries.Add(MoveTemp(NewEntry));
+    Index.EntryByActor.Add(ActorKey, Slot);
+  }
+  FEntry &Entry = Index.Entries[Slot];
+  Entry.Label = McpActorLabel(*Actor).ToLower();
+  Entry.Name = Actor->GetName().ToLower();
+  Entry.Path = Actor->GetPathName().ToLower();
+  IndexEntry(Index, Slot);
+}
+
+void FMcpActorIndex::RemoveEntry(FWorldIndex &Index, int32 Slot) {
+  if (!Index.Entries.IsValidIndex(Slot)) {
+    return;
+  }
+  UnindexEntry(Index, Slot);
+  Index.EntryByActor.Remove(Index.Entries[Slot].Key);
+  Index.Entries.RemoveAt(Slot);
+}
+
+void FMcpActorIndex::IndexEntry(FWorldIndex &Index, int32 Slot) {
+  const FEntry &Entry = Index.Entries[Slot];
+  Index.ByLabel.Add(Entry.Label, Slot);
+  Index.ByName.Add(Entry.Name, Slot);
+  Index.ByPath.Add(Entry.Path, Slot);
+  if (Index.bHasLabelTrigrams) {
+    AddLabelTrigrams(Index, Slot);
+  }
+}
+
+void FMcpActorIndex::UnindexEntry(FWorldIndex &Index, int32 Slot) {
+  const FEntry &Entry = Index.Entries[Slot];
+  Index.ByLabel.RemoveSingle(Entry.Label, Slot);
+  Index.ByName.RemoveSingle(Entry.Name, Slot);
+  Index.ByPath.RemoveSingle(Entry.Path, Slot);
+  if (!Index.bHasLabelTrigrams) {
+    return;
+  }
+  for (int32 Start = 0; Start + 3 <= Entry.Label.Len(); ++Start) {
+    const uint64 Trigram = McpLabelTrigram(*Entry.Label + Start);
+    if (TSet<int32> *Slots = Index.LabelTrigrams.Find(Trigram)) {
+      Slots->Remove(Slot);
+      if (Slots->Num() == 0) {
+        Index.LabelTrigrams.Remove(Trigram);
+      }
+    }
+  }
+}
+
+void FMcpActorIndex::AddLabelTrigrams(FWorldIndex &Index, int32 Slot) {
+  const FString &Label = Index.Entries[Slot].Label;
+  for (int32 Start = 0; Start + 3 <= Label.Len(); ++Start) {
+    Index.LabelTrigrams.FindOrAdd(McpLabelTrigram(*Label + Start)).Add(Slot);
+  }
+}
+
+void FMcpActorIndex::HandleActorAdded(AActor *Actor) {
+  if (FWorldIndex *Index = FindCurrentIndex(Actor)) {
+    AddOrUpdateActor(*Index, Actor);
+  }
+}
+
+void FMcpActorIndex::HandleActorDeleted(AActor *Actor) {
+  FWorldIndex *Index = FindCurrentIndex(Actor);
+  if (!Index) {
+    return;
+  }
+  if (const int32 *Found = Index->EntryByActor.Find(Actor)) {
+    const int32 Slot = *Found;
+    RemoveEntry(*Index, Slot);
+  }
+}
+
+void FMcpActorIndex::HandleActorLabelChanged(AActor *Actor) {
+  // Setting a label can also rename the actor, so every key is refreshed.
+  if (FWorldIndex *Index = FindCurrentIndex(Actor)) {
+    AddOrUpdateActor(*Index, Actor);
+  }
+}
+
+void FMcpActorIndex::HandleActorListChanged() {
+  for (TPair<TObjectKey<UWorld>, FWorldIndex> &Pair : Worlds) {
+    Pair.Value.bStale = true;
+  }
+}
+
+void FMcpActorIndex::HandleLevelChanged(ULevel *Level, UWorld *World) {
+  if (!World) {
+    HandleActorListChanged();
+    return;
+  }
+  if (FWorldIndex *Index = Worlds.Find(World)) {
+    Index->bStale = true;
+  }
+}
+
+void FMcpActorIndex::HandleWorldCleanup(UWorld *World, bool bSessionEnded,
+                                        bool bCleanupResources) {
+  Worlds.Remove(World);
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/IDelegateInstance.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/** Which of an actor's identifiers a lookup compares against. */
+enum class EMcpActorIndexKey : uint8
+{
+	None = 0,
+	Label = 1 << 0,
+	Name = 1 << 1,
+	Path = 1 << 2,
+	All = Label | Name | Path,
+};
+ENUM_CLASS_FLAGS(EMcpActorIndexKey);
+
+/**
+ * Per-world index of actors by lowercased label, object name and path name,
+ * with a trigram index over labels for substring matches. Handlers resolve
+ * the actor an agent named through it instead of walking every actor in the
+ * level, which on large World Partition maps costs milliseconds per lookup.
+ *
+ * A world is indexed on its first lookup and then kept current from the
+ * engine's actor added, deleted and label-changed notifications. Changes the
+ * engine only reports as "the actor list changed" (level streaming, World
+ * Partition region loads, undo) and levels added to or removed from the world
+ * mark it for a rebuild on its next lookup. Every hit is checked against the
+ * live actor, so an entry that went stale without a notification is
+ * re-indexed rather than returned, and an exact-match miss is confirmed by
+ * walking the world's actors before it is reported, so an actor the index
+ * has the wrong keys for is still found.
+ *
+ * Game thread only.
+ */
+class FMcpActorIndex
+{
+public:
+	static FMcpActorIndex& Get();
+
+	/** Binds the engine notifications. Until then every lookup rebuilds the world's index. */
+	void Startup();
+	/** Unbinds the notifications and drops every indexed world. */
+	void Shutdown();
+
+	/**
+	 * Returns an actor in World whose label, name or path name (as selected by
+	 * Keys) equals Target. Labels are tried before names and names before
+	 * paths. bOutlinerActorsOnly skips actors IsOutlinerActor rejects.
+	 */
+	AActor* FindExact(UWorld* World, const FString& Target, EMcpActorIndexKey Keys = EMcpActorIndexKey::All,
+		ESearchCase::Type SearchCase = ESearchCase::IgnoreCase, bool bOutlinerActorsOnly = false);
+
+	/**
+	 * Adds up to MaxMatches actors in World whose label contains Target,
+	 * ignoring case, to OutMatches and returns how many actors matched in all.
+	 * Candidates come from the index; whether they match is decided by their
+	 * live label.
+	 */
+	int32 FindLabelsContaining(UWorld* World, const FString& Target, bool bOutlinerActorsOnly, TArray<AActor*>& OutMatches,
+		int32 MaxMatches);
+
+	/** True for the actors UEditorActorSubsystem::GetAllLevelActors reports. */
+	static bool IsOutlinerActor(const AActor* Actor);
+
+private:
+	struct FEntry
+	{
+		TObjectKey<AActor> Key;
+		TWeakObjectPtr<AActor> Actor;
+		// Lowercased, as indexed.
+		FString Label;
+		FString Name;
+		FString Path;
+	};
+
+	struct FWorldIndex
+	{
+		TSparseArray<FEntry> Entries;
+		TMap<TObjectKey<AActor>, int32> EntryByActor;
+		TMultiMap<FString, int32> ByLabel;
+		TMultiMap<FString, int32> ByName;
+		TMultiMap<FString, int32> ByPath;
+		// Every three-character run of each label, to the entries containing
+		// it. Built on the first substring lookup, not with the rest.
+		TMap<uint64, TSet<int32>> LabelTrigrams;
+		bool bHasLabelTrigrams = false;
+		bool bStale = true;
+	};
+
+	FWorldIndex& GetIndex(UWorld& World);
+	AActor* FindExactByScan(UWorld& World, FWorldIndex& Index, const FString& Target, EMcpActorIndexKey Keys,
+		ESearchCase::Type SearchCase, bool bOutlinerActorsOnly);
+	FWorldIndex* FindCurrentIndex(const AActor* Actor);
+	void Rebuild(UWorld& World, FWorldIndex& Index);
+	void AddOrUpdateActor(FWorldIndex& Index, AActor* Actor);
+	void RemoveEntry(FWorldIndex& Index, int32 Slot);
+	void IndexEntry(FWorldIndex& Index, int32 Slot);
+	void UnindexEntry(FWorldIndex& Index, int32 Slot);
+	void AddLabelTrigrams(FWorldIndex& Index, int32 Slot);
+
+	void HandleActorAdded(AActor* Actor);
+	void HandleActorDeleted(AActor* Actor);
+	void HandleActorLabelChanged(AActor* Actor);
+	void HandleActorListChanged();
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+	void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	TMap<TObjectKey<UWorld>, FWorldIndex> Worlds;
+	bool bStarted = false;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+};
@@ -0,0 +1,139 @@
+#include "McpBridgeAssetPathCache.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+namespace {
+const FName McpAssetRegistryModuleName(TEXT("AssetRegistry"));
+
+IAssetRegistry *McpFindAssetRegistry() {
+  FAssetRegistryModule *Module =
+      FModuleManager::GetModulePtr<FAssetRegistryModule>(
+          McpAssetRegistryModuleName);
+  return Module ? &Module->Get() : nullptr;
+}
+
+// Spellings without a slash are short names, resolved by searching for them.
+bool McpIsShortNameSpelling(const FString &Spelling) {
+  return !Spelling.Contains(TEXT("/"));
+}
+} // namespace
+
+FMcpAssetPathCache &FMcpAssetPathCache::Get() {
+  static FMcpAssetPathCache Instance;
+  return Instance;
+}
+
+FMcpAssetPathCache::FMcpAssetPathCache() : Entries(MaxEntries) {}
+
+void FMcpAssetPathCache::Startup() {
+  if (bStarted) {
+    return;
+  }
+  IAssetRegistry &AssetRegistry =
+      FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+          McpAssetRegistryModuleName)
+          .Get();
+  AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(
+      this, &FMcpAssetPathCache::HandleAssetAdded);
+  AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(
+      this, &FMcpAssetPathCache::HandleAssetRemoved);
+  AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(
+      this, &FMcpAssetPathCache::HandleAssetRenamed);
+  FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(
+      this, &FMcpAssetPathCache::HandleFilesLoaded);
+  Entries.Empty(MaxEntries);
+  bStarted = true;
+}
+
+void FMcpAssetPathCache::Shutdown() {
+  if (!bStarted) {
+    return;
+  }
+  // The registry may already be gone during editor shutdown.
+  if (IAssetRegistry *AssetRegistry = McpFindAssetRegistry()) {
+    AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+    AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+    AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+  }
+  Entries.Empty(MaxEntries);
+  bStarted = false;
+}
+
+bool FMcpAssetPathCache::IsUsable() const {
+  if (!bStarted || !IsInGameThread()) {
+    return false;
+  }
+  // Until the initial scan finishes, "not found" only means "not found yet".
+  IAssetRegistry *AssetRegistry = McpFindAssetRegistry();
+  return AssetRegistry && !AssetRegistry->IsLoadingAssets();
+}
+
+const FMcpAssetPathCache::FEntry *
+FMcpAssetPathCache::Find(EMcpAssetPathLookup Lookup, const FString &Spelling) {
+  if (!IsUsable()) {
+    return nullptr;
+  }
+  return Entries.FindAndTouch(FKey{Lookup, Spelling});
+}
+
+void FMcpAssetPathCache::Add(EMcpAssetPathLookup Lookup,
+                             const FString &Spelling, const FEntry &Entry) {
+  if (!IsUsable()) {
+    return;
+  }
+  Entries.Add(FKey{Lookup, Spelling}, Entry);
+}
+
+void FMcpAssetPathCache::Remove(EMcpAssetPathLookup Lookup,
+                                const FString &Spelling) {
+  Entries.Remove(FKey{Lookup, Spelling});
+}
+
+void FMcpAssetPathCache::Empty() { Entries.Empty(MaxEntries); }
+
+template <typename PredicateType>
+void FMcpAssetPathCache::RemoveIf(PredicateType Predicate) {
+  if (Entries.Num() == 0) {
+    return;
+  }
+  TArray<FKey> Keys;
+  Entries.GetKeys(Keys);
+  for (const FKey &Key : Keys) {
+    const FEntry *Entry = Entries.Find(Key);
+    if (Entry && Predicate(Key, *Entry)) {
+      Entries.Remove(Key);
+    }
+  }
+}
+
+void FMcpAssetPathCache::RemovePackage(const FString &PackageName) {
+  RemoveIf([&PackageName](const FKey &, const FEntry &Entry) {
+    return Entry.bFound &&
+           FPackageName::ObjectPathToPackageName(Entry.Path).Equals(
+               PackageName, ESearchCase::IgnoreCase);
+  });
+}
+
+void FMcpAssetPathCache::HandleAssetAdded(const FAssetData &Asset) {
+  // A new asset can satisfy a spelling that found nothing, or change which
+  // asset a short name picks.
+  RemoveIf([](const FKey &Key, const FEntry &Entry) {
+    return !Entry.bFound || McpIsShortNameSpelling(Key.Spelling);
+  });
+}
+
+void FMcpAssetPathCache::HandleAssetRemoved(const FAssetData &Asset) {
+  RemovePackage(Asset.PackageName.ToString());
+}
+
+void FMcpAssetPathCache::HandleAssetRenamed(const FAssetData &Asset,
+                                            const FString &OldObjectPath) {
+  RemovePackage(FPackageName::ObjectPathToPackageName(OldObjectPath));
+  HandleAssetAdded(Asset);
+}
+
+void FMcpAssetPathCache::HandleFilesLoaded() { Empty(); }
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Delegates/IDelegateInstance.h"
+
+struct FAssetData;
+
+/** Which helper a cached resolution belongs to; each normalizes differently. */
+enum class EMcpAssetPathLookup : uint8
+{
+	ResolveAssetPath,
+	BlueprintPackage,
+	BlueprintObject,
+};
+
+/**
+ * Bounded LRU cache from the path spelling an agent sent to what the asset
+ * path helpers (ResolveAssetPath, FindBlueprintNormalizedPath,
+ * LoadBlueprintAsset) resolved it to, including spellings that resolved to
+ * nothing. Agents name the same few hundred assets
+ * over and over, and each miss otherwise costs several Asset Registry queries,
+ * a package existence check on disk, or a walk of every loaded Blueprint.
+ *
+ * Kept current from the Asset Registry: an added or renamed asset drops every
+ * negative entry and every short-name entry (either may now resolve
+ * differently), and a removed or renamed asset drops the entries that
+ * resolved to its package. Nothing is cached while the registry is still
+ * scanning, and the cache is emptied when the scan finishes.
+ *
+ * Game thread only; lookups from other threads bypass it.
+ */
+class FMcpAssetPathCache
+{
+public:
+	struct FEntry
+	{
+		/** The resolved path, or whatever path the helper still reports for a miss. */
+		FString Path;
+		/** The helper's error for a negative entry, where it reports one. */
+		FString Error;
+		bool bFound = false;
+	};
+
+	static FMcpAssetPathCache& Get();
+
+	/** Binds the Asset Registry notifications. Until then nothing is cached. */
+	void Startup();
+	void Shutdown();
+
+	/**
+	 * Returns the cached resolution of Spelling, marking it most recently used.
+	 * The pointer is only valid until the cache next changes, which loading an
+	 * asset can cause; copy the entry before doing anything that might.
+	 */
+	const FEntry* Find(EMcpAssetPathLookup Lookup, const FString& Spelling);
+
+	void Add(EMcpAssetPathLookup Lookup, const FString& Spelling, const FEntry& Entry);
+	void Remove(EMcpAssetPathLookup Lookup, const FString& Spelling);
+	void Empty();
+
+private:
+	struct FKey
+	{
+		EMcpAssetPathLookup Lookup;
+		FString Spelling;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Lookup == Other.Lookup && Spelling.Equals(Other.Spelling, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(GetTypeHash(static_cast<uint8>(Key.Lookup)), GetTypeHash(Key.Spelling));
+		}
+	};
+
+	FMcpAssetPathCache();
+
+	bool IsUsable() const;
+	template <typename PredicateType>
+	void RemoveIf(PredicateType Predicate);
+
+	void HandleAssetAdded(const FAssetData& Asset);
+	void HandleAssetRemoved(const FAssetData& Asset);
+	void HandleAssetRenamed(const FAssetData& Asset, const FString& OldObjectPath);
+	void HandleFilesLoaded();
+	void RemovePackage(const FString& PackageName);
+
+	static constexpr int32 MaxEntries = 1024;
+
+	TLruCache<FKey, FEntry> Entries;
+	bool bStarted = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Time budget and progress report for one call to FMcpAutomationJob::Step.
+ */
+class FMcpJobSlice
+{
+public:
+	explicit FMcpJobSlice(double InDeadlineSeconds) : DeadlineSeconds(InDeadlineSeconds) {}
+
+	/** False once the slice's share of the frame is used up; the job should return from Step. */
+	bool HasTimeLeft() const { return FPlatformTime::Seconds() < DeadlineSeconds; }
+
+	/** Progress sent with the job's next progress_update. Percent is 0-100, or negative when unknown. */
+	void ReportProgress(float Percent, const FString& Message)
+	{
+		ProgressPercent = Percent;
+		ProgressMessage = Message;
+		bProgressReported = true;
+	}
+
+	bool WasProgressReported() const { return bProgressReported; }
+	float GetProgressPercent() const { return ProgressPercent; }
+	const FString& GetProgressMessage() const { return ProgressMessage; }
+
+private:
+	double DeadlineSeconds = 0.0;
+	float ProgressPercent = -1.0f;
+	FString ProgressMessage;
+	bool bProgressReported = false;
+};
+
+/**
+ * Resumable work started by a handler with
+ * UMcpAutomationBridgeSubsystem::StartAutomationJob instead of running to
+ * completion inside the request. The subsystem calls Step on the game thread
+ * once per frame, within JobFrameBudgetMs, and sends progress_update messages
+ * for the request until the job finishes.
+ *
+ * Garbage collection can run between steps, so a job must not keep raw
+ * UObject pointers across Step calls; hold TWeakObjectPtr or
+ * TStrongObjectPtr instead, or look objects up again.
+ */
+class FMcpAutomationJob
+{
+public:
+	virtual ~FMcpAutomationJob() = default;
+
+	/**
+	 * Does units of work until the job is finished or Slice has no time left,
+	 * always completing at least one unit so a job whose units outlast the
+	 * budget still advances. Returns true once finished, after sending the
+	 * request's final response.
+	 */
+	virtual bool Step(FMcpJobSlice& Slice) = 0;
+
+	/**
+	 * Called instead of further steps when the job will not be resumed (the
+	 * bridge is shutting down). The subsystem answers the request with an
+	 * error afterwards.
+	 */
+	virtual void Abort() {}
+};
+
+/**
+ * A job over Num independent items: ProcessItem(Index) runs for each index in
+ * order, as many per slice as fit, then Finish runs in the same slice as the
+ * last item and sends the response. Progress is reported as "<Label> i/Num".
+ */
+class FMcpIndexedJob : public FMcpAutomationJob
+{
+public:
+	FMcpIndexedJob(int32 InNum, FString InLabel, TFunction<void(int32)> InProcessItem, TFunction<void()> InFinish)
+		: Num(InNum), Label(MoveTemp(InLabel)), ProcessItem(MoveTemp(InProcessItem)), Finish(MoveTemp(InFinish))
+	{
+	}
+
+	virtual bool Step(FMcpJobSlice& Slice) override
+	{
+		while (Next < Num)
+		{
+			ProcessItem(Next++);
+			Slice.ReportProgress(100.0f * Next / Num, FString::Printf(TEXT("%s %d/%d"), *Label, Next, Num));
+			if (!Slice.HasTimeLeft())
+			{
+				break;
+			}
+		}
+		if (Next < Num)
+		{
+			return false;
+		}
+		Finish();
+		return true;
+	}
+
+private:
+	int32 Num = 0;
+	int32 Next = 0;
+	FString Label;
+	TFunction<void(int32)> ProcessItem;
+	TFunction<void()> Finish;
+};
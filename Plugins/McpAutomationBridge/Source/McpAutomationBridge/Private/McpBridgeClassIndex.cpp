@@ -0,0 +1,212 @@
+#include "McpBridgeClassIndex.h"
+
+#include "UObject/Class.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#endif
+
+namespace {
+bool McpIsScriptClass(const UClass *Class) {
+  return Class->GetPathName().StartsWith(TEXT("/Script/"));
+}
+} // namespace
+
+FMcpClassIndex &FMcpClassIndex::Get() {
+  static FMcpClassIndex Instance;
+  return Instance;
+}
+
+void FMcpClassIndex::Startup() {
+  if (bStarted) {
+    return;
+  }
+  ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(
+      this, &FMcpClassIndex::HandleReloadComplete);
+  ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(
+      this, &FMcpClassIndex::HandleModulesChanged);
+#if WITH_EDITOR
+  if (GEditor) {
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(
+        this, &FMcpClassIndex::HandleBlueprintCompiled);
+    BlueprintReinstancedHandle = GEditor->OnBlueprintReinstanced().AddRaw(
+        this, &FMcpClassIndex::HandleBlueprintCompiled);
+  }
+  AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(
+      this, &FMcpClassIndex::HandleAssetLoaded);
+#endif
+  // Anything indexed before now missed notifications.
+  bStale = true;
+  bStarted = true;
+}
+
+void FMcpClassIndex::Shutdown() {
+  if (!bStarted) {
+    return;
+  }
+  FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+  FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+#if WITH_EDITOR
+  if (GEditor) {
+    GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    GEditor->OnBlueprintReinstanced().Remove(BlueprintReinstancedHandle);
+  }
+  FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+#endif
+  ByShortName.Empty();
+  bStale = true;
+  bStarted = false;
+}
+
+UClass *FMcpClassIndex::FindClassByShortName(const FString &Name,
+                                             const UClass *Base) {
+  TArray<UClass *> Classes;
+  FindClassesByShortName(Name, Classes);
+  for (UClass *Class : Classes) {
+    if (!Base || Class->IsChildOf(Base)) {
+      return Class;
+    }
+  }
+  return nullptr;
+}
+
+void FMcpClassIndex::FindClassesByShortName(const FString &Name,
+                                            TArray<UClass *> &OutClasses) {
+  if (Name.IsEmpty()) {
+    return;
+  }
+  const bool bRebuilt = bStale || !bStarted;
+  if (bRebuilt) {
+    Rebuild();
+  }
+  if (AppendIndexedClasses(Name, OutClasses) == 0 && !bRebuilt &&
+      IndexClassesByScan(Name)) {
+    AppendIndexedClasses(Name, OutClasses);
+  }
+}
+
+int32 FMcpClassIndex::AppendIndexedClasses(const FString &Name,
+                                           TArray<UClass *> &OutClasses) const {
+  const auto *Classes = ByShortName.Find(Name.ToLower());
+  if (!Classes) {
+    return 0;
+  }
+  const int32 FirstAdded = OutClasses.Num();
+  int32 NumScriptClasses = 0;
+  for (const TWeakObjectPtr<UClass> &Entry : *Classes) {
+    UClass *Class = Entry.Get();
+    // A Blueprint compile renames the class it replaces; that one no longer
+    // answers to this name.
+    if (!IsValid(Class) ||
+        !Class->GetName().Equals(Name, ESearchCase::IgnoreCase)) {
+      continue;
+    }
+    if (McpIsScriptClass(Class)) {
+      OutClasses.Insert(Class, FirstAdded + NumScriptClasses++);
+    } else {
+      OutClasses.Add(Class);
+    }
+  }
+  return OutClasses.Num() - FirstAdded;
+}
+
+bool FMcpClassIndex::IndexClassesByScan(const FString &Name) {
+  bool bFound = false;
+  for (TObjectIterator<UClass> It; It; ++It) {
+    if (IsValid(*It) && It->GetName().Equals(Name, ESearchCase::IgnoreCase)) {
+      AddClass(*It);
+      bFound = true;
+    }
+  }
+  return bFound;
+}
+
+UClass *FMcpClassIndex::FindClassByPathSuffix(const FString &Suffix) {
+  // The class's own name is whatever follows the last separator.
+  int32 Separator = INDEX_NONE;
+  Suffix.FindLastCharByPredicate(
+      [](TCHAR C) { return C == TEXT('.') || C == TEXT(':'); }, Separator);
+  const FString ShortName =
+      Separator == INDEX_NONE ? Suffix : Suffix.Mid(Separator + 1);
+  const FString PathSuffix = TEXT(".") + Suffix;
+
+  TArray<UClass *> Classes;
+  FindClassesByShortName(ShortName, Classes);
+  for (UClass *Class : Classes) {
+    if (Class->GetPathName().EndsWith(PathSuffix, ESearchCase::IgnoreCase)) {
+      return Class;
+    }
+  }
+  return nullptr;
+}
+
+void FMcpClassIndex::GetConcreteClasses(UClass *Base,
+                                        TArray<UClass *> &OutClasses) {
+  if (!Base) {
+    return;
+  }
+  if (!Base->HasAnyClassFlags(CLASS_Abstract)) {
+    OutClasses.Add(Base);
+  }
+  TArray<UClass *> Derived;
+  ::GetDerivedClasses(Base, Derived, /*bRecursive=*/true);
+  for (UClass *Class : Derived) {
+    if (IsValid(Class) && !Class->HasAnyClassFlags(CLASS_Abstract)) {
+      OutClasses.Add(Class);
+    }
+  }
+}
+
+void FMcpClassIndex::Rebuild() {
+  ByShortName.Reset();
+  for (TObjectIterator<UClass> It; It; ++It) {
+    AddClass(*It);
+  }
+  bStale = false;
+}
+
+void FMcpClassIndex::AddClass(UClass *Class) {
+  if (!Class) {
+    return;
+  }
+  auto &Classes = ByShortName.FindOrAdd(Class->GetName().ToLower());
+  for (const TWeakObjectPtr<UClass> &Existing : Classes) {
+    if (Existing.Get() == Class) {
+      return;
+    }
+  }
+  Classes.Add(Class);
+}
+
+void FMcpClassIndex::HandleReloadComplete(EReloadCompleteReason Reason) {
+  Invalidate();
+}
+
+void FMcpClassIndex::HandleModulesChanged(FName ModuleName,
+                                          EModuleChangeReason Reason) {
+  if (Reason == EModuleChangeReason::ModuleLoaded) {
+    Invalidate();
+  }
+}
+
+void FMcpClassIndex::HandleBlueprintCompiled() { Invalidate(); }
+
+void FMcpClassIndex::HandleAssetLoaded(UObject *Asset) {
+  // A stale table picks the new classes up when it is rebuilt.
+  if (bStale) {
+    return;
+  }
+#if WITH_EDITOR
+  if (UBlueprint *Blueprint = Cast<UBlueprint>(Asset)) {
+    AddClass(Blueprint->GeneratedClass);
+    AddClass(Blueprint->SkeletonGeneratedClass);
+    return;
+  }
+#endif
+  if (UClass *Class = Cast<UClass>(Asset)) {
+    AddClass(Class);
+  }
+}
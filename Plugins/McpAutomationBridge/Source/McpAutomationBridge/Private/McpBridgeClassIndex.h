@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/IDelegateInstance.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UClass;
+class UObject;
+
+/**
+ * Lookup of loaded classes by short name, shared by ResolveClassByName,
+ * ResolveUClass and the handlers that used to walk TObjectIterator<UClass>
+ * themselves, comparing names of every loaded class per request.
+ *
+ * The short-name table is built on first use and rebuilt on the next lookup
+ * after anything that adds or replaces classes wholesale: hot reload or Live
+ * Coding, a module load, or a Blueprint compile (which also covers a new
+ * Blueprint's first compile). Blueprint assets loaded from disk are added as
+ * they load. A class found under a name it no longer has (a compile renames
+ * the class it replaces) is skipped. A name the table does not know is
+ * checked once more against every loaded class before the lookup reports a
+ * miss, which picks up classes created without any of these notifications
+ * (e.g. generated at runtime or by script); misses cost what every lookup
+ * did before the index.
+ *
+ * Game thread only.
+ */
+class FMcpClassIndex
+{
+public:
+	static FMcpClassIndex& Get();
+
+	/** Binds the invalidation notifications. Until then every lookup rebuilds the table. */
+	void Startup();
+	void Shutdown();
+
+	/**
+	 * Returns a loaded class whose short name equals Name, ignoring case,
+	 * preferring native (/Script/) classes. Base, when given, restricts the
+	 * match to Base and its subclasses.
+	 */
+	UClass* FindClassByShortName(const FString& Name, const UClass* Base = nullptr);
+
+	/** Adds every loaded class whose short name equals Name, ignoring case, native classes first. */
+	void FindClassesByShortName(const FString& Name, TArray<UClass*>& OutClasses);
+
+	/** Returns a loaded class whose path name ends in ".Suffix", ignoring case. */
+	UClass* FindClassByPathSuffix(const FString& Suffix);
+
+	/**
+	 * Adds Base, if it is not abstract, and every non-abstract loaded class
+	 * derived from it. Reads the engine's class hierarchy hash rather than
+	 * iterating all classes.
+	 */
+	static void GetConcreteClasses(UClass* Base, TArray<UClass*>& OutClasses);
+
+	/** Drops the table; the next lookup rebuilds it. */
+	void Invalidate() { bStale = true; }
+
+private:
+	void Rebuild();
+	void AddClass(UClass* Class);
+	/** Adds the indexed classes named Name to OutClasses, native first; returns how many. */
+	int32 AppendIndexedClasses(const FString& Name, TArray<UClass*>& OutClasses) const;
+	/** Indexes every loaded class named Name; returns whether there was one. */
+	bool IndexClassesByScan(const FString& Name);
+
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void HandleBlueprintCompiled();
+	void HandleAssetLoaded(UObject* Asset);
+
+	// Lowercased short name to the classes with that name, in load order.
+	TMap<FString, TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>> ByShortName;
+	bool bStale = true;
+	bool bStarted = false;
+
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle BlueprintReinstancedHandle;
+	FDelegateHandle AssetLoadedHandle;
+};
@@ -0,0 +1,316 @@
+#include "McpBridgeDeflate.h"
+
+#include "McpAutomationBridgeSubsystem.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace {
+constexpr TCHAR McpDeflateExtensionName[] = TEXT("permessage-deflate");
+
+// Every sync-flushed message ends with this empty stored block; RFC 7692
+// strips it on the wire and the receiver appends it back.
+constexpr uint8 McpDeflateTail[] = {0x00, 0x00, 0xFF, 0xFF};
+
+// Raw deflate in zlib does not support an 8-bit window.
+constexpr int32 McpMinDeflateWindowBits = 9;
+constexpr int32 McpMaxDeflateWindowBits = 15;
+
+struct FMcpDeflateParams {
+  bool bServerNoContextTakeover = false;
+  bool bClientNoContextTakeover = false;
+  bool bHasClientMaxWindowBits = false;
+  int32 ServerMaxWindowBits = McpMaxDeflateWindowBits;
+  int32 ClientMaxWindowBits = McpMaxDeflateWindowBits;
+};
+
+bool McpParseWindowBits(const FString &Value, int32 &Out) {
+  if (Value.IsEmpty() || !Value.IsNumeric()) {
+    return false;
+  }
+  Out = FCString::Atoi(*Value);
+  return Out >= 8 && Out <= McpMaxDeflateWindowBits;
+}
+
+// Parses one "permessage-deflate; param[=value]; ..." element. Unknown,
+// duplicated or malformed parameters make the whole element unusable.
+bool McpParseDeflateElement(const FString &Element, FMcpDeflateParams &Out) {
+  TArray<FString> Tokens;
+  Element.ParseIntoArray(Tokens, TEXT(";"), true);
+  if (Tokens.Num() == 0 ||
+      !Tokens[0].TrimStartAndEnd().Equals(McpDeflateExtensionName,
+                                          ESearchCase::IgnoreCase)) {
+    return false;
+  }
+
+  TSet<FString> Seen;
+  for (int32 Index = 1; Index < Tokens.Num(); ++Index) {
+    FString Key = Tokens[Index].TrimStartAndEnd();
+    FString Value;
+    if (Key.Split(TEXT("="), &Key, &Value)) {
+      Key = Key.TrimStartAndEnd();
+      Value = Value.TrimStartAndEnd().TrimQuotes();
+    }
+    Key.ToLowerInline();
+    if (Seen.Contains(Key)) {
+      return false;
+    }
+    Seen.Add(Key);
+
+    if (Key == TEXT("server_no_context_takeover")) {
+      if (!Value.IsEmpty())
+        return false;
+      Out.bServerNoContextTakeover = true;
+    } else if (Key == TEXT("client_no_context_takeover")) {
+      if (!Value.IsEmpty())
+        return false;
+      Out.bClientNoContextTakeover = true;
+    } else if (Key == TEXT("server_max_window_bits")) {
+      if (!McpParseWindowBits(Value, Out.ServerMaxWindowBits))
+        return false;
+    } else if (Key == TEXT("client_max_window_bits")) {
+      Out.bHasClientMaxWindowBits = true;
+      if (!Value.IsEmpty() &&
+          !McpParseWindowBits(Value, Out.ClientMaxWindowBits))
+        return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+int32 McpClampWindowBits(int32 Bits) {
+  return FMath::Clamp(Bits, McpMinDeflateWindowBits, McpMaxDeflateWindowBits);
+}
+} // namespace
+
+struct FMcpPerMessageDeflate::FStreams {
+  z_stream Deflate;
+  z_stream Inflate;
+  bool bDeflateReady = false;
+  bool bInflateReady = false;
+
+  FStreams() {
+    FMemory::Memzero(Deflate);
+    FMemory::Memzero(Inflate);
+  }
+
+  ~FStreams() {
+    if (bDeflateReady) {
+      deflateEnd(&Deflate);
+    }
+    if (bInflateReady) {
+      inflateEnd(&Inflate);
+    }
+  }
+};
+
+FMcpPerMessageDeflate::FMcpPerMessageDeflate() {}
+
+FMcpPerMessageDeflate::~FMcpPerMessageDeflate() {}
+
+bool FMcpPerMessageDeflate::Activate(int32 InDeflateWindowBits,
+                                     bool bInResetDeflate,
+                                     int32 InMinMessageBytes) {
+  TUniquePtr<FStreams> NewStreams = MakeUnique<FStreams>();
+  NewStreams->bDeflateReady =
+      deflateInit2(&NewStreams->Deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                   -McpClampWindowBits(InDeflateWindowBits), 8,
+                   Z_DEFAULT_STRATEGY) == Z_OK;
+  // The inflater always uses the largest window: it accepts anything the
+  // peer produces with an equal or smaller one, whatever was negotiated.
+  NewStreams->bInflateReady =
+      inflateInit2(&NewStreams->Inflate, -McpMaxDeflateWindowBits) == Z_OK;
+  if (!NewStreams->bDeflateReady || !NewStreams->bInflateReady) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("permessage-deflate: zlib initialization failed; continuing "
+                "without compression."));
+    return false;
+  }
+
+  Streams = MoveTemp(NewStreams);
+  bResetDeflateAfterMessage = bInResetDeflate;
+  MinMessageBytes = FMath::Max(0, InMinMessageBytes);
+  bActive = true;
+  return true;
+}
+
+FString FMcpPerMessageDeflate::AcceptClientOffer(
+    const FString &OfferHeader, const FMcpDeflateConfig &Config) {
+  if (!Config.bEnabled || OfferHeader.IsEmpty()) {
+    return FString();
+  }
+  const int32 LocalBits = McpClampWindowBits(Config.MaxWindowBits);
+
+  TArray<FString> Offers;
+  OfferHeader.ParseIntoArray(Offers, TEXT(","), true);
+  for (const FString &Offer : Offers) {
+    FMcpDeflateParams Params;
+    if (!McpParseDeflateElement(Offer, Params) ||
+        Params.ServerMaxWindowBits < McpMinDeflateWindowBits) {
+      continue;
+    }
+
+    const int32 DeflateBits = FMath::Min(LocalBits, Params.ServerMaxWindowBits);
+    const bool bResetDeflate =
+        Params.bServerNoContextTakeover || Config.bNoContextTakeover;
+    if (!Activate(DeflateBits, bResetDeflate, Config.MinMessageBytes)) {
+      return FString();
+    }
+
+    FString Response = McpDeflateExtensionName;
+    if (bResetDeflate) {
+      Response += TEXT("; server_no_context_takeover");
+    }
+    if (Config.bNoContextTakeover) {
+      Response += TEXT("; client_no_context_takeover");
+    }
+    if (DeflateBits < McpMaxDeflateWindowBits) {
+      Response +=
+          FString::Printf(TEXT("; server_max_window_bits=%d"), DeflateBits);
+    }
+    // client_max_window_bits may only be answered if the client offered it.
+    if (Params.bHasClientMaxWindowBits && LocalBits < McpMaxDeflateWindowBits) {
+      Response += FString::Printf(
+          TEXT("; client_max_window_bits=%d"),
+          FMath::Min(LocalBits, Params.ClientMaxWindowBits));
+    }
+    return Response;
+  }
+  return FString();
+}
+
+FString FMcpPerMessageDeflate::BuildClientOffer(const FMcpDeflateConfig &Config) {
+  if (!Config.bEnabled) {
+    return FString();
+  }
+  const int32 LocalBits = McpClampWindowBits(Config.MaxWindowBits);
+  FString Offer = McpDeflateExtensionName;
+  if (Config.bNoContextTakeover) {
+    Offer += TEXT("; client_no_context_takeover");
+  }
+  if (LocalBits < McpMaxDeflateWindowBits) {
+    Offer += FString::Printf(
+        TEXT("; server_max_window_bits=%d; client_max_window_bits=%d"),
+        LocalBits, LocalBits);
+  } else {
+    Offer += TEXT("; client_max_window_bits");
+  }
+  return Offer;
+}
+
+bool FMcpPerMessageDeflate::ApplyServerResponse(
+    const FString &ResponseHeader, const FMcpDeflateConfig &Config) {
+  FMcpDeflateParams Params;
+  if (!Config.bEnabled || ResponseHeader.Contains(TEXT(",")) ||
+      !McpParseDeflateElement(ResponseHeader, Params) ||
+      Params.ClientMaxWindowBits < McpMinDeflateWindowBits) {
+    return false;
+  }
+  const int32 DeflateBits = FMath::Min(
+      McpClampWindowBits(Config.MaxWindowBits), Params.ClientMaxWindowBits);
+  return Activate(DeflateBits,
+                  Params.bClientNoContextTakeover || Config.bNoContextTakeover,
+                  Config.MinMessageBytes);
+}
+
+bool FMcpPerMessageDeflate::Compress(const uint8 *Data, int32 Length,
+                                     TArray<uint8> &Out) {
+  Out.Reset();
+  if (!bActive) {
+    return false;
+  }
+  z_stream &Stream = Streams->Deflate;
+  Out.SetNumUninitialized(
+      static_cast<int32>(deflateBound(&Stream, Length)) + 16);
+  Stream.next_in = const_cast<Bytef *>(Data);
+  Stream.avail_in = static_cast<uInt>(Length);
+  int32 Produced = 0;
+  for (;;) {
+    Stream.next_out = Out.GetData() + Produced;
+    Stream.avail_out = static_cast<uInt>(Out.Num() - Produced);
+    const int Result = deflate(&Stream, Z_SYNC_FLUSH);
+    Produced = Out.Num() - static_cast<int32>(Stream.avail_out);
+    if (Result != Z_OK && Result != Z_BUF_ERROR) {
+      deflateReset(&Stream);
+      Out.Reset();
+      return false;
+    }
+    // A sync flush is complete once it stops filling the output buffer.
+    if (Stream.avail_in == 0 && Stream.avail_out > 0) {
+      break;
+    }
+    Out.SetNumUninitialized(Out.Num() * 2);
+  }
+  Out.SetNum(Produced);
+
+  if (Produced >= 4 &&
+      FMemory::Memcmp(Out.GetData() + Produced - 4, McpDeflateTail, 4) == 0) {
+    Out.SetNum(Produced - 4);
+  }
+  // The window already holds this message, but it goes out uncompressed, so
+  // the peer's inflater never sees it; a later message referring back into
+  // it would not inflate.
+  if (Out.Num() >= Length) {
+    deflateReset(&Stream);
+    Out.Reset();
+    return false;
+  }
+  if (bResetDeflateAfterMessage) {
+    deflateReset(&Stream);
+  }
+  return true;
+}
+
+bool FMcpPerMessageDeflate::Decompress(const uint8 *Data, int32 Length,
+                                       uint64 MaxBytes, TArray<uint8> &Out) {
+  Out.Reset();
+  if (!bActive) {
+    return false;
+  }
+  z_stream &Stream = Streams->Inflate;
+  constexpr int32 ChunkBytes = 64 * 1024;
+
+  const uint8 *Segments[] = {Data, McpDeflateTail};
+  const int32 SegmentLengths[] = {Length, UE_ARRAY_COUNT(McpDeflateTail)};
+  for (int32 Segment = 0; Segment < 2; ++Segment) {
+    Stream.next_in = const_cast<Bytef *>(Segments[Segment]);
+    Stream.avail_in = static_cast<uInt>(SegmentLengths[Segment]);
+    while (Stream.avail_in > 0) {
+      const int32 Offset = Out.Num();
+      Out.AddUninitialized(ChunkBytes);
+      Stream.next_out = Out.GetData() + Offset;
+      Stream.avail_out = ChunkBytes;
+      const int Result = inflate(&Stream, Z_SYNC_FLUSH);
+      Out.SetNum(Out.Num() - static_cast<int32>(Stream.avail_out)
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+      , EAllowShrinking::No
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+      , false
+#endif
+      );
+      if (static_cast<uint64>(Out.Num()) > MaxBytes) {
+        inflateReset(&Stream);
+        Out.Reset();
+        return false;
+      }
+      if (Result == Z_STREAM_END) {
+        // The peer closed its deflate stream (BFINAL); the next message
+        // starts a fresh one.
+        inflateReset(&Stream);
+        return true;
+      }
+      if (Result != Z_OK && Result != Z_BUF_ERROR) {
+        inflateReset(&Stream);
+        Out.Reset();
+        return false;
+      }
+      if (Result == Z_BUF_ERROR && Stream.avail_out > 0) {
+        break;
+      }
+    }
+  }
+  return true;
+}
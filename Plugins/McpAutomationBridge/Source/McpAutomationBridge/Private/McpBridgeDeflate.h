@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+/** Local permessage-deflate preferences, taken from UMcpAutomationBridgeSettings. */
+struct FMcpDeflateConfig
+{
+	bool bEnabled = false;
+	/** LZ77 window (9-15) this endpoint compresses with, and the most it asks the peer to use. */
+	int32 MaxWindowBits = 15;
+	/** Messages smaller than this are sent uncompressed. */
+	int32 MinMessageBytes = 1024;
+	/** Reset the compressor after every message, trading ratio for memory. */
+	bool bNoContextTakeover = false;
+};
+
+/**
+ * RFC 7692 permessage-deflate for one WebSocket connection: extension
+ * negotiation during the opening handshake plus the per-message compressor
+ * and decompressor. Compress() must be called in send order (callers hold
+ * the socket's send lock), Decompress() in receive order.
+ */
+class FMcpPerMessageDeflate
+{
+public:
+	FMcpPerMessageDeflate();
+	~FMcpPerMessageDeflate();
+
+	FMcpPerMessageDeflate(const FMcpPerMessageDeflate&) = delete;
+	FMcpPerMessageDeflate& operator=(const FMcpPerMessageDeflate&) = delete;
+
+	/**
+	 * Server side: picks the first acceptable offer from the client's
+	 * Sec-WebSocket-Extensions header. Returns the response header value, or an
+	 * empty string (and stays inactive) when nothing was agreed.
+	 */
+	FString AcceptClientOffer(const FString& OfferHeader, const FMcpDeflateConfig& Config);
+
+	/** Client side: Sec-WebSocket-Extensions value to offer, or empty when disabled. */
+	static FString BuildClientOffer(const FMcpDeflateConfig& Config);
+
+	/** Client side: applies the server's response. Returns false if the response is invalid. */
+	bool ApplyServerResponse(const FString& ResponseHeader, const FMcpDeflateConfig& Config);
+
+	bool IsActive() const { return bActive; }
+	int32 GetMinMessageBytes() const { return MinMessageBytes; }
+
+	/**
+	 * Compresses one whole message. Returns false, leaving Out empty, when
+	 * compression failed or would not make the message smaller; the message
+	 * must then be sent uncompressed. The compressor is reset in that case,
+	 * because the peer never inflates those bytes and later messages must not
+	 * refer back to them.
+	 */
+	bool Compress(const uint8* Data, int32 Length, TArray<uint8>& Out);
+
+	/** Inflates one whole message, failing if the result would exceed MaxBytes. */
+	bool Decompress(const uint8* Data, int32 Length, uint64 MaxBytes, TArray<uint8>& Out);
+
+private:
+	struct FStreams;
+
+	bool Activate(int32 InDeflateWindowBits, bool bInResetDeflate, int32 InMinMessageBytes);
+
+	TUniquePtr<FStreams> Streams;
+	int32 MinMessageBytes = 0;
+	bool bResetDeflateAfterMessage = false;
+	bool bActive = false;
+};
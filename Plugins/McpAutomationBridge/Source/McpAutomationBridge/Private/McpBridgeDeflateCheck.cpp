@@ -0,0 +1,141 @@
+// Self-check for permessage-deflate context takeover.
+//
+// Usage (editor console):
+//   McpAutomationBridge.CheckDeflate
+//
+// Negotiates a client and a server FMcpPerMessageDeflate the way the opening
+// handshake does, then sends messages through them in order, exactly as
+// SendDataFrame and the receive path would: a message Compress declines goes
+// out raw and is not inflated. The sequences put an incompressible message
+// right before one that repeats it, so a compressor that kept the discarded
+// message in its window would emit back-references the receiver cannot
+// resolve. Logs one line per sequence and whether every message came back
+// byte-identical.
+
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeDeflate.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+namespace {
+struct FMcpDeflateCheckMessage {
+  TArray<uint8> Payload;
+  bool bExpectCompressed = false;
+};
+
+TArray<uint8> McpRandomBytes(FRandomStream &Stream, int32 Bytes) {
+  TArray<uint8> Out;
+  Out.SetNumUninitialized(Bytes);
+  for (uint8 &Byte : Out) {
+    Byte = static_cast<uint8>(Stream.RandRange(0, 255));
+  }
+  return Out;
+}
+
+TArray<uint8> McpRepeated(const TArray<uint8> &Chunk, int32 Times) {
+  TArray<uint8> Out;
+  Out.Reserve(Chunk.Num() * Times);
+  for (int32 Index = 0; Index < Times; ++Index) {
+    Out.Append(Chunk);
+  }
+  return Out;
+}
+
+bool RunDeflateSequence(const TCHAR *Name,
+                        const TArray<FMcpDeflateCheckMessage> &Messages,
+                        bool bNoContextTakeover) {
+  FMcpDeflateConfig Config;
+  Config.bEnabled = true;
+  Config.MinMessageBytes = 0;
+  Config.bNoContextTakeover = bNoContextTakeover;
+
+  FMcpPerMessageDeflate Server;
+  FMcpPerMessageDeflate Client;
+  const FString Response = Server.AcceptClientOffer(
+      FMcpPerMessageDeflate::BuildClientOffer(Config), Config);
+  if (Response.IsEmpty() || !Client.ApplyServerResponse(Response, Config)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+           TEXT("CheckDeflate %s: negotiation failed (response '%s')."), Name,
+           *Response);
+    return false;
+  }
+
+  TArray<uint8> Compressed;
+  TArray<uint8> Inflated;
+  for (int32 Index = 0; Index < Messages.Num(); ++Index) {
+    const TArray<uint8> &Payload = Messages[Index].Payload;
+    const bool bCompressed =
+        Client.Compress(Payload.GetData(), Payload.Num(), Compressed);
+    if (bCompressed != Messages[Index].bExpectCompressed) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("CheckDeflate %s: message %d (%d bytes) was %s, expected "
+                  "%s."),
+             Name, Index, Payload.Num(),
+             bCompressed ? TEXT("compressed") : TEXT("sent raw"),
+             Messages[Index].bExpectCompressed ? TEXT("compressed")
+                                               : TEXT("sent raw"));
+      return false;
+    }
+    if (!bCompressed) {
+      // Sent with RSV1 clear: the receiver takes the bytes as they are.
+      continue;
+    }
+    if (!Server.Decompress(Compressed.GetData(), Compressed.Num(),
+                           static_cast<uint64>(Payload.Num()), Inflated) ||
+        Inflated != Payload) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("CheckDeflate %s: message %d (%d bytes, %d compressed) did "
+                  "not inflate back to the original."),
+             Name, Index, Payload.Num(), Compressed.Num());
+      return false;
+    }
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+         TEXT("CheckDeflate %s: %d messages round-tripped."), Name,
+         Messages.Num());
+  return true;
+}
+
+void RunDeflateCheck() {
+  FRandomStream Stream(7);
+  const TArray<uint8> Noise = McpRandomBytes(Stream, 4096);
+  const FString Text =
+      TEXT("{\"type\":\"automation_response\",\"success\":true,"
+           "\"result\":{\"actors\":[\"StaticMeshActor_0\"]}}");
+  const FTCHARToUTF8 TextUtf8(*Text);
+  const TArray<uint8> TextChunk(
+      reinterpret_cast<const uint8 *>(TextUtf8.Get()), TextUtf8.Length());
+
+  // The noise goes out raw; the repeat of it must not refer back to it.
+  const TArray<FMcpDeflateCheckMessage> NoiseThenRepeat = {
+      {Noise, false},
+      {McpRepeated(Noise, 3), true},
+  };
+  // History built up before the raw message must survive on the sender only
+  // as far as the receiver also has it.
+  const TArray<FMcpDeflateCheckMessage> TextNoiseText = {
+      {McpRepeated(TextChunk, 32), true},
+      {Noise, false},
+      {McpRepeated(TextChunk, 32), true},
+      {McpRepeated(Noise, 2), true},
+  };
+
+  bool bPassed = true;
+  bPassed &= RunDeflateSequence(TEXT("noise_then_repeat"), NoiseThenRepeat,
+                                false);
+  bPassed &= RunDeflateSequence(TEXT("text_noise_text"), TextNoiseText, false);
+  bPassed &= RunDeflateSequence(TEXT("no_context_takeover"), TextNoiseText,
+                                true);
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display, TEXT("CheckDeflate: %s"),
+         bPassed ? TEXT("passed") : TEXT("FAILED"));
+}
+
+FAutoConsoleCommand GMcpBridgeDeflateCheckCommand(
+    TEXT("McpAutomationBridge.CheckDeflate"),
+    TEXT("Round-trips compressible and incompressible messages through a "
+         "negotiated permessage-deflate pair and checks every message inflates "
+         "back to the original."),
+    FConsoleCommandDelegate::CreateStatic(&RunDeflateCheck));
+} // namespace
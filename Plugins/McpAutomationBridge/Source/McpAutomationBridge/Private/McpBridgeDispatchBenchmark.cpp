@@ -0,0 +1,98 @@
+// Microbenchmark for automation action routing.
+//
+// Usage (editor console):
+//   McpAutomationBridge.BenchmarkDispatch [Iterations=2000]
+//
+// Resolves every registered action name, a set of prefix-routed names and a
+// set of unknown names through the same route lookup the dispatcher runs for
+// each request, without invoking any handler. Results are logged as mean
+// nanoseconds per lookup for each group.
+
+#include "McpAutomationBridgeSubsystem.h"
+
+#include "Editor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace {
+struct FMcpDispatchBenchmarkGroup {
+  const TCHAR *Name;
+  TArray<FString> Actions;
+  double TotalSeconds = 0.0;
+  int64 Lookups = 0;
+  int32 Unrouted = 0;
+};
+
+void RunDispatchBenchmarkGroup(const UMcpAutomationBridgeSubsystem &Subsystem,
+                               FMcpDispatchBenchmarkGroup &Group,
+                               int32 Iterations) {
+  if (Group.Actions.Num() == 0) {
+    return;
+  }
+  for (const FString &Action : Group.Actions) {
+    if (Subsystem.CountAutomationRouteCandidates(Action) == 0) {
+      ++Group.Unrouted;
+    }
+  }
+
+  int64 Sink = 0;
+  const double StartSeconds = FPlatformTime::Seconds();
+  for (int32 Iteration = 0; Iteration < Iterations; ++Iteration) {
+    for (const FString &Action : Group.Actions) {
+      Sink += Subsystem.CountAutomationRouteCandidates(Action);
+    }
+  }
+  Group.TotalSeconds = FPlatformTime::Seconds() - StartSeconds;
+  Group.Lookups = static_cast<int64>(Iterations) * Group.Actions.Num();
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("BenchmarkDispatch %s checksum=%lld"), Group.Name, Sink);
+}
+
+void RunDispatchBenchmark(const TArray<FString> &Args) {
+  const int32 Iterations =
+      Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+
+  UMcpAutomationBridgeSubsystem *Subsystem =
+      GEditor ? GEditor->GetEditorSubsystem<UMcpAutomationBridgeSubsystem>()
+              : nullptr;
+  if (!Subsystem) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("BenchmarkDispatch: automation bridge subsystem not available."));
+    return;
+  }
+
+  FMcpDispatchBenchmarkGroup Registered{TEXT("registered")};
+  Registered.Actions = Subsystem->GetRegisteredAutomationActions();
+
+  FMcpDispatchBenchmarkGroup Prefixed{TEXT("prefix")};
+  Prefixed.Actions = {TEXT("sequence_add_track"),   TEXT("audio_play"),
+                      TEXT("create_sound_cue"),     TEXT("add_force_module"),
+                      TEXT("enable_gpu_timing"),    TEXT("set_vsync"),
+                      TEXT("configure_shadows"),    TEXT("blueprint_add_node"),
+                      TEXT("control_editor_focus"), TEXT("spawn_sky_light")};
+
+  FMcpDispatchBenchmarkGroup Unknown{TEXT("unknown")};
+  for (int32 Index = 0; Index < 32; ++Index) {
+    Unknown.Actions.Add(FString::Printf(TEXT("nonexistent_action_%d"), Index));
+    Unknown.Actions.Add(FString::Printf(TEXT("set_unknown_option_%d"), Index));
+  }
+
+  FMcpDispatchBenchmarkGroup *Groups[] = {&Registered, &Prefixed, &Unknown};
+  for (FMcpDispatchBenchmarkGroup *Group : Groups) {
+    RunDispatchBenchmarkGroup(*Subsystem, *Group, Iterations);
+    const double NanosPerLookup =
+        Group->Lookups > 0 ? Group->TotalSeconds * 1.0e9 / Group->Lookups : 0.0;
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+           TEXT("BenchmarkDispatch %s: %d actions x %d iterations, %.1f ns "
+                "per lookup, %d unrouted"),
+           Group->Name, Group->Actions.Num(), Iterations, NanosPerLookup,
+           Group->Unrouted);
+  }
+}
+
+FAutoConsoleCommand GMcpBridgeDispatchBenchmarkCommand(
+    TEXT("McpAutomationBridge.BenchmarkDispatch"),
+    TEXT("Measures automation action route lookup cost for registered, "
+         "prefix-routed and unknown actions. Args: [Iterations]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunDispatchBenchmark));
+} // namespace
@@ -0,0 +1,233 @@
+// Benchmark for the negotiated automation frame encodings.
+//
+// Usage (editor console):
+//   McpAutomationBridge.BenchmarkEncoding [Iterations=5] [Scale=1.0]
+//
+// Builds representative large automation results (a get_mesh_info vertex
+// dump, list_actors on a 50k-actor map and a foliage instance list), then
+// encodes and decodes each as JSON text and as MessagePack. Results are
+// logged as wire bytes plus mean encode and decode milliseconds. JSON sizes
+// are UTF-8, as sent on the socket. "stream" is the same DOM written by
+// FMcpJsonStreamWriter straight to UTF-8, as SendAutomationResponse now
+// does, and "stream msgpack" the same writer producing MessagePack, as
+// streamed responses to MessagePack connections do; its output must be
+// byte-identical to McpMessagePack::Encode. Scale multiplies every element
+// count.
+
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeMessagePack.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace {
+TSharedPtr<FJsonValue> McpBenchVector(FRandomStream &Stream, float Range) {
+  TArray<TSharedPtr<FJsonValue>> Components;
+  for (int32 Axis = 0; Axis < 3; ++Axis) {
+    Components.Add(
+        MakeShared<FJsonValueNumber>(Stream.FRandRange(-Range, Range)));
+  }
+  return MakeShared<FJsonValueArray>(Components);
+}
+
+TSharedRef<FJsonObject> McpBenchMeshInfo(int32 VertexCount) {
+  FRandomStream Stream(1);
+  TArray<TSharedPtr<FJsonValue>> Vertices;
+  TArray<TSharedPtr<FJsonValue>> Normals;
+  TArray<TSharedPtr<FJsonValue>> Indices;
+  Vertices.Reserve(VertexCount);
+  Normals.Reserve(VertexCount);
+  Indices.Reserve(VertexCount * 3);
+  for (int32 Index = 0; Index < VertexCount; ++Index) {
+    Vertices.Add(McpBenchVector(Stream, 500.0f));
+    Normals.Add(McpBenchVector(Stream, 1.0f));
+    for (int32 Corner = 0; Corner < 3; ++Corner) {
+      Indices.Add(
+          MakeShared<FJsonValueNumber>(Stream.RandRange(0, VertexCount - 1)));
+    }
+  }
+  TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetStringField(TEXT("meshPath"), TEXT("/Game/Meshes/SM_Benchmark"));
+  Result->SetNumberField(TEXT("vertexCount"), VertexCount);
+  Result->SetArrayField(TEXT("vertices"), Vertices);
+  Result->SetArrayField(TEXT("normals"), Normals);
+  Result->SetArrayField(TEXT("indices"), Indices);
+  return Result;
+}
+
+TSharedRef<FJsonObject> McpBenchListActors(int32 ActorCount) {
+  static const TCHAR *const Classes[] = {TEXT("StaticMeshActor"),
+                                         TEXT("PointLight"),
+                                         TEXT("BP_Pickup_C"), TEXT("Decal")};
+  FRandomStream Stream(2);
+  TArray<TSharedPtr<FJsonValue>> Actors;
+  Actors.Reserve(ActorCount);
+  for (int32 Index = 0; Index < ActorCount; ++Index) {
+    const TCHAR *Class = Classes[Index % UE_ARRAY_COUNT(Classes)];
+    TSharedRef<FJsonObject> Actor = MakeShared<FJsonObject>();
+    Actor->SetStringField(TEXT("name"),
+                          FString::Printf(TEXT("%s_%d"), Class, Index));
+    Actor->SetStringField(TEXT("label"),
+                          FString::Printf(TEXT("%s %d"), Class, Index));
+    Actor->SetStringField(TEXT("class"), Class);
+    Actor->SetStringField(
+        TEXT("path"),
+        FString::Printf(TEXT("/Game/Maps/Main.Main:PersistentLevel.%s_%d"),
+                        Class, Index));
+    Actor->SetField(TEXT("location"), McpBenchVector(Stream, 100000.0f));
+    Actor->SetField(TEXT("rotation"), McpBenchVector(Stream, 180.0f));
+    Actor->SetBoolField(TEXT("hidden"), false);
+    Actors.Add(MakeShared<FJsonValueObject>(Actor));
+  }
+  TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetNumberField(TEXT("count"), ActorCount);
+  Result->SetArrayField(TEXT("actors"), Actors);
+  return Result;
+}
+
+TSharedRef<FJsonObject> McpBenchFoliage(int32 InstanceCount) {
+  FRandomStream Stream(3);
+  TArray<TSharedPtr<FJsonValue>> Instances;
+  Instances.Reserve(InstanceCount);
+  for (int32 Index = 0; Index < InstanceCount; ++Index) {
+    TSharedRef<FJsonObject> Instance = MakeShared<FJsonObject>();
+    Instance->SetField(TEXT("location"), McpBenchVector(Stream, 50000.0f));
+    Instance->SetField(TEXT("rotation"), McpBenchVector(Stream, 180.0f));
+    Instance->SetNumberField(TEXT("scale"), Stream.FRandRange(0.8f, 1.2f));
+    Instances.Add(MakeShared<FJsonValueObject>(Instance));
+  }
+  TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+  Result->SetStringField(TEXT("foliageType"), TEXT("/Game/Foliage/FT_Grass"));
+  Result->SetArrayField(TEXT("instances"), Instances);
+  return Result;
+}
+
+// Wraps Result the way SendAutomationResponse does.
+TSharedRef<FJsonObject> McpBenchResponse(const TSharedRef<FJsonObject> &Result) {
+  TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+  Response->SetStringField(TEXT("type"), TEXT("automation_response"));
+  Response->SetStringField(TEXT("requestId"), TEXT("bench-1"));
+  Response->SetBoolField(TEXT("success"), true);
+  Response->SetStringField(TEXT("error"), TEXT(""));
+  Response->SetObjectField(TEXT("result"), Result);
+  return Response;
+}
+
+void RunEncodingBenchmarkCase(const TCHAR *Name,
+                              const TSharedRef<FJsonObject> &Response,
+                              int32 Iterations) {
+  int64 JsonBytes = 0;
+  int64 PackedBytes = 0;
+  double JsonEncodeSeconds = 0.0;
+  double JsonDecodeSeconds = 0.0;
+  double StreamEncodeSeconds = 0.0;
+  double StreamPackSeconds = 0.0;
+  double PackEncodeSeconds = 0.0;
+  double PackDecodeSeconds = 0.0;
+  int32 DecodeFailures = 0;
+
+  for (int32 Iteration = 0; Iteration < Iterations; ++Iteration) {
+    double Start = FPlatformTime::Seconds();
+    FString Serialized;
+    const TSharedRef<TJsonWriter<>> Writer =
+        TJsonWriterFactory<>::Create(&Serialized);
+    FJsonSerializer::Serialize(Response, Writer);
+    const FTCHARToUTF8 Utf8(*Serialized, Serialized.Len());
+    JsonEncodeSeconds += FPlatformTime::Seconds() - Start;
+    JsonBytes = Utf8.Length();
+
+    Start = FPlatformTime::Seconds();
+    TSharedPtr<FJsonObject> Parsed;
+    const TSharedRef<TJsonReader<>> Reader =
+        TJsonReaderFactory<>::Create(Serialized);
+    if (!FJsonSerializer::Deserialize(Reader, Parsed) || !Parsed.IsValid()) {
+      ++DecodeFailures;
+    }
+    JsonDecodeSeconds += FPlatformTime::Seconds() - Start;
+
+    Start = FPlatformTime::Seconds();
+    {
+      FMcpJsonStreamWriter StreamWriter;
+      StreamWriter.WriteJsonObject(*Response);
+      StreamEncodeSeconds += FPlatformTime::Seconds() - Start;
+    }
+
+    Start = FPlatformTime::Seconds();
+    TArray<uint8> Packed;
+    McpMessagePack::Encode(Response, Packed);
+    PackEncodeSeconds += FPlatformTime::Seconds() - Start;
+    PackedBytes = Packed.Num();
+
+    Start = FPlatformTime::Seconds();
+    {
+      FMcpJsonStreamWriter StreamPacker(EMcpStreamFormat::MessagePack);
+      StreamPacker.WriteJsonObject(*Response);
+      StreamPackSeconds += FPlatformTime::Seconds() - Start;
+      if (StreamPacker.GetPayloadSize() != Packed.Num() ||
+          FMemory::Memcmp(StreamPacker.GetPayloadData(), Packed.GetData(),
+                          Packed.Num()) != 0) {
+        ++DecodeFailures;
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("BenchmarkEncoding %s: streamed MessagePack (%d bytes) "
+                    "differs from McpMessagePack::Encode (%d bytes)"),
+               Name, StreamPacker.GetPayloadSize(), Packed.Num());
+      }
+    }
+
+    Start = FPlatformTime::Seconds();
+    FString Error;
+    if (!McpMessagePack::Decode(Packed.GetData(), Packed.Num(), Error)
+             .IsValid()) {
+      ++DecodeFailures;
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("BenchmarkEncoding %s: MessagePack decode failed: %s"), Name,
+             *Error);
+    }
+    PackDecodeSeconds += FPlatformTime::Seconds() - Start;
+  }
+
+  const double ToMs = 1000.0 / Iterations;
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+         TEXT("BenchmarkEncoding %s: json %lld bytes enc %.2f ms dec %.2f ms | "
+              "stream enc %.2f ms | stream msgpack enc %.2f ms | "
+              "msgpack %lld bytes (%.0f%%) enc %.2f ms dec %.2f ms%s"),
+         Name, JsonBytes, JsonEncodeSeconds * ToMs, JsonDecodeSeconds * ToMs,
+         StreamEncodeSeconds * ToMs, StreamPackSeconds * ToMs,
+         PackedBytes,
+         JsonBytes > 0 ? 100.0 * PackedBytes / JsonBytes : 0.0,
+         PackEncodeSeconds * ToMs, PackDecodeSeconds * ToMs,
+         DecodeFailures > 0 ? TEXT(" (decode failures or mismatches)")
+                            : TEXT(""));
+}
+
+void RunEncodingBenchmark(const TArray<FString> &Args) {
+  const int32 Iterations =
+      Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5;
+  const float Scale =
+      Args.Num() > 1 ? FMath::Max(0.01f, FCString::Atof(*Args[1])) : 1.0f;
+  auto Scaled = [Scale](int32 Count) {
+    return FMath::Max(1, FMath::RoundToInt(Count * Scale));
+  };
+
+  RunEncodingBenchmarkCase(
+      TEXT("get_mesh_info"),
+      McpBenchResponse(McpBenchMeshInfo(Scaled(20000))), Iterations);
+  RunEncodingBenchmarkCase(
+      TEXT("list_actors"),
+      McpBenchResponse(McpBenchListActors(Scaled(50000))), Iterations);
+  RunEncodingBenchmarkCase(
+      TEXT("foliage_instances"),
+      McpBenchResponse(McpBenchFoliage(Scaled(20000))), Iterations);
+}
+
+FAutoConsoleCommand GMcpBridgeEncodingBenchmarkCommand(
+    TEXT("McpAutomationBridge.BenchmarkEncoding"),
+    TEXT("Compares JSON and MessagePack size and encode/decode time on large "
+         "representative automation responses. Args: [Iterations] [Scale]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunEncodingBenchmark));
+} // namespace
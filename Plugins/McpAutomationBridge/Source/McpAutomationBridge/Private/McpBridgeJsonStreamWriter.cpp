@@ -0,0 +1,419 @@
+#include "McpBridgeJsonStreamWriter.h"
+
+#include "Containers/StringConv.h"
+#include "McpBridgeMessagePack.h"
+#include "Misc/ScopeLock.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace {
+// Send buffers are recycled between responses so a steady stream of large
+// results does not reallocate and page-fault a fresh buffer every time.
+constexpr int32 McpSendBufferPoolSize = 8;
+// Buffers that grew past this (one-off huge responses) are freed instead.
+constexpr int32 McpSendBufferRetainBytes = 8 * 1024 * 1024;
+// A MessagePack container starts with a map32/array32 header (marker plus
+// 4-byte length) until its length is known.
+constexpr int32 McpMessagePackContainerHeaderBytes = 5;
+
+FCriticalSection GMcpSendBufferPoolMutex;
+TArray<TArray<uint8>> GMcpSendBufferPool;
+
+TArray<uint8> McpAcquireSendBuffer() {
+  FScopeLock Lock(&GMcpSendBufferPoolMutex);
+  if (GMcpSendBufferPool.Num() > 0) {
+    TArray<uint8> Recycled = GMcpSendBufferPool.Pop();
+    Recycled.Reset();
+    return Recycled;
+  }
+  return TArray<uint8>();
+}
+
+void McpReleaseSendBuffer(TArray<uint8> &&Buffer) {
+  if (Buffer.Max() == 0 || Buffer.Max() > McpSendBufferRetainBytes) {
+    return;
+  }
+  FScopeLock Lock(&GMcpSendBufferPoolMutex);
+  if (GMcpSendBufferPool.Num() < McpSendBufferPoolSize) {
+    GMcpSendBufferPool.Add(MoveTemp(Buffer));
+  }
+}
+
+void McpSetNumKeepSlack(TArray<uint8> &Buffer, int32 NewNum) {
+  Buffer.SetNumUninitialized(NewNum
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+      , EAllowShrinking::No
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+      , false
+#endif
+  );
+}
+} // namespace
+
+FMcpJsonStreamWriter::FMcpJsonStreamWriter(EMcpStreamFormat InFormat)
+    : Format(InFormat), Buffer(McpAcquireSendBuffer()) {
+  Buffer.AddZeroed(FrameHeaderReserve);
+}
+
+FMcpJsonStreamWriter::~FMcpJsonStreamWriter() {
+  McpReleaseSendBuffer(MoveTemp(Buffer));
+}
+
+void FMcpJsonStreamWriter::BeginElement() {
+  if (Scopes.Num() > 0) {
+    FScope &Scope = Scopes.Last();
+    if (Scope.NumElements > 0 && Format == EMcpStreamFormat::Json) {
+      AppendByte(',');
+    }
+    ++Scope.NumElements;
+  }
+}
+
+void FMcpJsonStreamWriter::BeginValue() {
+  if (bAfterKey) {
+    bAfterKey = false;
+    return;
+  }
+  BeginElement();
+}
+
+void FMcpJsonStreamWriter::WriteKey(FStringView Key) {
+  BeginElement();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    McpMessagePack::EncodeString(Key, Buffer);
+  } else {
+    AppendEscaped(Key);
+    AppendByte(':');
+  }
+  bAfterKey = true;
+}
+
+void FMcpJsonStreamWriter::OpenContainer(uint8 Marker32, ANSICHAR Open) {
+  BeginValue();
+  FScope &Scope = Scopes.AddDefaulted_GetRef();
+  Scope.HeaderOffset = Buffer.Num();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    AppendByte(Marker32);
+    Buffer.AddZeroed(McpMessagePackContainerHeaderBytes - 1);
+  } else {
+    AppendByte(static_cast<uint8>(Open));
+  }
+}
+
+void FMcpJsonStreamWriter::CloseContainer(uint8 FixMarker, uint8 Marker16,
+                                          uint8 Marker32, ANSICHAR Close) {
+  check(Scopes.Num() > 0);
+  const FScope Scope = Scopes.Pop(
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+      EAllowShrinking::No
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+      false
+#endif
+  );
+  if (Format == EMcpStreamFormat::Json) {
+    AppendByte(static_cast<uint8>(Close));
+    return;
+  }
+
+  // Use the smallest header, as McpMessagePack::Encode does, and move the
+  // members down over the unused placeholder bytes.
+  const uint32 Count = static_cast<uint32>(Scope.NumElements);
+  uint8 Header[McpMessagePackContainerHeaderBytes];
+  int32 HeaderSize = 0;
+  if (Count < 16) {
+    Header[HeaderSize++] = static_cast<uint8>(FixMarker | Count);
+  } else if (Count <= 0xFFFF) {
+    Header[HeaderSize++] = Marker16;
+    Header[HeaderSize++] = static_cast<uint8>(Count >> 8);
+    Header[HeaderSize++] = static_cast<uint8>(Count);
+  } else {
+    Header[HeaderSize++] = Marker32;
+    for (int32 Shift = 24; Shift >= 0; Shift -= 8) {
+      Header[HeaderSize++] = static_cast<uint8>(Count >> Shift);
+    }
+  }
+  uint8 *Start = Buffer.GetData() + Scope.HeaderOffset;
+  const int32 Unused = McpMessagePackContainerHeaderBytes - HeaderSize;
+  if (Unused > 0) {
+    const int32 BodyBytes = Buffer.Num() - Scope.HeaderOffset -
+                            McpMessagePackContainerHeaderBytes;
+    FMemory::Memmove(Start + HeaderSize,
+                     Start + McpMessagePackContainerHeaderBytes, BodyBytes);
+    McpSetNumKeepSlack(Buffer, Buffer.Num() - Unused);
+  }
+  FMemory::Memcpy(Start, Header, HeaderSize);
+}
+
+void FMcpJsonStreamWriter::BeginObject() { OpenContainer(0xdf, '{'); }
+
+void FMcpJsonStreamWriter::BeginObject(FStringView Key) {
+  WriteKey(Key);
+  BeginObject();
+}
+
+void FMcpJsonStreamWriter::EndObject() {
+  CloseContainer(0x80, 0xde, 0xdf, '}');
+}
+
+void FMcpJsonStreamWriter::BeginArray() { OpenContainer(0xdd, '['); }
+
+void FMcpJsonStreamWriter::BeginArray(FStringView Key) {
+  WriteKey(Key);
+  BeginArray();
+}
+
+void FMcpJsonStreamWriter::EndArray() { CloseContainer(0x90, 0xdc, 0xdd, ']'); }
+
+void FMcpJsonStreamWriter::WriteString(FStringView Value) {
+  BeginValue();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    McpMessagePack::EncodeString(Value, Buffer);
+  } else {
+    AppendEscaped(Value);
+  }
+}
+
+void FMcpJsonStreamWriter::WriteNumber(double Value) {
+  if (!FMath::IsFinite(Value)) {
+    // JSON has no NaN/Infinity literals; MessagePack output matches JSON.
+    WriteNull();
+    return;
+  }
+  BeginValue();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    McpMessagePack::EncodeNumber(Value, Buffer);
+    return;
+  }
+  ANSICHAR Text[40];
+  int32 Length;
+  if (Value == FMath::TruncToDouble(Value) && FMath::Abs(Value) < 9007199254740992.0) {
+    Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld",
+                                    static_cast<long long>(Value));
+  } else {
+    // Shortest of the two precisions that still round-trips.
+    Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.15g", Value);
+    if (FCStringAnsi::Atod(Text) != Value) {
+      Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%.17g", Value);
+    }
+  }
+  AppendAscii(Text, Length);
+}
+
+void FMcpJsonStreamWriter::WriteInteger(int64 Value) {
+  BeginValue();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    McpMessagePack::EncodeInteger(Value, Buffer);
+    return;
+  }
+  ANSICHAR Text[24];
+  const int32 Length = FCStringAnsi::Snprintf(Text, sizeof(Text), "%lld",
+                                              static_cast<long long>(Value));
+  AppendAscii(Text, Length);
+}
+
+void FMcpJsonStreamWriter::WriteBool(bool bValue) {
+  BeginValue();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    AppendByte(bValue ? 0xc3 : 0xc2);
+  } else if (bValue) {
+    AppendAscii("true", 4);
+  } else {
+    AppendAscii("false", 5);
+  }
+}
+
+void FMcpJsonStreamWriter::WriteNull() {
+  BeginValue();
+  if (Format == EMcpStreamFormat::MessagePack) {
+    AppendByte(0xc0);
+  } else {
+    AppendAscii("null", 4);
+  }
+}
+
+void FMcpJsonStreamWriter::WriteJsonValue(const TSharedPtr<FJsonValue> &Value) {
+  if (!Value.IsValid()) {
+    WriteNull();
+    return;
+  }
+  switch (Value->Type) {
+  case EJson::String:
+    WriteString(Value->AsString());
+    break;
+  case EJson::Number:
+    WriteNumber(Value->AsNumber());
+    break;
+  case EJson::Boolean:
+    WriteBool(Value->AsBool());
+    break;
+  case EJson::Array:
+    BeginArray();
+    for (const TSharedPtr<FJsonValue> &Element : Value->AsArray()) {
+      WriteJsonValue(Element);
+    }
+    EndArray();
+    break;
+  case EJson::Object: {
+    const TSharedPtr<FJsonObject> &Object = Value->AsObject();
+    if (Object.IsValid()) {
+      WriteJsonObject(*Object);
+    } else {
+      WriteNull();
+    }
+    break;
+  }
+  default:
+    WriteNull();
+    break;
+  }
+}
+
+void FMcpJsonStreamWriter::WriteJsonObject(const FJsonObject &Object) {
+  BeginObject();
+  WriteJsonObjectFields(Object);
+  EndObject();
+}
+
+void FMcpJsonStreamWriter::WriteJsonObjectFields(const FJsonObject &Object) {
+  for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Object.Values) {
+    WriteKey(Pair.Key);
+    WriteJsonValue(Pair.Value);
+  }
+}
+
+void FMcpJsonStreamWriter::WriteRawValue(const uint8 *Utf8, int32 Length) {
+  checkf(Format == EMcpStreamFormat::Json,
+         TEXT("WriteRawValue appends JSON text"));
+  BeginValue();
+  if (Length > 0) {
+    Buffer.Append(Utf8, Length);
+  }
+}
+
+void FMcpJsonStreamWriter::Reset() {
+  McpSetNumKeepSlack(Buffer, FrameHeaderReserve);
+  Scopes.Reset();
+  bAfterKey = false;
+}
+
+void FMcpJsonStreamWriter::AppendAscii(const ANSICHAR *Text, int32 Length) {
+  if (Length > 0) {
+    Buffer.Append(reinterpret_cast<const uint8 *>(Text), Length);
+  }
+}
+
+void FMcpJsonStreamWriter::AppendEscaped(FStringView Value) {
+  static const ANSICHAR HexDigits[] = "0123456789abcdef";
+  const TCHAR *Chars = Value.GetData();
+  const int32 Length = Value.Len();
+
+  // Most text is ASCII: size for that and grow only when escapes or
+  // multi-byte sequences need more room.
+  int32 Pos = Buffer.Num();
+  McpSetNumKeepSlack(Buffer, Pos + Length + 2);
+  uint8 *Out = Buffer.GetData();
+  Out[Pos++] = '"';
+
+  for (int32 Index = 0; Index < Length; ++Index) {
+    // Worst case per input char: a 6-byte \u escape or a 4-byte sequence,
+    // plus the closing quote.
+    if (Buffer.Num() - Pos < 8) {
+      McpSetNumKeepSlack(Buffer, Pos + (Length - Index) * 2 + 16);
+      Out = Buffer.GetData();
+    }
+
+    uint32 Code = static_cast<uint32>(Chars[Index]);
+    if (Code < 0x80) {
+      if (Code >= 0x20 && Code != '"' && Code != '\\') {
+        Out[Pos++] = static_cast<uint8>(Code);
+        continue;
+      }
+      Out[Pos++] = '\\';
+      switch (Code) {
+      case '"':
+        Out[Pos++] = '"';
+        break;
+      case '\\':
+        Out[Pos++] = '\\';
+        break;
+      case '\b':
+        Out[Pos++] = 'b';
+        break;
+      case '\f':
+        Out[Pos++] = 'f';
+        break;
+      case '\n':
+        Out[Pos++] = 'n';
+        break;
+      case '\r':
+        Out[Pos++] = 'r';
+        break;
+      case '\t':
+        Out[Pos++] = 't';
+        break;
+      default:
+        Out[Pos++] = 'u';
+        Out[Pos++] = '0';
+        Out[Pos++] = '0';
+        Out[Pos++] = HexDigits[(Code >> 4) & 0xF];
+        Out[Pos++] = HexDigits[Code & 0xF];
+        break;
+      }
+      continue;
+    }
+
+    // UTF-16 TCHAR: combine surrogate pairs; lone surrogates become U+FFFD.
+    if (Code >= 0xD800 && Code <= 0xDBFF && Index + 1 < Length) {
+      const uint32 Low = static_cast<uint32>(Chars[Index + 1]);
+      if (Low >= 0xDC00 && Low <= 0xDFFF) {
+        Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+        ++Index;
+      }
+    }
+    if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF) {
+      Code = 0xFFFD;
+    }
+
+    if (Code < 0x800) {
+      Out[Pos++] = static_cast<uint8>(0xC0 | (Code >> 6));
+      Out[Pos++] = static_cast<uint8>(0x80 | (Code & 0x3F));
+    } else if (Code < 0x10000) {
+      Out[Pos++] = static_cast<uint8>(0xE0 | (Code >> 12));
+      Out[Pos++] = static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F));
+      Out[Pos++] = static_cast<uint8>(0x80 | (Code & 0x3F));
+    } else {
+      Out[Pos++] = static_cast<uint8>(0xF0 | (Code >> 18));
+      Out[Pos++] = static_cast<uint8>(0x80 | ((Code >> 12) & 0x3F));
+      Out[Pos++] = static_cast<uint8>(0x80 | ((Code >> 6) & 0x3F));
+      Out[Pos++] = static_cast<uint8>(0x80 | (Code & 0x3F));
+    }
+  }
+
+  if (Pos >= Buffer.Num()) {
+    McpSetNumKeepSlack(Buffer, Pos + 1);
+    Out = Buffer.GetData();
+  }
+  Out[Pos++] = '"';
+  McpSetNumKeepSlack(Buffer, Pos);
+}
+
+FString FMcpJsonStreamWriter::ToString() const {
+  const FUTF8ToTCHAR Converted(
+      reinterpret_cast<const ANSICHAR *>(GetPayloadData()), GetPayloadSize());
+  return FString(Converted.Length(), Converted.Get());
+}
+
+TSharedPtr<FJsonObject> FMcpJsonStreamWriter::ParsePayload() const {
+  if (Format == EMcpStreamFormat::MessagePack) {
+    FString Error;
+    return McpMessagePack::Decode(GetPayloadData(), GetPayloadSize(), Error);
+  }
+  TSharedPtr<FJsonObject> Parsed;
+  const TSharedRef<TJsonReader<>> Reader =
+      TJsonReaderFactory<>::Create(ToString());
+  if (!FJsonSerializer::Deserialize(Reader, Parsed)) {
+    return nullptr;
+  }
+  return Parsed;
+}
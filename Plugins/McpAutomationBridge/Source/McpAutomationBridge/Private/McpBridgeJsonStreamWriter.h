@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Dom/JsonObject.h"
+
+class FMcpResponseChunkSink;
+
+/** What an FMcpJsonStreamWriter encodes the document as. */
+enum class EMcpStreamFormat : uint8
+{
+	Json,
+	/** McpMessagePack's mapping of the same document, for connections that negotiated it. */
+	MessagePack,
+};
+
+/**
+ * Forward-only JSON writer that emits UTF-8 straight into a pooled send
+ * buffer. The first FrameHeaderReserve bytes of the buffer are left free so
+ * the WebSocket layer can write the frame header in place and send the
+ * buffer without another copy (FMcpBridgeWebSocket::SendTextWithReservedHeader).
+ *
+ * Handlers producing large results can stream them through
+ * UMcpAutomationBridgeSubsystem::SendAutomationResponseStreamed instead of
+ * building an FJsonObject tree first. Existing trees can be appended with
+ * WriteJsonObject / WriteJsonValue, which skips the UTF-16 FString stage.
+ * Large arrays inside a streamed result should go through FMcpStreamedArray,
+ * which can send them ahead of the response as response_chunk frames.
+ *
+ * A writer created with EMcpStreamFormat::MessagePack takes the same calls
+ * and produces the document as MessagePack instead, so a streamed result for
+ * a MessagePack connection is encoded once rather than written as JSON,
+ * parsed back and re-encoded. Container lengths are patched in when the
+ * container ends. WriteRawValue, ToString and chunk sinks are JSON only.
+ *
+ * The writer does not validate structure beyond what it needs for commas and
+ * lengths; callers are expected to balance Begin/End calls and to only use
+ * keyed overloads inside objects.
+ */
+class FMcpJsonStreamWriter
+{
+public:
+	/** Largest WebSocket header: 2 bytes + 8-byte length + 4-byte mask key. */
+	static constexpr int32 FrameHeaderReserve = 14;
+
+	explicit FMcpJsonStreamWriter(EMcpStreamFormat InFormat = EMcpStreamFormat::Json);
+	~FMcpJsonStreamWriter();
+
+	FMcpJsonStreamWriter(const FMcpJsonStreamWriter&) = delete;
+	FMcpJsonStreamWriter& operator=(const FMcpJsonStreamWriter&) = delete;
+
+	void BeginObject();
+	void BeginObject(FStringView Key);
+	void EndObject();
+	void BeginArray();
+	void BeginArray(FStringView Key);
+	void EndArray();
+
+	/** Writes an object key; the next value call supplies its value. */
+	void WriteKey(FStringView Key);
+
+	void WriteString(FStringView Value);
+	void WriteNumber(double Value);
+	void WriteInteger(int64 Value);
+	void WriteBool(bool bValue);
+	void WriteNull();
+	void WriteJsonValue(const TSharedPtr<FJsonValue>& Value);
+	void WriteJsonObject(const FJsonObject& Object);
+
+	/** Writes Object's members into the currently open object, without braces. */
+	void WriteJsonObjectFields(const FJsonObject& Object);
+
+	/**
+	 * Appends already encoded UTF-8 JSON as the next value. Inside an array it
+	 * may also be a comma-separated run of elements. JSON writers only.
+	 */
+	void WriteRawValue(const uint8* Utf8, int32 Length);
+
+	void WriteString(FStringView Key, FStringView Value) { WriteKey(Key); WriteString(Value); }
+	void WriteNumber(FStringView Key, double Value) { WriteKey(Key); WriteNumber(Value); }
+	void WriteInteger(FStringView Key, int64 Value) { WriteKey(Key); WriteInteger(Value); }
+	void WriteBool(FStringView Key, bool bValue) { WriteKey(Key); WriteBool(bValue); }
+	void WriteNull(FStringView Key) { WriteKey(Key); WriteNull(); }
+	void WriteJsonValue(FStringView Key, const TSharedPtr<FJsonValue>& Value) { WriteKey(Key); WriteJsonValue(Value); }
+
+	EMcpStreamFormat GetFormat() const { return Format; }
+	bool IsMessagePack() const { return Format == EMcpStreamFormat::MessagePack; }
+
+	/** UTF-8 JSON (or MessagePack) written so far. */
+	const uint8* GetPayloadData() const { return Buffer.GetData() + FrameHeaderReserve; }
+	int32 GetPayloadSize() const { return Buffer.Num() - FrameHeaderReserve; }
+
+	/** Whole buffer including the reserved header bytes, for in-place framing. */
+	TArray<uint8>& GetFrameBuffer() { return Buffer; }
+
+	/** Copies of the payload for paths that still need a string (JSON only) or the DOM. */
+	FString ToString() const;
+	TSharedPtr<FJsonObject> ParsePayload() const;
+
+	/** Drops everything written so far, keeping the buffer's capacity. */
+	void Reset();
+
+	/** Set while the target connection accepts response_chunk frames (see FMcpStreamedArray). */
+	void SetChunkSink(FMcpResponseChunkSink* InChunkSink) { ChunkSink = InChunkSink; }
+	FMcpResponseChunkSink* GetChunkSink() const { return ChunkSink; }
+
+private:
+	struct FScope
+	{
+		/** Members (objects) or elements (arrays) written so far. */
+		int32 NumElements = 0;
+		/** MessagePack only: where the container's placeholder header starts. */
+		int32 HeaderOffset = 0;
+	};
+
+	void BeginElement();
+	void BeginValue();
+	void OpenContainer(uint8 Marker32, ANSICHAR Open);
+	void CloseContainer(uint8 FixMarker, uint8 Marker16, uint8 Marker32, ANSICHAR Close);
+	void AppendByte(uint8 Byte) { Buffer.Add(Byte); }
+	void AppendAscii(const ANSICHAR* Text, int32 Length);
+	void AppendEscaped(FStringView Value);
+
+	EMcpStreamFormat Format = EMcpStreamFormat::Json;
+	TArray<uint8> Buffer;
+	/** One entry per open object/array. */
+	TArray<FScope, TInlineAllocator<32>> Scopes;
+	bool bAfterKey = false;
+	FMcpResponseChunkSink* ChunkSink = nullptr;
+};
@@ -0,0 +1,172 @@
+// Loopback round-trip benchmark for the bridge transport.
+//
+// Usage (editor console):
+//   McpAutomationBridge.BenchmarkLatency [Samples=200] [Port=<first ListenPort>]
+//
+// Opens a client connection to the bridge's own listener, sends WebSocket
+// pings and times the matching pongs. Both ends answer on their socket I/O
+// threads, so the numbers isolate receive-path wake latency from game-thread
+// scheduling. Results are logged as p50/p99/max in microseconds.
+
+#include "McpAutomationBridgeSettings.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeWebSocket.h"
+
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+namespace {
+struct FMcpLatencyBenchmarkState {
+  TSharedPtr<FMcpBridgeWebSocket> Client;
+  FEvent *PongEvent = nullptr;
+  int32 SampleCount = 0;
+
+  ~FMcpLatencyBenchmarkState() {
+    if (PongEvent) {
+      FPlatformProcess::ReturnSynchEventToPool(PongEvent);
+      PongEvent = nullptr;
+    }
+  }
+};
+
+// Benchmarks in flight. Only touched on the game thread.
+TArray<TSharedRef<FMcpLatencyBenchmarkState>> GActiveLatencyBenchmarks;
+
+double LatencyPercentileMicros(const TArray<double> &Sorted, double Percentile) {
+  if (Sorted.Num() == 0) {
+    return 0.0;
+  }
+  const int32 Index = FMath::Clamp(
+      FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+  return Sorted[Index] * 1000000.0;
+}
+
+void RunLatencySamples(const TSharedRef<FMcpLatencyBenchmarkState> &State) {
+  TSharedPtr<FMcpBridgeWebSocket> Client = State->Client;
+  if (!Client.IsValid()) {
+    return;
+  }
+
+  TArray<double> Durations;
+  Durations.Reserve(State->SampleCount);
+  int32 Timeouts = 0;
+
+  for (int32 Index = 0; Index < State->SampleCount; ++Index) {
+    if (!Client->IsConnected()) {
+      break;
+    }
+    State->PongEvent->Reset();
+    const double Start = FPlatformTime::Seconds();
+    Client->SendHeartbeatPing();
+    if (!State->PongEvent->Wait(FTimespan::FromSeconds(1.0))) {
+      ++Timeouts;
+      continue;
+    }
+    Durations.Add(FPlatformTime::Seconds() - Start);
+  }
+
+  Durations.Sort();
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+         TEXT("Bridge latency benchmark: samples=%d timeouts=%d p50=%.1fus "
+              "p99=%.1fus max=%.1fus"),
+         Durations.Num(), Timeouts, LatencyPercentileMicros(Durations, 0.50),
+         LatencyPercentileMicros(Durations, 0.99),
+         LatencyPercentileMicros(Durations, 1.0));
+}
+
+void FinishLatencyBenchmark(const TSharedRef<FMcpLatencyBenchmarkState> &State) {
+  // Release the client on the game thread so its worker is never asked to
+  // join itself from inside a delegate.
+  AsyncTask(ENamedThreads::GameThread, [State] {
+    GActiveLatencyBenchmarks.Remove(State);
+    if (State->Client.IsValid()) {
+      State->Client->Close(1000, TEXT("Benchmark complete"));
+      State->Client.Reset();
+    }
+  });
+}
+
+void StartLatencyBenchmark(const TArray<FString> &Args) {
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+
+  int32 Samples = 200;
+  int32 Port = 0;
+  if (Args.Num() > 0) {
+    LexFromString(Samples, *Args[0]);
+  }
+  if (Args.Num() > 1) {
+    LexFromString(Port, *Args[1]);
+  }
+  if (Port <= 0 && Settings) {
+    TArray<FString> PortTokens;
+    Settings->ListenPorts.ParseIntoArray(PortTokens, TEXT(","), true);
+    if (PortTokens.Num() > 0) {
+      LexFromString(Port, *PortTokens[0].TrimStartAndEnd());
+    }
+  }
+  if (Port <= 0) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Bridge latency benchmark: no listen port configured."));
+    return;
+  }
+
+  const bool bUseTls = Settings && Settings->bEnableTls;
+  const FString Url = FString::Printf(TEXT("%s://127.0.0.1:%d"),
+                                      bUseTls ? TEXT("wss") : TEXT("ws"), Port);
+
+  TSharedRef<FMcpLatencyBenchmarkState> State =
+      MakeShared<FMcpLatencyBenchmarkState>();
+  State->SampleCount = FMath::Clamp(Samples, 1, 100000);
+  State->PongEvent = FPlatformProcess::GetSynchEventFromPool(false);
+  State->Client = MakeShared<FMcpBridgeWebSocket>(
+      Url, TEXT("mcp-automation"), TMap<FString, FString>(), bUseTls);
+  State->Client->InitializeWeakSelf(State->Client);
+
+  // The delegates only hold a weak reference; GActiveLatencyBenchmarks owns
+  // the state (and through it the client) until FinishLatencyBenchmark runs.
+  GActiveLatencyBenchmarks.Add(State);
+  TWeakPtr<FMcpLatencyBenchmarkState> WeakState = State;
+  State->Client->OnHeartbeat().AddLambda(
+      [WeakState](TSharedPtr<FMcpBridgeWebSocket>) {
+        if (TSharedPtr<FMcpLatencyBenchmarkState> Pinned = WeakState.Pin()) {
+          Pinned->PongEvent->Trigger();
+        }
+      });
+  State->Client->OnConnected().AddLambda(
+      [WeakState](TSharedPtr<FMcpBridgeWebSocket>) {
+        TSharedPtr<FMcpLatencyBenchmarkState> Pinned = WeakState.Pin();
+        if (!Pinned.IsValid()) {
+          return;
+        }
+        TSharedRef<FMcpLatencyBenchmarkState> PinnedRef = Pinned.ToSharedRef();
+        Async(EAsyncExecution::Thread, [PinnedRef] {
+          RunLatencySamples(PinnedRef);
+          FinishLatencyBenchmark(PinnedRef);
+        });
+      });
+  State->Client->OnConnectionError().AddLambda(
+      [WeakState, Url](const FString &Error) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("Bridge latency benchmark could not connect to %s: %s"),
+               *Url, *Error);
+        if (TSharedPtr<FMcpLatencyBenchmarkState> Pinned = WeakState.Pin()) {
+          FinishLatencyBenchmark(Pinned.ToSharedRef());
+        }
+      });
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Display,
+         TEXT("Bridge latency benchmark: %d pings against %s"),
+         State->SampleCount, *Url);
+  State->Client->Connect();
+}
+
+FAutoConsoleCommand GMcpBridgeLatencyBenchmarkCommand(
+    TEXT("McpAutomationBridge.BenchmarkLatency"),
+    TEXT("Measures loopback WebSocket ping/pong round-trip latency against the "
+         "automation bridge listener. Args: [Samples] [Port]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&StartLatencyBenchmark));
+} // namespace
@@ -0,0 +1,99 @@
+#include "McpBridgeLatencyHistogram.h"
+
+int32 FMcpLatencyHistogram::BucketForMicros(uint64 Micros) {
+  if (Micros < SubBucketCount) {
+    return static_cast<int32>(Micros);
+  }
+  const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(Micros));
+  if (Exponent > MaxExponent) {
+    return NumBuckets - 1;
+  }
+  const int32 Shift = Exponent - SubBucketBits;
+  const int32 SubBucket =
+      static_cast<int32>(Micros >> Shift) - SubBucketCount;
+  return SubBucketCount + Shift * SubBucketCount + SubBucket;
+}
+
+double FMcpLatencyHistogram::BucketMidpointMicros(int32 Bucket) {
+  if (Bucket < SubBucketCount) {
+    return Bucket;
+  }
+  const int32 Shift = (Bucket - SubBucketCount) / SubBucketCount;
+  const int32 SubBucket = (Bucket - SubBucketCount) % SubBucketCount;
+  const double Width = static_cast<double>(uint64(1) << Shift);
+  return (SubBucketCount + SubBucket) * Width + Width * 0.5;
+}
+
+uint64 FMcpLatencyHistogram::BucketEndMicros(int32 Bucket) {
+  if (Bucket < SubBucketCount) {
+    return static_cast<uint64>(Bucket) + 1;
+  }
+  const int32 Shift = (Bucket - SubBucketCount) / SubBucketCount;
+  const int32 SubBucket = (Bucket - SubBucketCount) % SubBucketCount;
+  return static_cast<uint64>(SubBucketCount + SubBucket + 1) << Shift;
+}
+
+void FMcpLatencyHistogram::Record(double Seconds) {
+  Seconds = FMath::Max(0.0, Seconds);
+  if (Buckets.Num() == 0) {
+    Buckets.SetNumZeroed(NumBuckets);
+  }
+  const uint64 Micros = static_cast<uint64>(
+      FMath::Min(Seconds * 1000000.0, static_cast<double>(MAX_uint64 >> 1)));
+  ++Buckets[BucketForMicros(Micros)];
+  ++Count;
+  SumSeconds += Seconds;
+  MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FMcpLatencyHistogram::GetPercentileSeconds(double Percentile) const {
+  if (Count == 0) {
+    return 0.0;
+  }
+  const int64 Rank = FMath::Clamp<int64>(
+      static_cast<int64>(FMath::CeilToDouble(Percentile / 100.0 * Count)), 1,
+      Count);
+  int64 Seen = 0;
+  for (int32 Bucket = 0; Bucket < Buckets.Num(); ++Bucket) {
+    Seen += Buckets[Bucket];
+    if (Seen >= Rank) {
+      // The top bucket is open-ended and any bucket may straddle the
+      // largest sample, so never report more than was actually seen.
+      return FMath::Min(BucketMidpointMicros(Bucket) / 1000000.0, MaxSeconds);
+    }
+  }
+  return MaxSeconds;
+}
+
+int64 FMcpLatencyHistogram::GetCountAtOrBelow(double Seconds) const {
+  if (Count == 0 || Seconds < 0.0) {
+    return 0;
+  }
+  if (Seconds >= MaxSeconds) {
+    return Count;
+  }
+  // Samples are recorded by whole microseconds rounded down, so everything in
+  // a bucket is below its end. The top bucket also takes every larger sample
+  // and is only reached through the MaxSeconds check above.
+  const double BoundMicros = Seconds * 1000000.0;
+  int64 Below = 0;
+  for (int32 Bucket = 0; Bucket < NumBuckets - 1; ++Bucket) {
+    if (static_cast<double>(BucketEndMicros(Bucket)) > BoundMicros) {
+      break;
+    }
+    Below += Buckets[Bucket];
+  }
+  return Below;
+}
+
+TSharedRef<FJsonObject> FMcpLatencyHistogram::ToJson() const {
+  TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+  Json->SetNumberField(TEXT("count"), static_cast<double>(Count));
+  Json->SetNumberField(TEXT("meanMs"), GetMeanSeconds() * 1000.0);
+  Json->SetNumberField(TEXT("p50Ms"), GetPercentileSeconds(50.0) * 1000.0);
+  Json->SetNumberField(TEXT("p90Ms"), GetPercentileSeconds(90.0) * 1000.0);
+  Json->SetNumberField(TEXT("p99Ms"), GetPercentileSeconds(99.0) * 1000.0);
+  Json->SetNumberField(TEXT("p999Ms"), GetPercentileSeconds(99.9) * 1000.0);
+  Json->SetNumberField(TEXT("maxMs"), MaxSeconds * 1000.0);
+  return Json;
+}
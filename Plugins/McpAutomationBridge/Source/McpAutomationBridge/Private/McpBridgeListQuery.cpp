@@ -0,0 +1,122 @@
+#include "McpBridgeListQuery.h"
+
+#include "McpBridgeJsonStreamWriter.h"
+#include "Misc/Base64.h"
+#include "Misc/Crc.h"
+#include "Misc/Parse.h"
+
+namespace {
+// Bumped if the decoded layout ever changes so stale cursors fail cleanly.
+const TCHAR *const McpListCursorVersion = TEXT("mcp1");
+
+bool McpDecodeListCursor(const FString &Cursor, uint32 &OutScopeHash,
+                         int32 &OutPosition) {
+  FString Decoded;
+  if (!FBase64::Decode(Cursor, Decoded)) {
+    return false;
+  }
+  TArray<FString> Parts;
+  Decoded.ParseIntoArray(Parts, TEXT(":"), false);
+  if (Parts.Num() != 3 || Parts[0] != McpListCursorVersion ||
+      Parts[1].Len() != 8) {
+    return false;
+  }
+  OutScopeHash = FParse::HexNumber(*Parts[1]);
+  return LexTryParseString(OutPosition, *Parts[2]) && OutPosition >= 0;
+}
+} // namespace
+
+bool FMcpListQuery::Parse(const TSharedPtr<FJsonObject> &Payload,
+                          TArrayView<const TCHAR *const> AllowedFields,
+                          const FString &Scope, int32 DefaultLimit,
+                          FString &OutErrorCode, FString &OutError) {
+  SelectedFields.Reset();
+  ScopeHash = FCrc::StrCrc32(*Scope);
+  Start = 0;
+  Limit = FMath::Max(0, DefaultLimit);
+  bHasCursor = false;
+  if (!Payload.IsValid()) {
+    return true;
+  }
+
+  TArray<FString> RequestedFields;
+  const TArray<TSharedPtr<FJsonValue>> *FieldsArray = nullptr;
+  FString FieldsString;
+  if (Payload->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray) {
+    for (const TSharedPtr<FJsonValue> &Value : *FieldsArray) {
+      FString Field;
+      if (Value.IsValid() && Value->TryGetString(Field)) {
+        RequestedFields.Add(Field.TrimStartAndEnd());
+      }
+    }
+  } else if (Payload->TryGetStringField(TEXT("fields"), FieldsString)) {
+    FieldsString.ParseIntoArray(RequestedFields, TEXT(","), true);
+    for (FString &Field : RequestedFields) {
+      Field.TrimStartAndEndInline();
+    }
+  }
+  for (const FString &Requested : RequestedFields) {
+    if (Requested.IsEmpty()) {
+      continue;
+    }
+    const TCHAR *const *Known = AllowedFields.FindByPredicate(
+        [&Requested](const TCHAR *Allowed) { return Requested == Allowed; });
+    if (!Known) {
+      OutErrorCode = TEXT("INVALID_ARGUMENT");
+      OutError = FString::Printf(
+          TEXT("Unknown field '%s'. Available fields: %s"), *Requested,
+          *FString::Join(AllowedFields, TEXT(", ")));
+      return false;
+    }
+    SelectedFields.AddUnique(*Known);
+  }
+
+  if (Payload->HasField(TEXT("limit"))) {
+    double RequestedLimit = 0.0;
+    if (!Payload->TryGetNumberField(TEXT("limit"), RequestedLimit) ||
+        RequestedLimit < 0.0) {
+      OutErrorCode = TEXT("INVALID_ARGUMENT");
+      OutError = TEXT("limit must be a non-negative number");
+      return false;
+    }
+    Limit = static_cast<int32>(FMath::Min<double>(RequestedLimit, MAX_int32));
+  }
+
+  FString Cursor;
+  if (Payload->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty()) {
+    uint32 CursorScopeHash = 0;
+    if (!McpDecodeListCursor(Cursor, CursorScopeHash, Start)) {
+      OutErrorCode = TEXT("INVALID_CURSOR");
+      OutError = TEXT("cursor is malformed");
+      return false;
+    }
+    if (CursorScopeHash != ScopeHash) {
+      OutErrorCode = TEXT("INVALID_CURSOR");
+      OutError = TEXT("cursor was issued for a different action or filter");
+      return false;
+    }
+    bHasCursor = true;
+  }
+  return true;
+}
+
+bool FMcpListQuery::WantsField(const TCHAR *Field) const {
+  return SelectedFields.Num() == 0 || SelectedFields.Contains(Field);
+}
+
+void FMcpListQuery::WritePageInfo(FMcpJsonStreamWriter &Writer,
+                                  int32 NextPosition) const {
+  if (Limit <= 0 && !bHasCursor) {
+    return;
+  }
+  Writer.WriteBool(TEXT("hasMore"), NextPosition != INDEX_NONE);
+  if (NextPosition != INDEX_NONE) {
+    Writer.WriteString(TEXT("nextCursor"), MakeCursor(NextPosition));
+  }
+}
+
+FString FMcpListQuery::MakeCursor(int32 Position) const {
+  return FBase64::Encode(FString::Printf(TEXT("%s:%08x:%d"),
+                                         McpListCursorVersion, ScopeHash,
+                                         Position));
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class FMcpJsonStreamWriter;
+
+/**
+ * The "fields" / "limit" / "cursor" contract shared by list and query actions
+ * (list_actors, find_by_class, get_level_actors, search_assets).
+ *
+ *   fields: item fields to return, as an array or a comma-separated string;
+ *           omitted returns every field the action knows
+ *   limit:  most items in one response; 0 means no limit, omitted means the
+ *           action's default
+ *   cursor: the nextCursor of a previous response, resuming iteration where
+ *           that page stopped
+ *
+ * A cursor is an opaque token holding a position in the action's iteration
+ * order plus a hash of the action and filters that produced it, so reusing it
+ * with different arguments is rejected instead of returning the wrong page.
+ * Actors added or removed between pages can shift items across the page
+ * boundary, and the last page may come back empty.
+ */
+class FMcpListQuery
+{
+public:
+	/**
+	 * Reads fields, limit and cursor from Payload. AllowedFields lists the item
+	 * fields the action can return; Scope names the action and every filter
+	 * that shapes the result. On bad input returns false with an error code
+	 * and message for the response.
+	 */
+	bool Parse(const TSharedPtr<FJsonObject>& Payload, TArrayView<const TCHAR* const> AllowedFields, const FString& Scope,
+		int32 DefaultLimit, FString& OutErrorCode, FString& OutError);
+
+	/** True if Field (one of the AllowedFields) should be written for each item. */
+	bool WantsField(const TCHAR* Field) const;
+	/** True if the caller named fields explicitly. */
+	bool HasFieldSelection() const { return SelectedFields.Num() > 0; }
+
+	/** Position in the iteration order to resume from (0 without a cursor). */
+	int32 GetStart() const { return Start; }
+	int32 GetLimit() const { return Limit; }
+	/** True once Written items fill the page. */
+	bool IsPageFull(int32 Written) const { return Limit > 0 && Written >= Limit; }
+
+	/**
+	 * Writes hasMore, plus nextCursor when iteration stopped early at
+	 * NextPosition. Pass INDEX_NONE when every item was visited. Nothing is
+	 * written for unpaginated requests, so their results keep their old shape.
+	 */
+	void WritePageInfo(FMcpJsonStreamWriter& Writer, int32 NextPosition) const;
+
+private:
+	FString MakeCursor(int32 Position) const;
+
+	TArray<FString> SelectedFields;
+	uint32 ScopeHash = 0;
+	int32 Start = 0;
+	int32 Limit = 0;
+	bool bHasCursor = false;
+};
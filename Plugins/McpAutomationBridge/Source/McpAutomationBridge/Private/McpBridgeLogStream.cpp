@@ -0,0 +1,518 @@
+#include "McpBridgeLogStream.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeWebSocket.h"
+#include "Misc/CString.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace {
+// Lines the ring holds while the drain thread is behind, about 1 MB of
+// records plus their text.
+constexpr int32 McpLogRingCapacity = 16 * 1024;
+
+// Process-wide drop counters reported on the metrics endpoint.
+TAtomic<int64> GMcpLogRecordsOverflowed{0};
+TAtomic<int64> GMcpLogRecordsBackpressured{0};
+
+const TCHAR *McpLogVerbosityName(ELogVerbosity::Type Verbosity) {
+  switch (Verbosity & ELogVerbosity::VerbosityMask) {
+  case ELogVerbosity::Fatal:
+    return TEXT("Fatal");
+  case ELogVerbosity::Error:
+    return TEXT("Error");
+  case ELogVerbosity::Warning:
+    return TEXT("Warning");
+  case ELogVerbosity::Display:
+    return TEXT("Display");
+  case ELogVerbosity::Verbose:
+    return TEXT("Verbose");
+  case ELogVerbosity::VeryVerbose:
+    return TEXT("VeryVerbose");
+  default:
+    return TEXT("Log");
+  }
+}
+} // namespace
+
+FMcpLogRingBuffer::FMcpLogRingBuffer(int32 InCapacity) {
+  const uint32 Capacity = FMath::RoundUpToPowerOfTwo(
+      static_cast<uint32>(FMath::Max(InCapacity, 2)));
+  Slots = MakeUnique<FSlot[]>(Capacity);
+  for (uint32 Index = 0; Index < Capacity; ++Index) {
+    Slots[Index].Sequence.Store(Index, EMemoryOrder::Relaxed);
+  }
+  Mask = Capacity - 1;
+}
+
+bool FMcpLogRingBuffer::TryPush(FMcpLogRecord &&Record, uint64 &OutPosition) {
+  uint64 Position = EnqueuePosition.Load(EMemoryOrder::Relaxed);
+  for (;;) {
+    FSlot &Slot = Slots[Position & Mask];
+    const int64 Lag = static_cast<int64>(Slot.Sequence.Load() - Position);
+    if (Lag == 0) {
+      // The slot is free for this position; claim it. On failure Position
+      // is refreshed and the loop retries.
+      if (EnqueuePosition.CompareExchange(Position, Position + 1)) {
+        Slot.Record = MoveTemp(Record);
+        // Publishes the record to the consumer.
+        Slot.Sequence.Store(Position + 1);
+        OutPosition = Position;
+        return true;
+      }
+    } else if (Lag < 0) {
+      // The consumer has not freed this slot from the previous lap yet.
+      return false;
+    } else {
+      Position = EnqueuePosition.Load(EMemoryOrder::Relaxed);
+    }
+  }
+}
+
+bool FMcpLogRingBuffer::TryPop(FMcpLogRecord &OutRecord) {
+  FSlot &Slot = Slots[DequeuePosition & Mask];
+  if (Slot.Sequence.Load() != DequeuePosition + 1) {
+    return false;
+  }
+  OutRecord = MoveTemp(Slot.Record);
+  // Hands the slot to the producer one lap ahead.
+  Slot.Sequence.Store(DequeuePosition + Mask + 1);
+  ++DequeuePosition;
+  return true;
+}
+
+FMcpLogStream::FMcpLogStream(int32 InBatchIntervalMs, int32 InBatchMaxRecords)
+    : Ring(McpLogRingCapacity),
+      BatchIntervalMs(FMath::Max(InBatchIntervalMs, 1)),
+      BatchMaxRecords(FMath::Max(InBatchMaxRecords, 1)) {
+  for (TAtomic<int64> &Drops : PendingDrops) {
+    Drops.Store(0, EMemoryOrder::Relaxed);
+  }
+  WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+  Thread = FRunnableThread::Create(this, TEXT("FMcpLogStream"), 0,
+                                   TPri_BelowNormal);
+}
+
+FMcpLogStream::~FMcpLogStream() {
+  if (Thread) {
+    Thread->Kill(true); // calls Stop() and waits for Run() to return
+    delete Thread;
+    Thread = nullptr;
+  }
+  FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+  WakeEvent = nullptr;
+}
+
+bool FMcpLogStream::AddSubscriber(const TSharedPtr<FMcpBridgeWebSocket> &Socket,
+                                  const FMcpLogFilter &Filter) {
+  if (!Socket.IsValid()) {
+    return false;
+  }
+  FWriteScopeLock Lock(SubscribersLock);
+  FSubscriber *Subscriber =
+      Subscribers.FindByPredicate([&Socket](const FSubscriber &Existing) {
+        return Existing.Socket.HasSameObject(Socket.Get());
+      });
+  if (!Subscriber) {
+    if (Subscribers.Num() >= MaxSubscribers) {
+      return false;
+    }
+    // Slots are handed out round-robin so a slot freed a moment ago is not
+    // reused while lines tagged for its previous owner are still queued.
+    int32 Slot = NextSlot;
+    while (UsedSlots & (uint64(1) << Slot)) {
+      Slot = (Slot + 1) % MaxSubscribers;
+    }
+    NextSlot = (Slot + 1) % MaxSubscribers;
+    UsedSlots |= uint64(1) << Slot;
+    PendingDrops[Slot].Store(0);
+
+    Subscriber = &Subscribers.AddDefaulted_GetRef();
+    Subscriber->Socket = Socket;
+    Subscriber->Slot = Slot;
+  }
+  Subscriber->Filter = Filter;
+  UpdateMaxVerbosity();
+  return true;
+}
+
+int32 FMcpLogStream::RemoveSubscriber(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket) {
+  FWriteScopeLock Lock(SubscribersLock);
+  for (int32 Index = Subscribers.Num() - 1; Index >= 0; --Index) {
+    const FSubscriber &Subscriber = Subscribers[Index];
+    if (!Subscriber.Socket.IsValid() ||
+        Subscriber.Socket.HasSameObject(Socket.Get())) {
+      UsedSlots &= ~(uint64(1) << Subscriber.Slot);
+      Subscribers.RemoveAtSwap(Index);
+    }
+  }
+  UpdateMaxVerbosity();
+  return Subscribers.Num();
+}
+
+void FMcpLogStream::RemoveDisconnectedSubscribers() {
+  FWriteScopeLock Lock(SubscribersLock);
+  for (int32 Index = Subscribers.Num() - 1; Index >= 0; --Index) {
+    const FSubscriber &Subscriber = Subscribers[Index];
+    const TSharedPtr<FMcpBridgeWebSocket> Socket = Subscriber.Socket.Pin();
+    if (!Socket.IsValid() || !Socket->IsConnected()) {
+      UsedSlots &= ~(uint64(1) << Subscriber.Slot);
+      Subscribers.RemoveAtSwap(Index);
+    }
+  }
+  UpdateMaxVerbosity();
+}
+
+void FMcpLogStream::UpdateMaxVerbosity() {
+  int32 MaxVerbosity = ELogVerbosity::NoLogging;
+  for (const FSubscriber &Subscriber : Subscribers) {
+    MaxVerbosity =
+        FMath::Max<int32>(MaxVerbosity, Subscriber.Filter.MaxVerbosity);
+  }
+  MaxSubscribedVerbosity = MaxVerbosity;
+}
+
+bool FMcpLogStream::IsNoise(const TCHAR *V, ELogVerbosity::Type Verbosity,
+                            const FName &Category) {
+  static const FName NAME_LogSlateStyle(TEXT("LogSlateStyle"));
+  static const FName NAME_LogStats(TEXT("LogStats"));
+
+  // Our own category would feed back into the stream.
+  if (Category == LogMcpAutomationBridgeSubsystem.GetCategoryName()) {
+    return true;
+  }
+  // Known engine warning during 'show collision'.
+  if (Category == NAME_LogSlateStyle && Verbosity == ELogVerbosity::Warning &&
+      FCString::Stristr(
+          V, TEXT("Missing Resource from 'ProfileVisualizerStyle'"))) {
+    return true;
+  }
+  // Noise during stat commands.
+  return Category == NAME_LogStats &&
+         FCString::Stristr(V, TEXT("There is no thread with id"));
+}
+
+bool FMcpLogStream::Accepts(const FMcpLogFilter &Filter,
+                            ELogVerbosity::Type Verbosity,
+                            const FName &Category) {
+  static const FName NAME_LogRHI(TEXT("LogRHI"));
+  static const FName NAME_LogEOSSDK(TEXT("LogEOSSDK"));
+  static const FName NAME_LogCsvProfiler(TEXT("LogCsvProfiler"));
+
+  if (Verbosity > Filter.MaxVerbosity) {
+    return false;
+  }
+  if (Filter.Categories.Num() > 0) {
+    if (!Filter.Categories.Contains(Category)) {
+      return false;
+    }
+  } else if (Category == NAME_LogRHI || Category == NAME_LogEOSSDK ||
+             Category == NAME_LogCsvProfiler) {
+    // Chatty enough to drown everything else unless asked for by name.
+    return false;
+  }
+  return !Filter.ExcludedCategories.Contains(Category);
+}
+
+void FMcpLogStream::Serialize(const TCHAR *V, ELogVerbosity::Type Verbosity,
+                              const FName &Category) {
+  const ELogVerbosity::Type Level = static_cast<ELogVerbosity::Type>(
+      Verbosity & ELogVerbosity::VerbosityMask);
+  if (!V || Level > MaxSubscribedVerbosity.Load(EMemoryOrder::Relaxed) ||
+      IsNoise(V, Level, Category)) {
+    return;
+  }
+
+  uint64 SubscriberMask = 0;
+  {
+    FReadScopeLock Lock(SubscribersLock);
+    for (const FSubscriber &Subscriber : Subscribers) {
+      if (Accepts(Subscriber.Filter, Level, Category)) {
+        SubscriberMask |= uint64(1) << Subscriber.Slot;
+      }
+    }
+  }
+  if (SubscriberMask == 0) {
+    return;
+  }
+
+  FMcpLogRecord Record;
+  Record.Message = V;
+  Record.Category = Category;
+  Record.Verbosity = Level;
+  Record.SubscriberMask = SubscriberMask;
+  uint64 Position = 0;
+  if (!Ring.TryPush(MoveTemp(Record), Position)) {
+    for (uint64 Bits = SubscriberMask; Bits != 0; Bits &= Bits - 1) {
+      ++PendingDrops[FMath::CountTrailingZeros64(Bits)];
+    }
+    ++GMcpLogRecordsOverflowed;
+    return;
+  }
+  // Wake the drain thread early once a full batch is waiting.
+  if ((Position + 1) % BatchMaxRecords == 0) {
+    WakeEvent->Trigger();
+  }
+}
+
+uint32 FMcpLogStream::Run() {
+  while (!bStopping) {
+    WakeEvent->Wait(BatchIntervalMs);
+    Flush();
+  }
+  return 0;
+}
+
+void FMcpLogStream::Stop() {
+  bStopping = true;
+  WakeEvent->Trigger();
+}
+
+void FMcpLogStream::Flush() {
+  // Each record is encoded once; every subscriber's frame is assembled from
+  // the spans its slot bit selects.
+  FMcpJsonStreamWriter Encoded;
+  TArray<TPair<int32, int32>> RecordSpans;
+  TArray<uint64> Masks;
+  FMcpLogRecord Record;
+  for (;;) {
+    Encoded.Reset();
+    RecordSpans.Reset();
+    Masks.Reset();
+    Encoded.BeginArray();
+    {
+      // Held so the patterns applied belong to the subscribers the lines
+      // were tagged for. A subscribe or unsubscribe waits for one batch.
+      FReadScopeLock Lock(SubscribersLock);
+      while (Masks.Num() < BatchMaxRecords && Ring.TryPop(Record)) {
+        // Message patterns are matched here, once per line and subscriber,
+        // rather than on the logging thread.
+        for (const FSubscriber &Subscriber : Subscribers) {
+          const uint64 Bit = uint64(1) << Subscriber.Slot;
+          if ((Record.SubscriberMask & Bit) != 0 &&
+              Subscriber.Filter.MessagePattern.IsSet()) {
+            FRegexMatcher Matcher(Subscriber.Filter.MessagePattern.GetValue(),
+                                  Record.Message);
+            if (!Matcher.FindNext()) {
+              Record.SubscriberMask &= ~Bit;
+            }
+          }
+        }
+        if (Record.SubscriberMask == 0) {
+          continue;
+        }
+        Encoded.BeginObject();
+        const int32 Start = Encoded.GetPayloadSize() - 1;
+        Encoded.WriteString(TEXT("category"), Record.Category.ToString());
+        Encoded.WriteString(TEXT("verbosity"),
+                            McpLogVerbosityName(Record.Verbosity));
+        Encoded.WriteString(TEXT("message"), Record.Message);
+        Encoded.EndObject();
+        RecordSpans.Emplace(Start, Encoded.GetPayloadSize() - Start);
+        Masks.Add(Record.SubscriberMask);
+      }
+    }
+    Encoded.EndArray();
+
+    if (Masks.Num() == 0) {
+      return;
+    }
+    SendBatch(Masks, Encoded.GetPayloadData(), RecordSpans);
+    if (Masks.Num() < BatchMaxRecords) {
+      return;
+    }
+  }
+}
+
+void FMcpLogStream::SendBatch(const TArray<uint64> &Masks,
+                              const uint8 *Encoded,
+                              const TArray<TPair<int32, int32>> &RecordSpans) {
+  FMcpJsonStreamWriter Frame;
+  bool bFoundDisconnected = false;
+  {
+    FReadScopeLock Lock(SubscribersLock);
+    for (const FSubscriber &Subscriber : Subscribers) {
+      const TSharedPtr<FMcpBridgeWebSocket> Socket = Subscriber.Socket.Pin();
+      if (!Socket.IsValid() || !Socket->IsConnected()) {
+        bFoundDisconnected = true;
+        continue;
+      }
+      const uint64 Bit = uint64(1) << Subscriber.Slot;
+      int32 NumRecords = 0;
+      for (const uint64 Mask : Masks) {
+        NumRecords += (Mask & Bit) != 0;
+      }
+      if (NumRecords == 0) {
+        continue;
+      }
+      TAtomic<int64> &Drops = PendingDrops[Subscriber.Slot];
+      if (Socket->IsSendQueueAboveHighWater()) {
+        Drops += NumRecords;
+        GMcpLogRecordsBackpressured += NumRecords;
+        continue;
+      }
+
+      const int64 NumDropped = Drops.Exchange(0);
+      Frame.Reset();
+      Frame.BeginObject();
+      Frame.WriteString(TEXT("event"), TEXT("log_batch"));
+      Frame.WriteInteger(TEXT("dropped"), NumDropped);
+      Frame.BeginArray(TEXT("records"));
+      for (int32 Index = 0; Index < Masks.Num(); ++Index) {
+        if (Masks[Index] & Bit) {
+          Frame.WriteRawValue(Encoded + RecordSpans[Index].Key,
+                              RecordSpans[Index].Value);
+        }
+      }
+      Frame.EndArray();
+      Frame.EndObject();
+      if (!Socket->SendTextWithReservedHeader(
+              Frame.GetFrameBuffer(),
+              FMcpJsonStreamWriter::FrameHeaderReserve)) {
+        Drops += NumDropped + NumRecords;
+        GMcpLogRecordsBackpressured += NumRecords;
+      }
+    }
+  }
+  if (bFoundDisconnected) {
+    RemoveDisconnectedSubscribers();
+  }
+}
+
+int64 FMcpLogStream::GetNumOverflowDrops() {
+  return GMcpLogRecordsOverflowed.Load();
+}
+
+int64 FMcpLogStream::GetNumBackpressureDrops() {
+  return GMcpLogRecordsBackpressured.Load();
+}
+
+bool FMcpLogStream::ValidateMessagePattern(const FString &Pattern,
+                                           FString &OutError) {
+  if (Pattern.Len() > MaxMessagePatternLength) {
+    OutError = FString::Printf(
+        TEXT("messagePattern is %d characters long; the limit is %d."),
+        Pattern.Len(), MaxMessagePatternLength);
+    return false;
+  }
+  auto Fail = [&Pattern, &OutError](const TCHAR *Problem, int32 Index) {
+    OutError = FString::Printf(
+        TEXT("messagePattern '%s' is not a valid regular expression: %s at "
+             "character %d."),
+        *Pattern, Problem, Index + 1);
+    return false;
+  };
+
+  int32 OpenGroups = 0;
+  int32 SetDepth = 0;
+  // Whether the last token can take a quantifier.
+  bool bCanRepeat = false;
+  for (int32 Index = 0; Index < Pattern.Len(); ++Index) {
+    const TCHAR Char = Pattern[Index];
+    if (Char == TEXT('\\')) {
+      if (Index + 1 == Pattern.Len()) {
+        return Fail(TEXT("unfinished escape"), Index);
+      }
+      ++Index;
+      bCanRepeat = true;
+      continue;
+    }
+    if (SetDepth > 0) {
+      // ICU sets nest ([[a-z]&&[^aeiou]]); nothing else is special in them.
+      if (Char == TEXT('[')) {
+        ++SetDepth;
+      } else if (Char == TEXT(']')) {
+        --SetDepth;
+        bCanRepeat = SetDepth == 0;
+      }
+      continue;
+    }
+    switch (Char) {
+    case TEXT('['):
+      ++SetDepth;
+      break;
+    case TEXT('('):
+      ++OpenGroups;
+      // "(?:", "(?=", "(?i)" and the like: the '?' is not a quantifier.
+      if (Index + 1 < Pattern.Len() && Pattern[Index + 1] == TEXT('?')) {
+        ++Index;
+      }
+      bCanRepeat = false;
+      break;
+    case TEXT(')'):
+      if (OpenGroups == 0) {
+        return Fail(TEXT("unmatched ')'"), Index);
+      }
+      --OpenGroups;
+      bCanRepeat = true;
+      break;
+    case TEXT('*'):
+    case TEXT('+'):
+    case TEXT('?'):
+    case TEXT('{'): {
+      if (!bCanRepeat) {
+        return Fail(TEXT("quantifier with nothing to repeat"), Index);
+      }
+      if (Char == TEXT('{')) {
+        // {n}, {n,} or {n,m}
+        const int32 Open = Index++;
+        bool bDigits = false;
+        while (Index < Pattern.Len() && FChar::IsDigit(Pattern[Index])) {
+          bDigits = true;
+          ++Index;
+        }
+        if (Index < Pattern.Len() && Pattern[Index] == TEXT(',')) {
+          ++Index;
+          while (Index < Pattern.Len() && FChar::IsDigit(Pattern[Index])) {
+            ++Index;
+          }
+        }
+        if (!bDigits || Index == Pattern.Len() ||
+            Pattern[Index] != TEXT('}')) {
+          return Fail(TEXT("malformed {m,n} repeat"), Open);
+        }
+      }
+      // A lazy or possessive suffix belongs to the same quantifier.
+      if (Index + 1 < Pattern.Len() && (Pattern[Index + 1] == TEXT('?') ||
+                                        Pattern[Index + 1] == TEXT('+'))) {
+        ++Index;
+      }
+      bCanRepeat = false;
+      break;
+    }
+    case TEXT('|'):
+    case TEXT('^'):
+    case TEXT('$'):
+      bCanRepeat = false;
+      break;
+    default:
+      bCanRepeat = true;
+      break;
+    }
+  }
+  if (SetDepth > 0) {
+    return Fail(TEXT("unclosed '['"), Pattern.Len() - 1);
+  }
+  if (OpenGroups > 0) {
+    return Fail(TEXT("unclosed '('"), Pattern.Len() - 1);
+  }
+  return true;
+}
+
+bool FMcpLogStream::ParseVerbosity(const FString &Name,
+                                   ELogVerbosity::Type &OutVerbosity) {
+  for (int32 Value = ELogVerbosity::Fatal; Value <= ELogVerbosity::VeryVerbose;
+       ++Value) {
+    const ELogVerbosity::Type Candidate =
+        static_cast<ELogVerbosity::Type>(Value);
+    if (Name.Equals(McpLogVerbosityName(Candidate), ESearchCase::IgnoreCase)) {
+      OutVerbosity = Candidate;
+      return true;
+    }
+  }
+  return false;
+}
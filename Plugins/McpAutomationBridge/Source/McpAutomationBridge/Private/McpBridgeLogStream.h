@@ -0,0 +1,175 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Internationalization/Regex.h"
+#include "Misc/Optional.h"
+#include "Misc/OutputDevice.h"
+#include "Templates/Atomic.h"
+#include "Templates/UniquePtr.h"
+
+class FEvent;
+class FMcpBridgeWebSocket;
+class FRunnableThread;
+
+/** One captured log line, as queued by the producing thread. */
+struct FMcpLogRecord
+{
+	FString Message;
+	FName Category;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	/** Subscriber slots whose filters accepted the line. */
+	uint64 SubscriberMask = 0;
+};
+
+/** What one subscriber wants from the log stream. */
+struct FMcpLogFilter
+{
+	/** Only these categories, when not empty. Naming a category here also lifts the built-in noise filter for it. */
+	TSet<FName> Categories;
+	TSet<FName> ExcludedCategories;
+	/** Least severe verbosity passed: Warning passes Fatal, Error and Warning. */
+	ELogVerbosity::Type MaxVerbosity = ELogVerbosity::VeryVerbose;
+	/**
+	 * When set, the message must contain a match. Unlike the filters above it
+	 * is applied on the drain thread, so Serialize never runs a regex.
+	 */
+	TOptional<FRegexPattern> MessagePattern;
+};
+
+/**
+ * Bounded ring of log records with many producers and one consumer. A
+ * producer claims a slot with a single compare-and-swap and never blocks or
+ * waits on the consumer; when the ring is full the record is refused.
+ * Each slot carries a sequence number telling producers and the consumer
+ * whose turn it is, so no lock is shared between them.
+ */
+class FMcpLogRingBuffer
+{
+public:
+	/** Capacity is rounded up to a power of two. */
+	explicit FMcpLogRingBuffer(int32 InCapacity);
+
+	FMcpLogRingBuffer(const FMcpLogRingBuffer&) = delete;
+	FMcpLogRingBuffer& operator=(const FMcpLogRingBuffer&) = delete;
+
+	/** Any thread. Returns false, leaving Record untouched, when the ring is full. */
+	bool TryPush(FMcpLogRecord&& Record, uint64& OutPosition);
+
+	/** Consumer thread only. */
+	bool TryPop(FMcpLogRecord& OutRecord);
+
+private:
+	struct FSlot
+	{
+		TAtomic<uint64> Sequence{0};
+		FMcpLogRecord Record;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+	uint64 Mask = 0;
+	// Kept on separate cache lines so producers and the consumer do not
+	// invalidate each other's position.
+	alignas(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint64> EnqueuePosition{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePosition = 0;
+};
+
+/**
+ * Editor log capture behind manage_logs subscribe. Serialize, called from
+ * whichever thread logged, runs the line through every subscriber's filter
+ * before copying anything and pushes it into a lock-free ring, tagged with
+ * the subscribers that want it. A line more verbose than any subscriber
+ * wants is rejected with one compare, without a lock; the rest cost a few
+ * name compares under a read lock. A dedicated thread drains the ring
+ * every BatchIntervalMs, or as soon as BatchMaxRecords lines are waiting,
+ * untags the lines that do not match a subscriber's message pattern, and
+ * sends each subscribed socket its lines as one log_batch event:
+ *
+ *   {"event":"log_batch","dropped":0,"records":[{"category":"LogTemp","verbosity":"Log","message":"..."}]}
+ *
+ * "dropped" counts this subscriber's lines lost since its previous batch:
+ * lines that arrived while the ring was full, and batches skipped because
+ * the socket's outbound queue was above its high-water mark.
+ */
+class FMcpLogStream final : public FOutputDevice, public FRunnable
+{
+public:
+	FMcpLogStream(int32 InBatchIntervalMs, int32 InBatchMaxRecords);
+	virtual ~FMcpLogStream();
+
+	/** False if the drain thread could not be started; nothing would be sent. */
+	bool IsRunning() const { return Thread != nullptr; }
+
+	/**
+	 * Subscribes Socket with Filter, replacing its filter if it is already
+	 * subscribed. Returns false when MaxSubscribers sockets already are.
+	 */
+	bool AddSubscriber(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const FMcpLogFilter& Filter);
+	/** Returns how many subscribers remain. */
+	int32 RemoveSubscriber(const TSharedPtr<FMcpBridgeWebSocket>& Socket);
+
+	//~ FOutputDevice
+	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+
+	//~ FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** Lines lost since startup because a ring was full, across all streams. */
+	static int64 GetNumOverflowDrops();
+	/** Lines lost since startup because a subscriber's socket was behind. */
+	static int64 GetNumBackpressureDrops();
+
+	/** Parses a verbosity name as written in log_batch records ("Warning"), ignoring case. */
+	static bool ParseVerbosity(const FString& Name, ELogVerbosity::Type& OutVerbosity);
+
+	/**
+	 * Checks a messagePattern before it is compiled: its length, and the
+	 * syntax errors FRegexPattern would otherwise swallow (unbalanced groups
+	 * or sets, quantifiers with nothing to repeat, malformed {m,n}, a
+	 * trailing backslash). Returns false with a message for the client.
+	 */
+	static bool ValidateMessagePattern(const FString& Pattern, FString& OutError);
+
+	static constexpr int32 MaxMessagePatternLength = 256;
+
+	/** One bit of FMcpLogRecord::SubscriberMask per subscriber. */
+	static constexpr int32 MaxSubscribers = 64;
+
+private:
+	struct FSubscriber
+	{
+		TWeakPtr<FMcpBridgeWebSocket> Socket;
+		FMcpLogFilter Filter;
+		int32 Slot = 0;
+	};
+
+	static bool IsNoise(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category);
+	static bool Accepts(const FMcpLogFilter& Filter, ELogVerbosity::Type Verbosity, const FName& Category);
+	void UpdateMaxVerbosity();
+	void Flush();
+	void SendBatch(const TArray<uint64>& Masks, const uint8* Encoded, const TArray<TPair<int32, int32>>& RecordSpans);
+	void RemoveDisconnectedSubscribers();
+
+	FMcpLogRingBuffer Ring;
+	const int32 BatchIntervalMs;
+	const int32 BatchMaxRecords;
+
+	// Serialize reads the subscribers under the read lock on every line, so
+	// writers (subscribe, unsubscribe, pruning closed sockets) must be rare.
+	FRWLock SubscribersLock;
+	TArray<FSubscriber> Subscribers;
+	uint64 UsedSlots = 0;
+	int32 NextSlot = 0;
+	// Least severe verbosity any subscriber wants; NoLogging while there are
+	// none. Lets Serialize reject most lines without taking the lock.
+	TAtomic<int32> MaxSubscribedVerbosity{ELogVerbosity::NoLogging};
+	// Lines each slot lost since its last batch.
+	TAtomic<int64> PendingDrops[MaxSubscribers];
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	TAtomic<bool> bStopping{false};
+};
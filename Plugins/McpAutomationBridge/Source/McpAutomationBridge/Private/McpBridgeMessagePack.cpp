@@ -0,0 +1,374 @@
+#include "McpBridgeMessagePack.h"
+
+#include "Containers/StringConv.h"
+
+namespace {
+// Deeper documents are rejected rather than risking the decoder's stack.
+constexpr int32 McpMessagePackMaxDepth = 64;
+
+void McpPackBigEndian(TArray<uint8> &Out, uint8 Marker, uint64 Value,
+                      int32 Bytes) {
+  Out.Add(Marker);
+  for (int32 Shift = (Bytes - 1) * 8; Shift >= 0; Shift -= 8) {
+    Out.Add(static_cast<uint8>(Value >> Shift));
+  }
+}
+
+void McpPackLength(TArray<uint8> &Out, uint32 Length, uint8 FixMarker,
+                   uint32 FixLimit, uint8 Marker8, uint8 Marker16,
+                   uint8 Marker32) {
+  if (Length < FixLimit) {
+    Out.Add(static_cast<uint8>(FixMarker | Length));
+  } else if (Marker8 != 0 && Length <= 0xFF) {
+    McpPackBigEndian(Out, Marker8, Length, 1);
+  } else if (Length <= 0xFFFF) {
+    McpPackBigEndian(Out, Marker16, Length, 2);
+  } else {
+    McpPackBigEndian(Out, Marker32, Length, 4);
+  }
+}
+
+void McpPackString(TArray<uint8> &Out, FStringView Value) {
+  if (Value.IsEmpty()) {
+    Out.Add(0xa0);
+    return;
+  }
+  const FTCHARToUTF8 Utf8(Value.GetData(), Value.Len());
+  // str8 (0xd9) exists for strings but not for arrays and maps.
+  McpPackLength(Out, static_cast<uint32>(Utf8.Length()), 0xa0, 32, 0xd9, 0xda,
+                0xdb);
+  Out.Append(reinterpret_cast<const uint8 *>(Utf8.Get()), Utf8.Length());
+}
+
+void McpPackInteger(TArray<uint8> &Out, int64 Integer) {
+  if (Integer >= 0) {
+    if (Integer < 128) {
+      Out.Add(static_cast<uint8>(Integer));
+    } else if (Integer <= 0xFF) {
+      McpPackBigEndian(Out, 0xcc, Integer, 1);
+    } else if (Integer <= 0xFFFF) {
+      McpPackBigEndian(Out, 0xcd, Integer, 2);
+    } else if (Integer <= 0xFFFFFFFFll) {
+      McpPackBigEndian(Out, 0xce, Integer, 4);
+    } else {
+      McpPackBigEndian(Out, 0xcf, Integer, 8);
+    }
+  } else if (Integer >= -32) {
+    Out.Add(static_cast<uint8>(static_cast<int8>(Integer)));
+  } else if (Integer >= MIN_int8) {
+    McpPackBigEndian(Out, 0xd0, static_cast<uint8>(Integer), 1);
+  } else if (Integer >= MIN_int16) {
+    McpPackBigEndian(Out, 0xd1, static_cast<uint16>(Integer), 2);
+  } else if (Integer >= MIN_int32) {
+    McpPackBigEndian(Out, 0xd2, static_cast<uint32>(Integer), 4);
+  } else {
+    McpPackBigEndian(Out, 0xd3, static_cast<uint64>(Integer), 8);
+  }
+}
+
+void McpPackNumber(TArray<uint8> &Out, double Value) {
+  // Integral values inside the exactly representable range use integer forms.
+  if (FMath::IsFinite(Value) && FMath::Abs(Value) <= 9007199254740992.0 &&
+      Value == FMath::FloorToDouble(Value)) {
+    McpPackInteger(Out, static_cast<int64>(Value));
+    return;
+  }
+
+  // Vertex and transform data is usually float precision to begin with.
+  const float Narrow = static_cast<float>(Value);
+  if (static_cast<double>(Narrow) == Value) {
+    uint32 Bits = 0;
+    FMemory::Memcpy(&Bits, &Narrow, sizeof(Bits));
+    McpPackBigEndian(Out, 0xca, Bits, 4);
+    return;
+  }
+  uint64 Bits = 0;
+  FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+  McpPackBigEndian(Out, 0xcb, Bits, 8);
+}
+
+void McpPackObject(TArray<uint8> &Out, const FJsonObject &Object);
+
+void McpPackValue(TArray<uint8> &Out, const TSharedPtr<FJsonValue> &Value) {
+  if (!Value.IsValid()) {
+    Out.Add(0xc0);
+    return;
+  }
+  switch (Value->Type) {
+  case EJson::String:
+    McpPackString(Out, Value->AsString());
+    break;
+  case EJson::Number:
+    McpPackNumber(Out, Value->AsNumber());
+    break;
+  case EJson::Boolean:
+    Out.Add(Value->AsBool() ? 0xc3 : 0xc2);
+    break;
+  case EJson::Array: {
+    const TArray<TSharedPtr<FJsonValue>> &Items = Value->AsArray();
+    McpPackLength(Out, static_cast<uint32>(Items.Num()), 0x90, 16, 0, 0xdc,
+                  0xdd);
+    for (const TSharedPtr<FJsonValue> &Item : Items) {
+      McpPackValue(Out, Item);
+    }
+    break;
+  }
+  case EJson::Object: {
+    const TSharedPtr<FJsonObject> Object = Value->AsObject();
+    if (Object.IsValid()) {
+      McpPackObject(Out, *Object);
+    } else {
+      Out.Add(0xc0);
+    }
+    break;
+  }
+  default:
+    Out.Add(0xc0);
+    break;
+  }
+}
+
+void McpPackObject(TArray<uint8> &Out, const FJsonObject &Object) {
+  McpPackLength(Out, static_cast<uint32>(Object.Values.Num()), 0x80, 16, 0,
+                0xde, 0xdf);
+  for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Object.Values) {
+    McpPackString(Out, Pair.Key);
+    McpPackValue(Out, Pair.Value);
+  }
+}
+
+class FMcpMessagePackReader {
+public:
+  FMcpMessagePackReader(const uint8 *InData, int32 InLength)
+      : Data(InData), Length(InLength) {}
+
+  bool IsAtEnd() const { return Offset == Length; }
+  const FString &GetError() const { return Error; }
+
+  TSharedPtr<FJsonValue> ReadValue(int32 Depth) {
+    if (Depth > McpMessagePackMaxDepth) {
+      return Fail(TEXT("document nests too deeply"));
+    }
+    uint8 Marker = 0;
+    if (!ReadByte(Marker)) {
+      return nullptr;
+    }
+
+    if (Marker <= 0x7f) {
+      return MakeShared<FJsonValueNumber>(Marker);
+    }
+    if (Marker >= 0xe0) {
+      return MakeShared<FJsonValueNumber>(static_cast<int8>(Marker));
+    }
+    if ((Marker & 0xf0) == 0x80) {
+      return ReadMap(Marker & 0x0f, Depth);
+    }
+    if ((Marker & 0xf0) == 0x90) {
+      return ReadArray(Marker & 0x0f, Depth);
+    }
+    if ((Marker & 0xe0) == 0xa0) {
+      return ReadString(Marker & 0x1f);
+    }
+
+    uint64 Raw = 0;
+    switch (Marker) {
+    case 0xc0:
+      return MakeShared<FJsonValueNull>();
+    case 0xc2:
+      return MakeShared<FJsonValueBoolean>(false);
+    case 0xc3:
+      return MakeShared<FJsonValueBoolean>(true);
+    case 0xca: {
+      if (!ReadBigEndian(4, Raw)) {
+        return nullptr;
+      }
+      const uint32 Bits = static_cast<uint32>(Raw);
+      float Value = 0.0f;
+      FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+      return MakeShared<FJsonValueNumber>(Value);
+    }
+    case 0xcb: {
+      if (!ReadBigEndian(8, Raw)) {
+        return nullptr;
+      }
+      double Value = 0.0;
+      FMemory::Memcpy(&Value, &Raw, sizeof(Value));
+      return MakeShared<FJsonValueNumber>(Value);
+    }
+    case 0xcc:
+    case 0xcd:
+    case 0xce:
+    case 0xcf:
+      if (!ReadBigEndian(1 << (Marker - 0xcc), Raw)) {
+        return nullptr;
+      }
+      return MakeShared<FJsonValueNumber>(static_cast<double>(Raw));
+    case 0xd0:
+    case 0xd1:
+    case 0xd2:
+    case 0xd3: {
+      const int32 Bytes = 1 << (Marker - 0xd0);
+      if (!ReadBigEndian(Bytes, Raw)) {
+        return nullptr;
+      }
+      // Sign-extend from the encoded width.
+      const int32 Unused = 64 - Bytes * 8;
+      const int64 Signed = static_cast<int64>(Raw << Unused) >> Unused;
+      return MakeShared<FJsonValueNumber>(static_cast<double>(Signed));
+    }
+    case 0xd9:
+    case 0xda:
+    case 0xdb:
+      if (!ReadBigEndian(1 << (Marker - 0xd9), Raw)) {
+        return nullptr;
+      }
+      return ReadString(Raw);
+    case 0xdc:
+    case 0xdd:
+      if (!ReadBigEndian(Marker == 0xdc ? 2 : 4, Raw)) {
+        return nullptr;
+      }
+      return ReadArray(Raw, Depth);
+    case 0xde:
+    case 0xdf:
+      if (!ReadBigEndian(Marker == 0xde ? 2 : 4, Raw)) {
+        return nullptr;
+      }
+      return ReadMap(Raw, Depth);
+    default:
+      return Fail(FString::Printf(TEXT("unsupported type 0x%02x"), Marker));
+    }
+  }
+
+private:
+  TSharedPtr<FJsonValue> Fail(const FString &Reason) {
+    if (Error.IsEmpty()) {
+      Error = FString::Printf(TEXT("%s at offset %d"), *Reason, Offset);
+    }
+    return nullptr;
+  }
+
+  bool ReadByte(uint8 &Out) {
+    if (Offset >= Length) {
+      Fail(TEXT("unexpected end of input"));
+      return false;
+    }
+    Out = Data[Offset++];
+    return true;
+  }
+
+  bool ReadBigEndian(int32 Bytes, uint64 &Out) {
+    if (Length - Offset < Bytes) {
+      Fail(TEXT("unexpected end of input"));
+      return false;
+    }
+    Out = 0;
+    for (int32 Index = 0; Index < Bytes; ++Index) {
+      Out = (Out << 8) | Data[Offset++];
+    }
+    return true;
+  }
+
+  // Every element takes at least one byte, so a count larger than the rest
+  // of the input is malformed and is rejected before anything is reserved.
+  bool CheckCount(uint64 Count) {
+    if (Count > static_cast<uint64>(Length - Offset)) {
+      Fail(TEXT("length exceeds input"));
+      return false;
+    }
+    return true;
+  }
+
+  TSharedPtr<FJsonValue> ReadString(uint64 Bytes) {
+    if (!CheckCount(Bytes)) {
+      return nullptr;
+    }
+    const FUTF8ToTCHAR Converted(
+        reinterpret_cast<const ANSICHAR *>(Data + Offset),
+        static_cast<int32>(Bytes));
+    Offset += static_cast<int32>(Bytes);
+    return MakeShared<FJsonValueString>(
+        FString(Converted.Length(), Converted.Get()));
+  }
+
+  TSharedPtr<FJsonValue> ReadArray(uint64 Count, int32 Depth) {
+    if (!CheckCount(Count)) {
+      return nullptr;
+    }
+    TArray<TSharedPtr<FJsonValue>> Items;
+    Items.Reserve(static_cast<int32>(Count));
+    for (uint64 Index = 0; Index < Count; ++Index) {
+      TSharedPtr<FJsonValue> Item = ReadValue(Depth + 1);
+      if (!Item.IsValid()) {
+        return nullptr;
+      }
+      Items.Add(MoveTemp(Item));
+    }
+    return MakeShared<FJsonValueArray>(MoveTemp(Items));
+  }
+
+  TSharedPtr<FJsonValue> ReadMap(uint64 Count, int32 Depth) {
+    if (!CheckCount(Count)) {
+      return nullptr;
+    }
+    TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    for (uint64 Index = 0; Index < Count; ++Index) {
+      TSharedPtr<FJsonValue> Key = ReadValue(Depth + 1);
+      if (!Key.IsValid()) {
+        return nullptr;
+      }
+      if (Key->Type != EJson::String) {
+        return Fail(TEXT("map key is not a string"));
+      }
+      TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+      if (!Value.IsValid()) {
+        return nullptr;
+      }
+      Object->SetField(Key->AsString(), Value);
+    }
+    return MakeShared<FJsonValueObject>(Object);
+  }
+
+  const uint8 *Data;
+  int32 Length;
+  int32 Offset = 0;
+  FString Error;
+};
+} // namespace
+
+void McpMessagePack::Encode(const TSharedRef<FJsonObject> &Object,
+                            TArray<uint8> &Out) {
+  McpPackObject(Out, *Object);
+}
+
+void McpMessagePack::EncodeString(FStringView Value, TArray<uint8> &Out) {
+  McpPackString(Out, Value);
+}
+
+void McpMessagePack::EncodeNumber(double Value, TArray<uint8> &Out) {
+  McpPackNumber(Out, Value);
+}
+
+void McpMessagePack::EncodeInteger(int64 Value, TArray<uint8> &Out) {
+  McpPackInteger(Out, Value);
+}
+
+TSharedPtr<FJsonObject> McpMessagePack::Decode(const uint8 *Data,
+                                               int32 Length,
+                                               FString &OutError) {
+  FMcpMessagePackReader Reader(Data, Length);
+  TSharedPtr<FJsonValue> Root = Reader.ReadValue(0);
+  if (!Root.IsValid()) {
+    OutError = Reader.GetError();
+    return nullptr;
+  }
+  if (Root->Type != EJson::Object) {
+    OutError = TEXT("top-level value is not a map");
+    return nullptr;
+  }
+  if (!Reader.IsAtEnd()) {
+    OutError = TEXT("trailing bytes after top-level map");
+    return nullptr;
+  }
+  return Root->AsObject();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * MessagePack encoding for automation frames, negotiated per connection in
+ * bridge_hello. Values map one-to-one onto the JSON DOM: integral numbers use
+ * the smallest integer form, other numbers float32 when that is exact and
+ * float64 otherwise, and maps always have string keys. bin and ext types are
+ * not produced and are rejected on input.
+ */
+namespace McpMessagePack
+{
+	/** Name advertised in bridge_hello/bridge_ack. */
+	inline const TCHAR* EncodingName() { return TEXT("msgpack"); }
+
+	/** Appends the encoding of Object to Out. */
+	void Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& Out);
+
+	/**
+	 * Append single values the way Encode would, for writers that produce
+	 * MessagePack incrementally (FMcpJsonStreamWriter).
+	 */
+	void EncodeString(FStringView Value, TArray<uint8>& Out);
+	void EncodeNumber(double Value, TArray<uint8>& Out);
+	void EncodeInteger(int64 Value, TArray<uint8>& Out);
+
+	/**
+	 * Decodes a single top-level map. Returns null and fills OutError when the
+	 * input is malformed, nests too deeply, uses unsupported types or has
+	 * trailing bytes.
+	 */
+	TSharedPtr<FJsonObject> Decode(const uint8* Data, int32 Length, FString& OutError);
+}
@@ -0,0 +1,99 @@
+#include "McpBridgeOpenMetrics.h"
+
+#include "McpBridgeLatencyHistogram.h"
+
+namespace {
+// Histogram bucket bounds in seconds, covering a quick status query up to a
+// bulk edit.
+const double McpLatencyBucketBounds[] = {0.001, 0.0025, 0.005, 0.01, 0.025,
+                                         0.05,  0.1,    0.25,  0.5,  1.0,
+                                         2.5,   5.0,    10.0,  30.0, 60.0};
+
+void McpAppendEscapedLabelValue(FString &Out, const FString &Value) {
+  for (const TCHAR C : Value) {
+    if (C == TEXT('\\')) {
+      Out += TEXT("\\\\");
+    } else if (C == TEXT('"')) {
+      Out += TEXT("\\\"");
+    } else if (C == TEXT('\n')) {
+      Out += TEXT("\\n");
+    } else {
+      Out.AppendChar(C);
+    }
+  }
+}
+} // namespace
+
+const TCHAR *FMcpOpenMetricsWriter::GetContentType() {
+  return TEXT("application/openmetrics-text; version=1.0.0; charset=utf-8");
+}
+
+void FMcpOpenMetricsWriter::BeginFamily(const TCHAR *Name, const TCHAR *Type,
+                                        const TCHAR *Help, const TCHAR *Unit) {
+  Text += FString::Printf(TEXT("# TYPE %s %s\n"), Name, Type);
+  if (Unit) {
+    Text += FString::Printf(TEXT("# UNIT %s %s\n"), Name, Unit);
+  }
+  Text += FString::Printf(TEXT("# HELP %s %s\n"), Name, Help);
+}
+
+void FMcpOpenMetricsWriter::WriteSampleName(
+    const TCHAR *Name, const TCHAR *Suffix,
+    TConstArrayView<FMcpMetricLabel> Labels, const TCHAR *ExtraLabelName,
+    const FString &ExtraLabelValue) {
+  Text += Name;
+  Text += Suffix;
+  if (Labels.Num() == 0 && !ExtraLabelName) {
+    return;
+  }
+  Text.AppendChar(TEXT('{'));
+  bool bFirst = true;
+  auto AppendLabel = [this, &bFirst](const TCHAR *LabelName,
+                                     const FString &Value) {
+    if (!bFirst) {
+      Text.AppendChar(TEXT(','));
+    }
+    bFirst = false;
+    Text += LabelName;
+    Text += TEXT("=\"");
+    McpAppendEscapedLabelValue(Text, Value);
+    Text.AppendChar(TEXT('"'));
+  };
+  for (const FMcpMetricLabel &Label : Labels) {
+    AppendLabel(Label.Name, Label.Value);
+  }
+  if (ExtraLabelName) {
+    AppendLabel(ExtraLabelName, ExtraLabelValue);
+  }
+  Text.AppendChar(TEXT('}'));
+}
+
+void FMcpOpenMetricsWriter::WriteSample(
+    const TCHAR *Name, int64 Value, TConstArrayView<FMcpMetricLabel> Labels) {
+  WriteSampleName(Name, TEXT(""), Labels);
+  Text += FString::Printf(TEXT(" %lld\n"), Value);
+}
+
+void FMcpOpenMetricsWriter::WriteHistogram(
+    const TCHAR *Name, const FMcpLatencyHistogram &Histogram,
+    TConstArrayView<FMcpMetricLabel> Labels) {
+  for (const double Bound : McpLatencyBucketBounds) {
+    WriteSampleName(Name, TEXT("_bucket"), Labels, TEXT("le"),
+                    FString::SanitizeFloat(Bound));
+    Text += FString::Printf(TEXT(" %lld\n"),
+                            Histogram.GetCountAtOrBelow(Bound));
+  }
+  WriteSampleName(Name, TEXT("_bucket"), Labels, TEXT("le"), TEXT("+Inf"));
+  Text += FString::Printf(TEXT(" %lld\n"), Histogram.GetCount());
+  WriteSampleName(Name, TEXT("_count"), Labels);
+  Text += FString::Printf(TEXT(" %lld\n"), Histogram.GetCount());
+  WriteSampleName(Name, TEXT("_sum"), Labels);
+  Text.AppendChar(TEXT(' '));
+  Text += FString::SanitizeFloat(Histogram.GetSumSeconds());
+  Text.AppendChar(TEXT('\n'));
+}
+
+FString FMcpOpenMetricsWriter::Finish() {
+  Text += TEXT("# EOF\n");
+  return MoveTemp(Text);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FMcpLatencyHistogram;
+
+/** One name="value" pair on an OpenMetrics sample. */
+struct FMcpMetricLabel
+{
+	const TCHAR* Name;
+	FString Value;
+};
+
+/**
+ * Builds the OpenMetrics 1.0 text exposition served on GET /metrics, the
+ * format Prometheus scrapes. Families are written one at a time: BeginFamily
+ * emits the TYPE/HELP/UNIT metadata, then the family's samples follow.
+ *
+ *   Writer.BeginFamily(TEXT("mcp_bridge_requests"), TEXT("counter"), TEXT("..."));
+ *   const FMcpMetricLabel Labels[] = {{TEXT("action"), Action}};
+ *   Writer.WriteSample(TEXT("mcp_bridge_requests_total"), Count, Labels);
+ *   FString Body = Writer.Finish();
+ */
+class FMcpOpenMetricsWriter
+{
+public:
+	/** MIME type of the text returned by Finish. */
+	static const TCHAR* GetContentType();
+
+	/**
+	 * Starts a metric family. Type is "counter", "gauge" or "histogram";
+	 * Unit, when given, must also be the last segment of Name.
+	 */
+	void BeginFamily(const TCHAR* Name, const TCHAR* Type, const TCHAR* Help, const TCHAR* Unit = nullptr);
+
+	void WriteSample(const TCHAR* Name, int64 Value, TConstArrayView<FMcpMetricLabel> Labels = TConstArrayView<FMcpMetricLabel>());
+
+	/**
+	 * Writes Histogram as the _bucket/_count/_sum samples of the histogram
+	 * family Name, cumulated at fixed latency bounds from 1 ms to 60 s.
+	 */
+	void WriteHistogram(const TCHAR* Name, const FMcpLatencyHistogram& Histogram, TConstArrayView<FMcpMetricLabel> Labels);
+
+	/** Terminates the exposition and returns it. */
+	FString Finish();
+
+private:
+	void WriteSampleName(const TCHAR* Name, const TCHAR* Suffix, TConstArrayView<FMcpMetricLabel> Labels, const TCHAR* ExtraLabelName = nullptr, const FString& ExtraLabelValue = FString());
+
+	FString Text;
+};
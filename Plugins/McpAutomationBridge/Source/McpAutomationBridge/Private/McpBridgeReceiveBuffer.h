@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-connection receive buffer for the WebSocket frame parser. Socket reads
+ * land directly in the free space after the unread bytes, frames are parsed
+ * (and unmasked) in place, and consuming a frame only advances the read
+ * offset. Unread bytes are moved to the front only when a read needs more
+ * contiguous space than is left at the tail, so every frame stays contiguous
+ * and the old per-frame RemoveAt(0, N) memmove disappears.
+ *
+ * Not thread-safe; owned by the connection's receive thread.
+ */
+class FMcpReceiveBuffer
+{
+public:
+	/** Capacity kept after a large message has been drained. */
+	static constexpr int32 RetainedCapacity = 256 * 1024;
+
+	int32 Num() const { return WriteOffset - ReadOffset; }
+	bool IsEmpty() const { return WriteOffset == ReadOffset; }
+
+	/** Unread bytes; valid until the next PrepareWrite(). */
+	const uint8* GetData() const { return Storage.GetData() + ReadOffset; }
+	uint8* GetMutableData() { return Storage.GetData() + ReadOffset; }
+
+	/**
+	 * Returns a write pointer with room for at least MinBytes; OutCapacity
+	 * receives the full contiguous space available. Follow with CommitWrite().
+	 */
+	uint8* PrepareWrite(int32 MinBytes, int32& OutCapacity)
+	{
+		if (Storage.Num() - WriteOffset < MinBytes)
+		{
+			const int32 Unread = Num();
+			if (ReadOffset > 0)
+			{
+				if (Unread > 0)
+				{
+					FMemory::Memmove(Storage.GetData(), Storage.GetData() + ReadOffset, Unread);
+				}
+				ReadOffset = 0;
+				WriteOffset = Unread;
+			}
+			if (Storage.Num() - WriteOffset < MinBytes)
+			{
+				Storage.SetNumUninitialized(FMath::Max(Storage.Num() * 2, WriteOffset + MinBytes));
+			}
+		}
+		OutCapacity = Storage.Num() - WriteOffset;
+		return Storage.GetData() + WriteOffset;
+	}
+
+	void CommitWrite(int32 Bytes)
+	{
+		check(Bytes >= 0 && WriteOffset + Bytes <= Storage.Num());
+		WriteOffset += Bytes;
+	}
+
+	void Append(const uint8* Data, int32 Bytes)
+	{
+		if (Bytes <= 0)
+		{
+			return;
+		}
+		int32 Capacity = 0;
+		FMemory::Memcpy(PrepareWrite(Bytes, Capacity), Data, Bytes);
+		CommitWrite(Bytes);
+	}
+
+	/** Drops Bytes from the front of the unread data. */
+	void Consume(int32 Bytes)
+	{
+		check(Bytes >= 0 && Bytes <= Num());
+		ReadOffset += Bytes;
+		if (ReadOffset == WriteOffset)
+		{
+			ReadOffset = 0;
+			WriteOffset = 0;
+			// Give back memory held for a rare multi-megabyte message.
+			if (Storage.Num() > RetainedCapacity)
+			{
+				Storage.Empty(RetainedCapacity);
+				Storage.SetNumUninitialized(RetainedCapacity);
+			}
+		}
+	}
+
+	void Reset()
+	{
+		ReadOffset = 0;
+		WriteOffset = 0;
+	}
+
+private:
+	TArray<uint8> Storage;
+	int32 ReadOffset = 0;
+	int32 WriteOffset = 0;
+};
@@ -0,0 +1,110 @@
+#include "McpBridgeResponseStream.h"
+
+#include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeWebSocket.h"
+
+FMcpResponseChunkSink::FMcpResponseChunkSink(
+    TSharedPtr<FMcpBridgeWebSocket> InSocket, const FString &InRequestId,
+    int32 InChunkBytes)
+    : Socket(MoveTemp(InSocket)), RequestId(InRequestId),
+      ChunkBytes(FMath::Max(1, InChunkBytes)) {}
+
+void FMcpResponseChunkSink::BeginChunk(FMcpJsonStreamWriter &Writer,
+                                       FStringView Path) const {
+  Writer.BeginObject();
+  Writer.WriteString(TEXT("type"), TEXT("response_chunk"));
+  Writer.WriteString(TEXT("requestId"), RequestId);
+  Writer.WriteInteger(TEXT("seq"), NextSeq);
+  Writer.WriteString(TEXT("path"), Path);
+  Writer.BeginArray(TEXT("items"));
+}
+
+bool FMcpResponseChunkSink::SendChunk(FMcpJsonStreamWriter &Writer,
+                                      bool bFinal) {
+  Writer.EndArray();
+  Writer.WriteBool(TEXT("final"), bFinal);
+  Writer.EndObject();
+  if (bFailed) {
+    return false;
+  }
+  // Chunks are queued without waiting for the client. The socket drains its
+  // queue concurrently, so the high-water mark is no sign of a stuck client;
+  // only a send that would push the queue past MaxSendQueueBytes fails, and
+  // that disconnects the client anyway.
+  if (!Socket.IsValid() ||
+      !Socket->SendTextWithReservedHeader(
+          Writer.GetFrameBuffer(), FMcpJsonStreamWriter::FrameHeaderReserve)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Failed to send response_chunk %d for RequestId=%s"), NextSeq,
+           *RequestId);
+    FailureMessage = TEXT("Connection failed while streaming response chunks");
+    bFailed = true;
+    return false;
+  }
+  ++NextSeq;
+  return true;
+}
+
+FMcpStreamedArray::FMcpStreamedArray(FMcpJsonStreamWriter &InWriter,
+                                     FStringView InPath)
+    : Writer(InWriter), Sink(InWriter.GetChunkSink()), Path(InPath) {
+  int32 LastDot = INDEX_NONE;
+  Path.FindLastChar(TEXT('.'), LastDot);
+  Writer.BeginArray(FStringView(Path).RightChop(LastDot + 1));
+  if (Sink) {
+    Chunk = MakeUnique<FMcpJsonStreamWriter>();
+    Sink->BeginChunk(*Chunk, Path);
+    ItemsOffset = Chunk->GetPayloadSize();
+  }
+}
+
+FMcpStreamedArray::~FMcpStreamedArray() {
+  if (!bEnded) {
+    End();
+  }
+}
+
+FMcpJsonStreamWriter &FMcpStreamedArray::BeginItem() {
+  return Chunk.IsValid() ? *Chunk : Writer;
+}
+
+void FMcpStreamedArray::EndItem() {
+  ++Count;
+  if (!Chunk.IsValid() || Chunk->GetPayloadSize() < Sink->GetChunkBytes()) {
+    return;
+  }
+  // After a failed send the items are discarded rather than accumulated;
+  // the response will report the failure instead of a result.
+  Sink->SendChunk(*Chunk, false);
+  ++ChunksSent;
+  Chunk->Reset();
+  Sink->BeginChunk(*Chunk, Path);
+  ItemsOffset = Chunk->GetPayloadSize();
+}
+
+void FMcpStreamedArray::AddItem(const TSharedPtr<FJsonValue> &Item) {
+  BeginItem().WriteJsonValue(Item);
+  EndItem();
+}
+
+int32 FMcpStreamedArray::End() {
+  if (bEnded) {
+    return Count;
+  }
+  bEnded = true;
+  if (Chunk.IsValid()) {
+    const int32 ItemBytes = Chunk->GetPayloadSize() - ItemsOffset;
+    if (ChunksSent == 0 && !Sink->HasFailed()) {
+      // Never filled a chunk: keep the response self-contained.
+      if (ItemBytes > 0) {
+        Writer.WriteRawValue(Chunk->GetPayloadData() + ItemsOffset, ItemBytes);
+      }
+    } else {
+      Sink->SendChunk(*Chunk, true);
+    }
+    Chunk.Reset();
+  }
+  Writer.EndArray();
+  return Count;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+class FMcpBridgeWebSocket;
+class FMcpJsonStreamWriter;
+
+/**
+ * Destination for the response_chunk frames of one streamed automation
+ * response. FMcpConnectionManager creates it when the target socket
+ * negotiated responseChunkBytes in bridge_hello and attaches it to the
+ * response writer for the duration of the handler's write callback.
+ *
+ * Wire format, one text frame per chunk, all sent before the response:
+ *   {"type":"response_chunk","requestId":"...","seq":0,"path":"data.actors",
+ *    "items":[...],"final":false}
+ * seq counts from 0 across the whole response; the last chunk of each array
+ * has final set. The automation_response that follows carries "chunks" (the
+ * number of chunk frames) and an empty array at every chunked path.
+ */
+class FMcpResponseChunkSink
+{
+public:
+	FMcpResponseChunkSink(TSharedPtr<FMcpBridgeWebSocket> InSocket, const FString& InRequestId, int32 InChunkBytes);
+
+	/** Payload size at which a chunk is sent; a single larger item still goes out whole. */
+	int32 GetChunkBytes() const { return ChunkBytes; }
+	int32 GetNumChunksSent() const { return NextSeq; }
+	/** True once a chunk failed to send; the response must then report an error. */
+	bool HasFailed() const { return bFailed; }
+	/** Why the stream was abandoned, for the error response. */
+	const FString& GetFailureMessage() const { return FailureMessage; }
+
+	/** Starts a response_chunk message in Writer, leaving its "items" array open. */
+	void BeginChunk(FMcpJsonStreamWriter& Writer, FStringView Path) const;
+
+	/**
+	 * Closes a message started with BeginChunk and sends it. The producing
+	 * handler runs on the game thread and is never made to wait for the
+	 * client; the stream is abandoned only when the connection fails, which
+	 * includes the outbound queue exceeding MaxSendQueueBytes.
+	 */
+	bool SendChunk(FMcpJsonStreamWriter& Writer, bool bFinal);
+
+private:
+	TSharedPtr<FMcpBridgeWebSocket> Socket;
+	FString RequestId;
+	int32 ChunkBytes = 0;
+	int32 NextSeq = 0;
+	bool bFailed = false;
+	FString FailureMessage;
+};
+
+/**
+ * Writes a possibly very large array member of a streamed result
+ * (UMcpAutomationBridgeSubsystem::SendAutomationResponseStreamed).
+ *
+ * Without a chunk sink on the writer (chunking not negotiated, MessagePack,
+ * batch items) the items are written inline and the result looks exactly as
+ * if it had been built as one array. With a sink, items are collected into
+ * response_chunk frames of about GetChunkBytes() each and sent as the handler
+ * produces them; an array that never fills a chunk is still written inline.
+ *
+ *   FMcpStreamedArray Actors(Writer, TEXT("data.actors"));
+ *   for (AActor* Actor : AllActors)
+ *   {
+ *       FMcpJsonStreamWriter& Item = Actors.BeginItem();
+ *       Item.BeginObject(); ...; Item.EndObject();
+ *       Actors.EndItem();
+ *   }
+ *   Actors.End();
+ */
+class FMcpStreamedArray
+{
+public:
+	/**
+	 * Opens the array. Path is its dotted location inside the result object
+	 * (reported to the client in every chunk); the last segment is the key
+	 * written into the currently open object.
+	 */
+	FMcpStreamedArray(FMcpJsonStreamWriter& InWriter, FStringView InPath);
+	~FMcpStreamedArray();
+
+	FMcpStreamedArray(const FMcpStreamedArray&) = delete;
+	FMcpStreamedArray& operator=(const FMcpStreamedArray&) = delete;
+
+	/** Returns the writer to put exactly one value (the next item) into. */
+	FMcpJsonStreamWriter& BeginItem();
+	/** Finishes the item started by BeginItem, sending a chunk when one is full. */
+	void EndItem();
+	void AddItem(const TSharedPtr<FJsonValue>& Item);
+
+	/** Closes the array (and sends the final chunk); returns the item count. */
+	int32 End();
+
+	int32 Num() const { return Count; }
+
+private:
+	FMcpJsonStreamWriter& Writer;
+	FMcpResponseChunkSink* Sink = nullptr;
+	FString Path;
+	TUniquePtr<FMcpJsonStreamWriter> Chunk;
+	/** Payload offset in Chunk where the first item starts. */
+	int32 ItemsOffset = 0;
+	int32 Count = 0;
+	int32 ChunksSent = 0;
+	bool bEnded = false;
+};
@@ -0,0 +1,493 @@
+#include "McpBridgeSocketPoller.h"
+
+#include "HAL/PlatformProcess.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#if PLATFORM_LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+#endif
+
+namespace {
+// Wait cap used when no pollable wakeup exists (Windows), so Wake() is
+// still observed promptly.
+constexpr int32 UnpollableWakeupSliceMs = 250;
+
+bool IsNativeWouldBlock() {
+#if PLATFORM_WINDOWS
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+bool IsNativeInterrupted() {
+#if PLATFORM_WINDOWS
+  return WSAGetLastError() == WSAEINTR;
+#else
+  return errno == EINTR;
+#endif
+}
+} // namespace
+
+FMcpSocketWakeup::FMcpSocketWakeup()
+    : ReadHandle(-1), WriteHandle(-1), bSignaled(false) {}
+
+FMcpSocketWakeup::~FMcpSocketWakeup() { Reset(); }
+
+bool FMcpSocketWakeup::Initialize() {
+  bSignaled = false;
+  if (ReadHandle >= 0) {
+    Drain();
+    return true;
+  }
+
+#if PLATFORM_LINUX
+  const int Fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (Fd < 0) {
+    return false;
+  }
+  ReadHandle = Fd;
+  WriteHandle = Fd;
+  return true;
+#elif PLATFORM_WINDOWS
+  // No pollable user event exists for WSAPoll; waiters use bounded slices.
+  return false;
+#else
+  int Fds[2] = {-1, -1};
+  if (pipe(Fds) != 0) {
+    return false;
+  }
+  for (const int Fd : Fds) {
+    fcntl(Fd, F_SETFL, fcntl(Fd, F_GETFL) | O_NONBLOCK);
+    fcntl(Fd, F_SETFD, FD_CLOEXEC);
+  }
+  ReadHandle = Fds[0];
+  WriteHandle = Fds[1];
+  return true;
+#endif
+}
+
+void FMcpSocketWakeup::Reset() {
+#if !PLATFORM_WINDOWS
+  if (WriteHandle >= 0 && WriteHandle != ReadHandle) {
+    close(WriteHandle);
+  }
+  if (ReadHandle >= 0) {
+    close(ReadHandle);
+  }
+#endif
+  ReadHandle = -1;
+  WriteHandle = -1;
+}
+
+void FMcpSocketWakeup::Signal() {
+  bSignaled = true;
+#if !PLATFORM_WINDOWS
+  if (WriteHandle < 0) {
+    return;
+  }
+#if PLATFORM_LINUX
+  const uint64 One = 1;
+  const ssize_t Written = write(WriteHandle, &One, sizeof(One));
+#else
+  const uint8 One = 1;
+  const ssize_t Written = write(WriteHandle, &One, sizeof(One));
+#endif
+  // EAGAIN means a wakeup is already pending, which is all we need.
+  (void)Written;
+#endif
+}
+
+void FMcpSocketWakeup::Drain() {
+  bSignaled = false;
+#if !PLATFORM_WINDOWS
+  if (ReadHandle < 0) {
+    return;
+  }
+  uint8 Scratch[64];
+  while (read(ReadHandle, Scratch, sizeof(Scratch)) > 0) {
+  }
+#endif
+}
+
+EMcpSocketWaitResult McpWaitForReadable(UPTRINT NativeHandle,
+                                        FMcpSocketWakeup *Wakeup,
+                                        int32 TimeoutMs) {
+  if (Wakeup && Wakeup->IsSignaled()) {
+    return EMcpSocketWaitResult::Woken;
+  }
+
+#if PLATFORM_WINDOWS
+  WSAPOLLFD Fd;
+  Fd.fd = static_cast<SOCKET>(NativeHandle);
+  Fd.events = POLLRDNORM;
+  Fd.revents = 0;
+  const int Result = WSAPoll(&Fd, 1, TimeoutMs < 0 ? -1 : TimeoutMs);
+  if (Result < 0) {
+    return EMcpSocketWaitResult::Error;
+  }
+  if (Wakeup && Wakeup->IsSignaled()) {
+    return EMcpSocketWaitResult::Woken;
+  }
+  if (Result == 0) {
+    return EMcpSocketWaitResult::TimedOut;
+  }
+  if ((Fd.revents & POLLNVAL) != 0) {
+    return EMcpSocketWaitResult::Error;
+  }
+  return EMcpSocketWaitResult::Readable;
+#else
+  pollfd Fds[2];
+  Fds[0].fd = static_cast<int>(NativeHandle);
+  Fds[0].events = POLLIN;
+  Fds[0].revents = 0;
+  nfds_t Count = 1;
+  if (Wakeup && Wakeup->IsPollable()) {
+    Fds[1].fd = Wakeup->GetReadHandle();
+    Fds[1].events = POLLIN;
+    Fds[1].revents = 0;
+    Count = 2;
+  }
+
+  int Result = 0;
+  do {
+    Result = poll(Fds, Count, TimeoutMs < 0 ? -1 : TimeoutMs);
+  } while (Result < 0 && errno == EINTR);
+
+  if (Result < 0) {
+    return EMcpSocketWaitResult::Error;
+  }
+  if ((Count > 1 && Fds[1].revents != 0) ||
+      (Wakeup && Wakeup->IsSignaled())) {
+    return EMcpSocketWaitResult::Woken;
+  }
+  if (Result == 0) {
+    return EMcpSocketWaitResult::TimedOut;
+  }
+  if ((Fds[0].revents & POLLNVAL) != 0) {
+    return EMcpSocketWaitResult::Error;
+  }
+  // POLLHUP/POLLERR are reported as readable so recv() surfaces the failure.
+  return EMcpSocketWaitResult::Readable;
+#endif
+}
+
+FMcpSocketPollSet::FMcpSocketPollSet()
+#if PLATFORM_LINUX
+    : EpollHandle(-1)
+#endif
+{
+}
+
+FMcpSocketPollSet::~FMcpSocketPollSet() {
+#if PLATFORM_LINUX
+  if (EpollHandle >= 0) {
+    close(EpollHandle);
+    EpollHandle = -1;
+  }
+#endif
+  Wakeup.Reset();
+}
+
+bool FMcpSocketPollSet::Initialize() {
+  // A missing wakeup only degrades Wake() to slice-bounded waits.
+  Wakeup.Initialize();
+
+#if PLATFORM_LINUX
+  if (EpollHandle >= 0) {
+    return true;
+  }
+  EpollHandle = epoll_create1(EPOLL_CLOEXEC);
+  if (EpollHandle < 0) {
+    return false;
+  }
+  if (Wakeup.IsPollable()) {
+    epoll_event Event = {};
+    Event.events = EPOLLIN;
+    Event.data.u64 = static_cast<uint64>(Wakeup.GetReadHandle());
+    epoll_ctl(EpollHandle, EPOLL_CTL_ADD, Wakeup.GetReadHandle(), &Event);
+  }
+#endif
+  return true;
+}
+
+bool FMcpSocketPollSet::Add(UPTRINT Handle) {
+#if PLATFORM_LINUX
+  epoll_event Event = {};
+  Event.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+  Event.data.u64 = static_cast<uint64>(Handle);
+  if (epoll_ctl(EpollHandle, EPOLL_CTL_ADD, static_cast<int>(Handle), &Event) !=
+      0) {
+    return false;
+  }
+#endif
+  Handles.AddUnique(Handle);
+  return true;
+}
+
+void FMcpSocketPollSet::Remove(UPTRINT Handle) {
+#if PLATFORM_LINUX
+  epoll_event Event = {};
+  epoll_ctl(EpollHandle, EPOLL_CTL_DEL, static_cast<int>(Handle), &Event);
+#endif
+  Handles.RemoveSingleSwap(Handle);
+  WriteHandles.RemoveSingleSwap(Handle);
+}
+
+void FMcpSocketPollSet::SetWriteInterest(UPTRINT Handle, bool bEnable) {
+  if (bEnable) {
+    WriteHandles.AddUnique(Handle);
+  } else {
+    WriteHandles.RemoveSingleSwap(Handle);
+  }
+#if PLATFORM_LINUX
+  // Re-arming with EPOLLOUT reports the handle again if it is already
+  // writable, so no edge is missed between the last WouldBlock and here.
+  epoll_event Event = {};
+  Event.events = EPOLLIN | EPOLLRDHUP | EPOLLET | (bEnable ? EPOLLOUT : 0);
+  Event.data.u64 = static_cast<uint64>(Handle);
+  epoll_ctl(EpollHandle, EPOLL_CTL_MOD, static_cast<int>(Handle), &Event);
+#endif
+}
+
+int32 FMcpSocketPollSet::Wait(int32 TimeoutMs, TArray<UPTRINT> &OutReady) {
+  OutReady.Reset();
+  if (Wakeup.IsSignaled()) {
+    Wakeup.Drain();
+    return 0;
+  }
+  if (!Wakeup.IsPollable() &&
+      (TimeoutMs < 0 || TimeoutMs > UnpollableWakeupSliceMs)) {
+    TimeoutMs = UnpollableWakeupSliceMs;
+  }
+
+#if PLATFORM_LINUX
+  epoll_event Events[64];
+  int Result = 0;
+  do {
+    Result = epoll_wait(EpollHandle, Events, UE_ARRAY_COUNT(Events), TimeoutMs);
+  } while (Result < 0 && errno == EINTR);
+  if (Result < 0) {
+    return -1;
+  }
+  for (int Index = 0; Index < Result; ++Index) {
+    const UPTRINT Handle = static_cast<UPTRINT>(Events[Index].data.u64);
+    if (Wakeup.IsPollable() &&
+        Handle == static_cast<UPTRINT>(Wakeup.GetReadHandle())) {
+      Wakeup.Drain();
+      continue;
+    }
+    OutReady.Add(Handle);
+  }
+#else
+#if PLATFORM_WINDOWS
+  TArray<WSAPOLLFD, TInlineAllocator<16>> Fds;
+#else
+  TArray<pollfd, TInlineAllocator<16>> Fds;
+#endif
+  Fds.SetNumZeroed(Handles.Num() + (Wakeup.IsPollable() ? 1 : 0));
+  for (int32 Index = 0; Index < Handles.Num(); ++Index) {
+    const bool bWantsWrite = WriteHandles.Contains(Handles[Index]);
+#if PLATFORM_WINDOWS
+    Fds[Index].fd = static_cast<SOCKET>(Handles[Index]);
+    Fds[Index].events = POLLRDNORM | (bWantsWrite ? POLLWRNORM : 0);
+#else
+    Fds[Index].fd = static_cast<int>(Handles[Index]);
+    Fds[Index].events = POLLIN | (bWantsWrite ? POLLOUT : 0);
+#endif
+  }
+#if !PLATFORM_WINDOWS
+  if (Wakeup.IsPollable()) {
+    Fds.Last().fd = Wakeup.GetReadHandle();
+    Fds.Last().events = POLLIN;
+  }
+#endif
+
+  int Result = 0;
+  do {
+#if PLATFORM_WINDOWS
+    // WSAPoll rejects an empty set; treat it as a plain sleep.
+    if (Fds.Num() == 0) {
+      FPlatformProcess::SleepNoStats(TimeoutMs / 1000.0f);
+      break;
+    }
+    Result = WSAPoll(Fds.GetData(), static_cast<ULONG>(Fds.Num()), TimeoutMs);
+#else
+    Result = poll(Fds.GetData(), static_cast<nfds_t>(Fds.Num()), TimeoutMs);
+#endif
+  } while (Result < 0 && IsNativeInterrupted());
+  if (Result < 0) {
+    return -1;
+  }
+  for (int32 Index = 0; Index < Handles.Num(); ++Index) {
+    if (Fds[Index].revents != 0) {
+      OutReady.Add(Handles[Index]);
+    }
+  }
+#endif
+
+  if (Wakeup.IsSignaled()) {
+    Wakeup.Drain();
+  }
+  return OutReady.Num();
+}
+
+void FMcpSocketPollSet::Wake() { Wakeup.Signal(); }
+
+bool McpNativeConfigureStreamSocket(UPTRINT Handle) {
+  int NoDelay = 1;
+#if PLATFORM_WINDOWS
+  u_long NonBlocking = 1;
+  if (ioctlsocket(static_cast<SOCKET>(Handle), FIONBIO, &NonBlocking) != 0) {
+    return false;
+  }
+  setsockopt(static_cast<SOCKET>(Handle), IPPROTO_TCP, TCP_NODELAY,
+             reinterpret_cast<const char *>(&NoDelay), sizeof(NoDelay));
+#else
+  const int Fd = static_cast<int>(Handle);
+  const int Flags = fcntl(Fd, F_GETFL, 0);
+  if (Flags < 0 || fcntl(Fd, F_SETFL, Flags | O_NONBLOCK) != 0) {
+    return false;
+  }
+  setsockopt(Fd, IPPROTO_TCP, TCP_NODELAY, &NoDelay, sizeof(NoDelay));
+#if PLATFORM_MAC
+  int NoSigPipe = 1;
+  setsockopt(Fd, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+#endif
+  return true;
+}
+
+EMcpSocketIoResult McpNativeAccept(UPTRINT ListenHandle,
+                                   UPTRINT &OutClientHandle) {
+  OutClientHandle = 0;
+  for (;;) {
+#if PLATFORM_WINDOWS
+    const SOCKET Client =
+        accept(static_cast<SOCKET>(ListenHandle), nullptr, nullptr);
+    if (Client != INVALID_SOCKET) {
+      OutClientHandle = static_cast<UPTRINT>(Client);
+      return EMcpSocketIoResult::Ok;
+    }
+#else
+    const int Client = accept(static_cast<int>(ListenHandle), nullptr, nullptr);
+    if (Client >= 0) {
+      fcntl(Client, F_SETFD, FD_CLOEXEC);
+      OutClientHandle = static_cast<UPTRINT>(Client);
+      return EMcpSocketIoResult::Ok;
+    }
+#endif
+    if (IsNativeInterrupted()) {
+      continue;
+    }
+    return IsNativeWouldBlock() ? EMcpSocketIoResult::WouldBlock
+                               : EMcpSocketIoResult::Error;
+  }
+}
+
+EMcpSocketIoResult McpNativeRecv(UPTRINT Handle, uint8 *Data, int32 Length,
+                                 int32 &OutBytesRead) {
+  OutBytesRead = 0;
+  for (;;) {
+#if PLATFORM_WINDOWS
+    const int Result = recv(static_cast<SOCKET>(Handle),
+                            reinterpret_cast<char *>(Data), Length, 0);
+#else
+    const ssize_t Result = recv(static_cast<int>(Handle), Data, Length, 0);
+#endif
+    if (Result > 0) {
+      OutBytesRead = static_cast<int32>(Result);
+      return EMcpSocketIoResult::Ok;
+    }
+    if (Result == 0) {
+      return EMcpSocketIoResult::Closed;
+    }
+    if (IsNativeInterrupted()) {
+      continue;
+    }
+    return IsNativeWouldBlock() ? EMcpSocketIoResult::WouldBlock
+                               : EMcpSocketIoResult::Error;
+  }
+}
+
+EMcpSocketIoResult McpNativeSend(UPTRINT Handle, const uint8 *Data,
+                                 int32 Length, int32 &OutBytesSent) {
+  OutBytesSent = 0;
+  for (;;) {
+#if PLATFORM_WINDOWS
+    const int Result = send(static_cast<SOCKET>(Handle),
+                            reinterpret_cast<const char *>(Data), Length, 0);
+#elif PLATFORM_LINUX
+    const ssize_t Result =
+        send(static_cast<int>(Handle), Data, Length, MSG_NOSIGNAL);
+#else
+    const ssize_t Result = send(static_cast<int>(Handle), Data, Length, 0);
+#endif
+    if (Result >= 0) {
+      OutBytesSent = static_cast<int32>(Result);
+      return EMcpSocketIoResult::Ok;
+    }
+    if (IsNativeInterrupted()) {
+      continue;
+    }
+    return IsNativeWouldBlock() ? EMcpSocketIoResult::WouldBlock
+                               : EMcpSocketIoResult::Error;
+  }
+}
+
+bool McpWaitForWritable(UPTRINT Handle, int32 TimeoutMs) {
+#if PLATFORM_WINDOWS
+  WSAPOLLFD Fd;
+  Fd.fd = static_cast<SOCKET>(Handle);
+  Fd.events = POLLWRNORM;
+  Fd.revents = 0;
+  const int Result = WSAPoll(&Fd, 1, TimeoutMs);
+  return Result > 0 && (Fd.revents & (POLLERR | POLLHUP | POLLNVAL)) == 0;
+#else
+  pollfd Fd;
+  Fd.fd = static_cast<int>(Handle);
+  Fd.events = POLLOUT;
+  Fd.revents = 0;
+  int Result = 0;
+  do {
+    Result = poll(&Fd, 1, TimeoutMs);
+  } while (Result < 0 && errno == EINTR);
+  return Result > 0 && (Fd.revents & (POLLERR | POLLHUP | POLLNVAL)) == 0;
+#endif
+}
+
+void McpNativeShutdown(UPTRINT Handle) {
+  if (Handle == 0) {
+    return;
+  }
+#if PLATFORM_WINDOWS
+  shutdown(static_cast<SOCKET>(Handle), SD_BOTH);
+#else
+  shutdown(static_cast<int>(Handle), SHUT_RDWR);
+#endif
+}
+
+void McpNativeClose(UPTRINT Handle) {
+  if (Handle == 0) {
+    return;
+  }
+#if PLATFORM_WINDOWS
+  closesocket(static_cast<SOCKET>(Handle));
+#else
+  close(static_cast<int>(Handle));
+#endif
+}
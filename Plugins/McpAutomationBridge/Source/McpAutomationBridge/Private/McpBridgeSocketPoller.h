@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+
+/** Outcome of a readiness wait on a bridge socket. */
+enum class EMcpSocketWaitResult : uint8
+{
+	Readable,
+	Woken,
+	TimedOut,
+	Error
+};
+
+/**
+ * Cross-thread wakeup that can be polled alongside socket descriptors so a
+ * blocked reader returns immediately when the connection is stopped.
+ *
+ * Linux uses an eventfd and other POSIX platforms a non-blocking self-pipe.
+ * Windows has no pollable user event for sockets; there Signal() only flips
+ * the flag and callers bound their waits with a short slice instead.
+ */
+class FMcpSocketWakeup
+{
+public:
+	FMcpSocketWakeup();
+	~FMcpSocketWakeup();
+
+	FMcpSocketWakeup(const FMcpSocketWakeup&) = delete;
+	FMcpSocketWakeup& operator=(const FMcpSocketWakeup&) = delete;
+
+	/** Allocates the underlying descriptors. Safe to call more than once. */
+	bool Initialize();
+
+	/** Releases the underlying descriptors. Must not race an in-flight wait. */
+	void Reset();
+
+	/** Wakes any thread currently waiting on this object. */
+	void Signal();
+
+	/** Consumes pending signals so the next wait blocks again. */
+	void Drain();
+
+	bool IsSignaled() const { return bSignaled; }
+
+	/** True when the wakeup can be polled together with socket descriptors. */
+	bool IsPollable() const { return ReadHandle >= 0; }
+
+	int32 GetReadHandle() const { return ReadHandle; }
+
+private:
+	int32 ReadHandle;
+	int32 WriteHandle;
+	TAtomic<bool> bSignaled;
+};
+
+/**
+ * Blocks until NativeHandle has data (or a hangup/error that recv() will
+ * surface), Wakeup is signalled, or TimeoutMs elapses. A negative timeout
+ * waits indefinitely.
+ */
+EMcpSocketWaitResult McpWaitForReadable(UPTRINT NativeHandle, FMcpSocketWakeup* Wakeup, int32 TimeoutMs);
+
+/** Outcome of a non-blocking native socket operation. */
+enum class EMcpSocketIoResult : uint8
+{
+	Ok,
+	WouldBlock,
+	Closed,
+	Error
+};
+
+/**
+ * Readiness set over native socket descriptors, owned by a single reactor
+ * thread. Linux uses edge-triggered epoll; other platforms rebuild a poll()
+ * (WSAPoll on Windows) array per wait. Registered sockets must be
+ * non-blocking and drained until WouldBlock on every readable report.
+ */
+class FMcpSocketPollSet
+{
+public:
+	FMcpSocketPollSet();
+	~FMcpSocketPollSet();
+
+	FMcpSocketPollSet(const FMcpSocketPollSet&) = delete;
+	FMcpSocketPollSet& operator=(const FMcpSocketPollSet&) = delete;
+
+	bool Initialize();
+
+	bool Add(UPTRINT Handle);
+	void Remove(UPTRINT Handle);
+
+	/**
+	 * Also reports Handle once it can accept more bytes. Enable it only while
+	 * the handle has unsent data queued, then drain until WouldBlock.
+	 */
+	void SetWriteInterest(UPTRINT Handle, bool bEnable);
+
+	/**
+	 * Waits for readability (or writability, see SetWriteInterest) on any
+	 * registered handle. Returns the number of ready handles written to
+	 * OutReady, 0 on timeout or wakeup, -1 on error. Without a pollable
+	 * wakeup the wait is capped to a short slice.
+	 */
+	int32 Wait(int32 TimeoutMs, TArray<UPTRINT>& OutReady);
+
+	/** Interrupts a concurrent Wait(). Callable from any thread. */
+	void Wake();
+
+private:
+	FMcpSocketWakeup Wakeup;
+	TArray<UPTRINT> Handles;
+	TArray<UPTRINT> WriteHandles;
+#if PLATFORM_LINUX
+	int32 EpollHandle;
+#endif
+};
+
+/** Switches a native descriptor to non-blocking mode and disables Nagle. */
+bool McpNativeConfigureStreamSocket(UPTRINT Handle);
+
+EMcpSocketIoResult McpNativeAccept(UPTRINT ListenHandle, UPTRINT& OutClientHandle);
+EMcpSocketIoResult McpNativeRecv(UPTRINT Handle, uint8* Data, int32 Length, int32& OutBytesRead);
+EMcpSocketIoResult McpNativeSend(UPTRINT Handle, const uint8* Data, int32 Length, int32& OutBytesSent);
+
+/** Blocks until a non-blocking descriptor can accept more bytes. */
+bool McpWaitForWritable(UPTRINT Handle, int32 TimeoutMs);
+
+/** Shuts down both directions so a thread blocked in send or recv on Handle returns. */
+void McpNativeShutdown(UPTRINT Handle);
+
+void McpNativeClose(UPTRINT Handle);
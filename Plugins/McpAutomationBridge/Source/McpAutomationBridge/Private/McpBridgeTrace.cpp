@@ -0,0 +1,71 @@
+#include "McpBridgeTrace.h"
+
+#include "HAL/PlatformTime.h"
+
+#if MCP_BRIDGE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(McpBridgeChannel)
+
+UE_TRACE_EVENT_BEGIN(McpBridge, RequestReceived)
+  UE_TRACE_EVENT_FIELD(uint64, Cycle)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Action)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(McpBridge, RequestQueued)
+  UE_TRACE_EVENT_FIELD(uint64, Cycle)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Action)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(McpBridge, RequestDispatched)
+  UE_TRACE_EVENT_FIELD(uint64, Cycle)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Action)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(McpBridge, ResponseSent)
+  UE_TRACE_EVENT_FIELD(uint64, Cycle)
+  UE_TRACE_EVENT_FIELD(bool, Success)
+  UE_TRACE_EVENT_FIELD(bool, Delivered)
+  UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+UE_TRACE_EVENT_END()
+
+void McpTraceRequestReceived(const FString &RequestId, const FString &Action) {
+  UE_TRACE_LOG(McpBridge, RequestReceived, McpBridgeChannel)
+      << RequestReceived.Cycle(FPlatformTime::Cycles64())
+      << RequestReceived.RequestId(*RequestId, RequestId.Len())
+      << RequestReceived.Action(*Action, Action.Len());
+}
+
+void McpTraceRequestQueued(const FString &RequestId, const FString &Action) {
+  UE_TRACE_LOG(McpBridge, RequestQueued, McpBridgeChannel)
+      << RequestQueued.Cycle(FPlatformTime::Cycles64())
+      << RequestQueued.RequestId(*RequestId, RequestId.Len())
+      << RequestQueued.Action(*Action, Action.Len());
+}
+
+void McpTraceRequestDispatched(const FString &RequestId,
+                               const FString &Action) {
+  UE_TRACE_LOG(McpBridge, RequestDispatched, McpBridgeChannel)
+      << RequestDispatched.Cycle(FPlatformTime::Cycles64())
+      << RequestDispatched.RequestId(*RequestId, RequestId.Len())
+      << RequestDispatched.Action(*Action, Action.Len());
+}
+
+void McpTraceResponseSent(const FString &RequestId, bool bSuccess,
+                          bool bDelivered) {
+  UE_TRACE_LOG(McpBridge, ResponseSent, McpBridgeChannel)
+      << ResponseSent.Cycle(FPlatformTime::Cycles64())
+      << ResponseSent.Success(bSuccess) << ResponseSent.Delivered(bDelivered)
+      << ResponseSent.RequestId(*RequestId, RequestId.Len());
+}
+
+#else
+
+void McpTraceRequestReceived(const FString &, const FString &) {}
+void McpTraceRequestQueued(const FString &, const FString &) {}
+void McpTraceRequestDispatched(const FString &, const FString &) {}
+void McpTraceResponseSent(const FString &, bool, bool) {}
+
+#endif // MCP_BRIDGE_TRACE_ENABLED
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * "McpBridge" Unreal Insights trace channel, off unless enabled with
+ * -trace=default,McpBridge, the Trace.Enable console command or
+ * manage_insights start_session.
+ *
+ * CPU scopes show bridge work on the thread that does it, next to the
+ * engine's own tracks:
+ *   McpBridge.Receive, McpBridge.Parse       socket I/O thread
+ *   McpBridge.DrainQueue                     game thread
+ *   McpBridge.Dispatch > <action> > <handler> game thread or worker lane
+ *   McpBridge.Serialize, McpBridge.Send      wherever the response is sent
+ * The request events below carry the request id, so a slow request reported
+ * by an agent can be found in a .utrace capture.
+ */
+#define MCP_BRIDGE_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if MCP_BRIDGE_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(McpBridgeChannel)
+
+/** Scope named by a string literal. */
+#define MCP_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, McpBridgeChannel)
+/** Scope named at runtime (an action or handler name). */
+#define MCP_TRACE_SCOPE_TEXT(Text) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Text, McpBridgeChannel)
+#else
+#define MCP_TRACE_SCOPE(Name)
+#define MCP_TRACE_SCOPE_TEXT(Text)
+#endif
+
+/** Name of the channel, for Trace.Enable and UE::Trace::ToggleChannel. */
+#define MCP_BRIDGE_TRACE_CHANNEL_NAME TEXT("McpBridge")
+
+/** An automation_request was parsed off a socket. */
+void McpTraceRequestReceived(const FString& RequestId, const FString& Action);
+/** The request was put in the game-thread queue (off-thread arrival, engine busy, or another request running). */
+void McpTraceRequestQueued(const FString& RequestId, const FString& Action);
+/** The request left the queue and its handler is about to run. */
+void McpTraceRequestDispatched(const FString& RequestId, const FString& Action);
+/** The automation_response was handed to a socket, or could not be (bDelivered false). */
+void McpTraceResponseSent(const FString& RequestId, bool bSuccess, bool bDelivered);
@@ -2,6 +2,11 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeSettings.h"
+#include "McpBridgeDeflate.h"
+#include "McpBridgeMessagePack.h"
+#include "McpBridgeOpenMetrics.h"
+#include "McpBridgeTrace.h"
+#include "McpBridgeWebSocketMask.h"
 
 #include "Async/Async.h"
 #include "Containers/StringConv.h"
@@ -18,6 +23,9 @@
 #include "Misc/StringBuilder.h"
 #include "Misc/Timespan.h"
 #include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Serialization/JsonSerializer.h"
 #include "SocketSubsystem.h"
 #include "Sockets.h"
 #include "String/LexFromString.h"
@@ -53,6 +61,11 @@
 
 #endif // WITH_SSL
 
+// Handing accepted sockets to the shared reactor needs
+// FSocket::ReleaseNativeSocket, which first shipped in UE 5.7.
+#define MCP_BRIDGE_WITH_SOCKET_REACTOR                                        \
+  (ENGINE_MAJOR_VERSION > 5 ||                                                \
+   (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7))
 
 namespace {
 constexpr const TCHAR *WebSocketGuid =
@@ -68,6 +81,36 @@ constexpr uint64 MaxWebSocketMessageBytes = 5ULL * 1024ULL * 1024ULL;
 constexpr uint64 MaxWebSocketFramePayloadBytes = MaxWebSocketMessageBytes;
 constexpr int32 WebSocketCloseCodeMessageTooBig = 1009;
 
+// Upper bound for a single readiness wait when no pollable wakeup is
+// available (plain FSocket path, Windows). Data arrival still returns
+// immediately; this only bounds how long a stop request can go unnoticed.
+constexpr int32 ReadinessWaitSliceMs = 250;
+
+// Minimum contiguous space offered to each socket read into the receive
+// buffer; one read usually picks up several small frames at once.
+constexpr int32 ReceiveChunkBytes = 64 * 1024;
+
+// Stack buffer used while a reactor client is still sending its upgrade
+// request.
+constexpr int32 HandshakeChunkBytes = 4096;
+
+// Upgrade requests larger than this are rejected by the reactor instead of
+// being buffered indefinitely.
+constexpr int32 MaxHandshakeRequestBytes = 16 * 1024;
+
+// How long a connection's I/O thread, tearing it down, lets the sender write
+// frames that are already queued (typically a final error or close frame).
+constexpr double SendQueueCloseFlushSeconds = 0.25;
+
+// Matches the blocking path's wait for OnMessage to be bound before frames
+// are dispatched for a freshly upgraded connection.
+constexpr double HandlerRegistrationWaitSeconds = 0.5;
+
+// Process-wide traffic counters reported on the metrics endpoint.
+TAtomic<int64> GMcpTotalBytesReceived{0};
+TAtomic<int64> GMcpTotalBytesSent{0};
+TAtomic<int32> GMcpOpenConnections{0};
+
 struct FParsedWebSocketUrl {
   FString Host;
   int32 Port = 80;
@@ -200,7 +243,29 @@ uint64 ToNetwork64(uint64 Value) {
 
 uint64 FromNetwork64(uint64 Value) { return ToNetwork64(Value); }
 
-FString BytesToStringView(const TArray<uint8> &Data) {
+// Writes the base header and extended payload length of a frame (the mask
+// key, if any, follows separately). Out needs room for 10 bytes.
+int32 EncodeFrameHeader(uint8 *Out, uint8 FirstByte, uint64 Length,
+                        bool bMask) {
+  const uint8 MaskBit = bMask ? 0x80 : 0x00;
+  Out[0] = FirstByte;
+  if (Length <= 125) {
+    Out[1] = MaskBit | static_cast<uint8>(Length);
+    return 2;
+  }
+  if (Length <= 0xFFFF) {
+    Out[1] = MaskBit | 126;
+    const uint16 SizeShort = ToNetwork16(static_cast<uint16>(Length));
+    FMemory::Memcpy(Out + 2, &SizeShort, sizeof(uint16));
+    return 4;
+  }
+  Out[1] = MaskBit | 127;
+  const uint64 SizeLong = ToNetwork64(Length);
+  FMemory::Memcpy(Out + 2, &SizeLong, sizeof(uint64));
+  return 10;
+}
+
+FString BytesToStringView(TArrayView<const uint8> Data) {
   if (Data.Num() == 0) {
     return FString();
   }
@@ -237,8 +302,38 @@ FString DescribeSocketError(ISocketSubsystem *SocketSubsystem,
   return FString::Printf(TEXT("%s (error=%d, %s)"), Context,
                          static_cast<int32>(LastErrorCode), *Description);
 }
+
+FMcpDeflateConfig McpReadDeflateConfig() {
+  FMcpDeflateConfig Config;
+  if (const UMcpAutomationBridgeSettings *Settings =
+          GetDefault<UMcpAutomationBridgeSettings>()) {
+    Config.bEnabled = Settings->bEnablePerMessageDeflate;
+    Config.MaxWindowBits = Settings->DeflateMaxWindowBits;
+    Config.MinMessageBytes = Settings->DeflateMinMessageBytes;
+    Config.bNoContextTakeover = Settings->bDeflateNoContextTakeover;
+  }
+  return Config;
+}
 } // namespace
 
+// Drains the outbound queue of a connection that has no reactor, so the
+// thread that sends never waits on the peer.
+class FMcpSendQueueRunnable final : public FRunnable {
+public:
+  explicit FMcpSendQueueRunnable(FMcpBridgeWebSocket &InOwner)
+      : Owner(InOwner) {}
+
+  virtual uint32 Run() override { return Owner.RunSendQueue(); }
+
+  virtual void Stop() override {
+    Owner.bSendWorkerStopping = true;
+    Owner.SendQueueEvent->Trigger();
+  }
+
+private:
+  FMcpBridgeWebSocket &Owner;
+};
+
 FMcpBridgeWebSocket::FMcpBridgeWebSocket(
     const FString &InUrl, const FString &InProtocols,
     const TMap<FString, FString> &InHeaders, bool bInEnableTls,
@@ -256,6 +351,7 @@ FMcpBridgeWebSocket::FMcpBridgeWebSocket(
       TlsPrivateKeyPath(InTlsPrivateKeyPath) {
   HandlerReadyEvent = nullptr;
   bHandlerRegistered = false;
+  ReadSendQueueLimits();
 }
 
 FMcpBridgeWebSocket::FMcpBridgeWebSocket(int32 InPort, const FString &InHost,
@@ -278,6 +374,7 @@ FMcpBridgeWebSocket::FMcpBridgeWebSocket(int32 InPort, const FString &InHost,
       TlsPrivateKeyPath(InTlsPrivateKeyPath) {
   HandlerReadyEvent = nullptr;
   bHandlerRegistered = false;
+  ReadSendQueueLimits();
 }
 
 FMcpBridgeWebSocket::FMcpBridgeWebSocket(FSocket *InClientSocket,
@@ -298,24 +395,35 @@ FMcpBridgeWebSocket::FMcpBridgeWebSocket(FSocket *InClientSocket,
       TlsPrivateKeyPath(InTlsPrivateKeyPath) {
   HandlerReadyEvent = nullptr;
   bHandlerRegistered = false;
+  ReadSendQueueLimits();
 }
 
 FMcpBridgeWebSocket::~FMcpBridgeWebSocket() {
   Close();
+  if (Thread) {
+    // Wait for thread completion. Close() above unblocked a listener's
+    // Accept(); a connection's thread notices the stop request within one
+    // readiness wait and tears the connection down itself. It still uses
+    // the TLS session and HandlerReadyEvent until then.
+    Thread->Kill(true); // true = wait for completion
+    delete Thread;
+    Thread = nullptr;
+  }
   ShutdownTls();
   if (HandlerReadyEvent) {
     FPlatformProcess::ReturnSynchEventToPool(HandlerReadyEvent);
     HandlerReadyEvent = nullptr;
   }
-  
-  if (Thread) {
-    // Wait for thread completion. The Close() call above should have unblocked
-    // any waiting socket operations by destroying ListenSocket/Socket.
-    // Use Kill() first to request the thread to stop, then wait for completion.
-    Thread->Kill(true); // true = wait for completion
-    delete Thread;
-    Thread = nullptr;
+  StopSendWorker();
+  if (SendQueueEvent) {
+    FPlatformProcess::ReturnSynchEventToPool(SendQueueEvent);
+    SendQueueEvent = nullptr;
+  }
+  if (SendWorkerExitedEvent) {
+    FPlatformProcess::ReturnSynchEventToPool(SendWorkerExitedEvent);
+    SendWorkerExitedEvent = nullptr;
   }
+  ReadWakeup.Reset();
   
   if (StopEvent) {
     FPlatformProcess::ReturnSynchEventToPool(StopEvent);
@@ -503,11 +611,7 @@ void FMcpBridgeWebSocket::CloseNativeSocket() {
   if (NativeSocketHandle == 0) {
     return;
   }
-#if PLATFORM_WINDOWS
-  closesocket(static_cast<SOCKET>(NativeSocketHandle));
-#else
-  close(static_cast<int>(NativeSocketHandle));
-#endif
+  McpNativeClose(NativeSocketHandle);
   NativeSocketHandle = 0;
 }
 
@@ -518,6 +622,7 @@ bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
     const int Result = SSL_write(SslHandle, Data, Length);
     if (Result > 0) {
       OutBytesSent = Result;
+      GMcpTotalBytesSent += Result;
       return true;
     }
     const int ErrorCode = SSL_get_error(SslHandle, Result);
@@ -527,11 +632,22 @@ bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
     return false;
   }
 
-  if (!Socket) {
+  if (bReactorManaged) {
+    const bool bSent = McpNativeSend(NativeSocketHandle, Data, Length,
+                                     OutBytesSent) != EMcpSocketIoResult::Error;
+    GMcpTotalBytesSent += OutBytesSent;
+    return bSent;
+  }
+
+  // Read once: Close() may detach the socket while the sender is here.
+  FSocket *LocalSocket = Socket;
+  if (!LocalSocket) {
     return false;
   }
 
-  return Socket->Send(Data, Length, OutBytesSent);
+  const bool bSent = LocalSocket->Send(Data, Length, OutBytesSent);
+  GMcpTotalBytesSent += OutBytesSent;
+  return bSent;
 }
 
 bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
@@ -539,22 +655,35 @@ bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
   OutBytesRead = 0;
   if (bUseTls && SslHandle) {
     const int Result = SSL_read(SslHandle, Data, Length);
+    bTlsReadWantsWrite = false;
     if (Result > 0) {
       OutBytesRead = Result;
+      GMcpTotalBytesReceived += Result;
       return true;
     }
     const int ErrorCode = SSL_get_error(SslHandle, Result);
     if (ErrorCode == SSL_ERROR_WANT_READ || ErrorCode == SSL_ERROR_WANT_WRITE) {
+      bTlsReadWantsWrite = ErrorCode == SSL_ERROR_WANT_WRITE;
       return true;
     }
     return false;
   }
 
+  if (bReactorManaged) {
+    const EMcpSocketIoResult Result =
+        McpNativeRecv(NativeSocketHandle, Data, Length, OutBytesRead);
+    GMcpTotalBytesReceived += OutBytesRead;
+    return Result == EMcpSocketIoResult::Ok ||
+           Result == EMcpSocketIoResult::WouldBlock;
+  }
+
   if (!Socket) {
     return false;
   }
 
-  return Socket->Recv(Data, Length, OutBytesRead);
+  const bool bRead = Socket->Recv(Data, Length, OutBytesRead);
+  GMcpTotalBytesReceived += OutBytesRead;
+  return bRead;
 }
 
 #else // !WITH_SSL
@@ -581,37 +710,50 @@ void FMcpBridgeWebSocket::ShutdownTls() {
 }
 
 void FMcpBridgeWebSocket::CloseNativeSocket() {
-  // Native socket handle is only used when TLS/SSL is enabled.
-  // When WITH_SSL is disabled, this is a no-op.
-#if WITH_SSL
+  // Without TLS the native handle is only used by reactor-managed
+  // connections.
   if (NativeSocketHandle == 0) {
     return;
   }
-#if PLATFORM_WINDOWS
-  closesocket(static_cast<SOCKET>(NativeSocketHandle));
-#else
-  close(static_cast<int>(NativeSocketHandle));
-#endif
+  McpNativeClose(NativeSocketHandle);
   NativeSocketHandle = 0;
-#endif // WITH_SSL
 }
 
 bool FMcpBridgeWebSocket::SendRaw(const uint8 *Data, int32 Length,
                                  int32 &OutBytesSent) {
   OutBytesSent = 0;
-  if (!Socket) {
+  if (bReactorManaged) {
+    const bool bSent = McpNativeSend(NativeSocketHandle, Data, Length,
+                                     OutBytesSent) != EMcpSocketIoResult::Error;
+    GMcpTotalBytesSent += OutBytesSent;
+    return bSent;
+  }
+  // Read once: Close() may detach the socket while the sender is here.
+  FSocket *LocalSocket = Socket;
+  if (!LocalSocket) {
     return false;
   }
-  return Socket->Send(Data, Length, OutBytesSent);
+  const bool bSent = LocalSocket->Send(Data, Length, OutBytesSent);
+  GMcpTotalBytesSent += OutBytesSent;
+  return bSent;
 }
 
 bool FMcpBridgeWebSocket::RecvRaw(uint8 *Data, int32 Length,
                                  int32 &OutBytesRead) {
   OutBytesRead = 0;
+  if (bReactorManaged) {
+    const EMcpSocketIoResult Result =
+        McpNativeRecv(NativeSocketHandle, Data, Length, OutBytesRead);
+    GMcpTotalBytesReceived += OutBytesRead;
+    return Result == EMcpSocketIoResult::Ok ||
+           Result == EMcpSocketIoResult::WouldBlock;
+  }
   if (!Socket) {
     return false;
   }
-  return Socket->Recv(Data, Length, OutBytesRead);
+  const bool bRead = Socket->Recv(Data, Length, OutBytesRead);
+  GMcpTotalBytesReceived += OutBytesRead;
+  return bRead;
 }
 
 #endif // WITH_SSL
@@ -621,6 +763,16 @@ void FMcpBridgeWebSocket::NotifyMessageHandlerRegistered() {
   if (HandlerReadyEvent) {
     HandlerReadyEvent->Trigger();
   }
+  if (bReactorManaged) {
+    // Frames held back while waiting for the handler can flow now.
+    WakeReactor();
+  }
+}
+
+void FMcpBridgeWebSocket::SetIoThreadMessageFilter(
+    FMcpBridgeWebSocketMessageFilter InFilter) {
+  FScopeLock Guard(&MessageFilterMutex);
+  IoThreadMessageFilter = MoveTemp(InFilter);
 }
 
 void FMcpBridgeWebSocket::InitializeWeakSelf(
@@ -635,6 +787,13 @@ void FMcpBridgeWebSocket::Connect() {
 
   bStopping = false;
   StopEvent = FPlatformProcess::GetSynchEventFromPool(true);
+  if (!ReadWakeup.Initialize()) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Pollable socket wakeup unavailable; stop requests are "
+                "observed within %d ms."),
+           ReadinessWaitSliceMs);
+  }
+  StartSendWorker();
   Thread = FRunnableThread::Create(this, TEXT("FMcpBridgeWebSocketWorker"), 0,
                                    TPri_Normal);
   if (!Thread) {
@@ -654,6 +813,11 @@ void FMcpBridgeWebSocket::Listen() {
 
   bStopping = false;
   StopEvent = FPlatformProcess::GetSynchEventFromPool(true);
+  if (ShouldUseReactor()) {
+    // Created before the thread starts so WakeReactor() from other threads
+    // never observes a half-built poll set.
+    ReactorPollSet = MakeUnique<FMcpSocketPollSet>();
+  }
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("Spawning MCP automation server thread for %s:%d"), *ListenHost,
          Port);
@@ -676,6 +840,23 @@ void FMcpBridgeWebSocket::Close(int32 StatusCode, const FString &Reason) {
   if (StopEvent) {
     StopEvent->Trigger();
   }
+  ReadWakeup.Signal();
+  WakeReactor();
+
+  if (bReactorManaged) {
+    // The owning reactor reads from and closes this descriptor; it tears
+    // the connection down on its own thread once woken.
+    return;
+  }
+  if (!bServerMode && Thread && bConnected) {
+    // Likewise for an open connection with its own I/O thread: it leaves its
+    // read loop within one readiness wait and runs TearDown, which hands a
+    // final message sent just before closing (e.g. a bridge_error) to the
+    // sender to flush. The caller, usually the game thread, does not wait
+    // for any of it. A connection still handshaking is shut down below,
+    // which also aborts a blocking connect.
+    return;
+  }
 
   // Close the listen socket to unblock Accept() in RunServer().
   // IMPORTANT: We only close here, NOT destroy. RunServer() owns the socket and
@@ -699,12 +880,22 @@ void FMcpBridgeWebSocket::Close(int32 StatusCode, const FString &Reason) {
     }
   }
 
-  // Close the main socket (for client connections)
+  // Close the main socket (for client connections). Shutting it down first
+  // wakes a reader blocked in FSocket::Wait on platforms without a pollable
+  // wakeup.
   if (FSocket *LocalSocket = DetachSocket()) {
+    LocalSocket->Shutdown(ESocketShutdownMode::ReadWrite);
+    // The sender may still be inside Send() on this socket; the shutdown
+    // above makes that call return.
+    StopSendWorker();
     LocalSocket->Close();
     ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
   }
 
+  if (bUseTls) {
+    McpNativeShutdown(NativeSocketHandle);
+  }
+  StopSendWorker();
   ShutdownTls();
   CloseNativeSocket();
 }
@@ -715,28 +906,44 @@ bool FMcpBridgeWebSocket::Send(const FString &Data) {
 }
 
 bool FMcpBridgeWebSocket::Send(const void *Data, SIZE_T Length) {
-  if (!IsConnected()) {
+  if (!IsConnected() || !HasTransport()) {
     return false;
   }
-  if (bUseTls) {
-    if (!SslHandle) {
-      return false;
-    }
-  } else if (!Socket) {
+
+  return SendDataFrame(OpCodeText, Data, Length);
+}
+
+bool FMcpBridgeWebSocket::SendBinary(const void *Data, SIZE_T Length) {
+  if (!IsConnected() || !HasTransport()) {
     return false;
   }
 
-  return SendTextFrame(Data, Length);
+  return SendDataFrame(OpCodeBinary, Data, Length);
 }
 
 bool FMcpBridgeWebSocket::IsConnected() const { return bConnected; }
 
 bool FMcpBridgeWebSocket::IsListening() const { return bListening; }
 
+bool FMcpBridgeWebSocket::IsSendQueueAboveHighWater() const {
+  return SendQueueHighWaterBytes > 0 &&
+         QueuedSendBytes > SendQueueHighWaterBytes;
+}
+
 void FMcpBridgeWebSocket::SendHeartbeatPing() {
   SendControlFrame(OpCodePing, TArray<uint8>());
 }
 
+int64 FMcpBridgeWebSocket::GetTotalBytesReceived() {
+  return GMcpTotalBytesReceived;
+}
+
+int64 FMcpBridgeWebSocket::GetTotalBytesSent() { return GMcpTotalBytesSent; }
+
+int32 FMcpBridgeWebSocket::GetOpenConnectionCount() {
+  return GMcpOpenConnections;
+}
+
 bool FMcpBridgeWebSocket::Init() { return true; }
 
 uint32 FMcpBridgeWebSocket::Run() {
@@ -758,16 +965,7 @@ uint32 FMcpBridgeWebSocket::RunClient() {
     }
   }
 
-  bConnected = true;
-  UE_LOG(
-      LogMcpAutomationBridgeSubsystem, Log,
-      TEXT("FMcpBridgeWebSocket connection established (serverAccepted=%s)."),
-      bServerAcceptedConnection ? TEXT("true") : TEXT("false"));
-  DispatchOnGameThread([WeakThis = SelfWeakPtr] {
-    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
-      Pinned->ConnectedDelegate.Broadcast(Pinned);
-    }
-  });
+  BroadcastConnectionEstablished();
 
   // If this connection was accepted by the server thread (i.e. a remote
   // client connected to the plugin), wait a short time for the game
@@ -1011,6 +1209,12 @@ uint32 FMcpBridgeWebSocket::RunServer() {
     }
   });
 
+#if MCP_BRIDGE_WITH_SOCKET_REACTOR
+  if (ReactorPollSet) {
+    return RunReactor();
+  }
+#endif
+
   while (!bStopping && ListenSocket) {
     // Note: Accept() blocks until a connection arrives or the socket is closed.
     // Close() calls ListenSocket->Close() to unblock this call during shutdown.
@@ -1039,55 +1243,7 @@ uint32 FMcpBridgeWebSocket::RunServer() {
       auto ClientWebSocket = MakeShared<FMcpBridgeWebSocket>(
           ClientSocket, bUseTls, TlsCertificatePath, TlsPrivateKeyPath);
       ClientWebSocket->InitializeWeakSelf(ClientWebSocket);
-      ClientWebSocket->bServerMode =
-          false; // Client connections are not in server mode
-      ClientWebSocket->bServerAcceptedConnection =
-          true; // This is a server-accepted connection
-      // Annotate the accepted client socket with the server listening port
-      // so diagnostic logs and handshake acknowledgements report a
-      // meaningful activePort instead of 0.
-      ClientWebSocket->Port = Port;
-
-      {
-        FScopeLock Lock(&ClientSocketsMutex);
-        ClientSockets.Add(ClientWebSocket);
-      }
-
-      TWeakPtr<FMcpBridgeWebSocket> LocalWeakThis = SelfWeakPtr;
-      auto RemoveFromClientList = [LocalWeakThis, ClientWebSocket] {
-        if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
-          FScopeLock Lock(&Pinned->ClientSocketsMutex);
-          UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
-                 TEXT("Removing client socket from server tracking (remaining "
-                      "before remove: %d)."),
-                 Pinned->ClientSockets.Num());
-          Pinned->ClientSockets.Remove(ClientWebSocket);
-        }
-      };
-
-      ClientWebSocket->OnConnected().AddLambda(
-          [LocalWeakThis, ClientWebSocket](TSharedPtr<FMcpBridgeWebSocket>) {
-            if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
-              DispatchOnGameThread(
-                  [ParentWeak = LocalWeakThis, ClientSocket = ClientWebSocket] {
-                    if (TSharedPtr<FMcpBridgeWebSocket> DispatchPinned =
-                            ParentWeak.Pin()) {
-                      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-                             TEXT("Broadcasting client connected delegate."));
-                      DispatchPinned->ClientConnectedDelegate.Broadcast(
-                          ClientSocket);
-                    }
-                  });
-            }
-          });
-
-      ClientWebSocket->OnClosed().AddLambda(
-          [RemoveFromClientList](TSharedPtr<FMcpBridgeWebSocket>, int32,
-                                 const FString &,
-                                 bool) { RemoveFromClientList(); });
-
-      ClientWebSocket->OnConnectionError().AddLambda(
-          [RemoveFromClientList](const FString &) { RemoveFromClientList(); });
+      TrackAcceptedClient(ClientWebSocket);
 
       // Start the client WebSocket thread to handle the handshake and
       // communication
@@ -1108,22 +1264,437 @@ uint32 FMcpBridgeWebSocket::RunServer() {
   return 0;
 }
 
+uint32 FMcpBridgeWebSocket::RunReactor() {
+#if MCP_BRIDGE_WITH_SOCKET_REACTOR
+  ISocketSubsystem *SocketSubsystem =
+      ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+  // Take the listen descriptor out of FSocket so it can share one poll set
+  // with every accepted client. Close() wakes the poll set instead of
+  // closing ListenSocket once this swap has happened.
+  FSocket *LocalListenSocket = static_cast<FSocket *>(
+      FPlatformAtomics::InterlockedExchangePtr(
+          reinterpret_cast<void **>(&ListenSocket), nullptr));
+  if (!LocalListenSocket) {
+    return 0;
+  }
+  const UPTRINT ListenHandle = LocalListenSocket->ReleaseNativeSocket();
+  SocketSubsystem->DestroySocket(LocalListenSocket);
+
+  if (ListenHandle == 0 || !ReactorPollSet->Initialize() ||
+      !McpNativeConfigureStreamSocket(ListenHandle) ||
+      !ReactorPollSet->Add(ListenHandle)) {
+    const FString ErrorMessage =
+        TEXT("Failed to initialize socket reactor for listen socket.");
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Error, TEXT("%s"), *ErrorMessage);
+    McpNativeClose(ListenHandle);
+    bListening = false;
+    DispatchOnGameThread([WeakThis = SelfWeakPtr, ErrorMessage] {
+      if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+        Pinned->ConnectionErrorDelegate.Broadcast(ErrorMessage);
+      }
+    });
+    return 0;
+  }
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+         TEXT("Serving clients on port %d from a shared reactor thread."),
+         Port);
+
+  TMap<UPTRINT, TSharedPtr<FMcpBridgeWebSocket>> Connections;
+  TArray<UPTRINT> Ready;
+  while (!bStopping) {
+    // Sleep until a socket is readable, a client asks to close, or the next
+    // handler-registration grace period expires.
+    int32 TimeoutMs = -1;
+    const double Now = FPlatformTime::Seconds();
+    for (const TPair<UPTRINT, TSharedPtr<FMcpBridgeWebSocket>> &Pair :
+         Connections) {
+      const double Deadline = Pair.Value->GetReactorWakeDeadline();
+      if (Deadline > 0.0) {
+        const int32 UntilDeadlineMs = FMath::Max(
+            0, FMath::CeilToInt((Deadline - Now) * 1000.0));
+        TimeoutMs = TimeoutMs < 0 ? UntilDeadlineMs
+                                  : FMath::Min(TimeoutMs, UntilDeadlineMs);
+      }
+    }
+
+    if (ReactorPollSet->Wait(TimeoutMs, Ready) < 0) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
+             TEXT("Socket reactor wait failed on port %d; stopping listener."),
+             Port);
+      break;
+    }
+    if (bStopping) {
+      break;
+    }
+
+    for (const UPTRINT Handle : Ready) {
+      if (Handle == ListenHandle) {
+        AcceptReactorClients(ListenHandle, Connections);
+      } else if (TSharedPtr<FMcpBridgeWebSocket> *Client =
+                     Connections.Find(Handle)) {
+        (*Client)->ServiceReactorReadable();
+      }
+    }
+
+    // Release held-back frames, honour Close() requests and retire
+    // connections that were torn down while servicing them.
+    // Queued outbound frames are written here too; a client with bytes left
+    // over is watched for writability until its queue drains.
+    for (auto It = Connections.CreateIterator(); It; ++It) {
+      const TSharedPtr<FMcpBridgeWebSocket> &Client = It.Value();
+      Client->PumpReactorFrames(false);
+      const bool bSendPending = Client->FlushReactorSendQueue();
+      if (Client->bCloseAfterSendQueueDrains && !bSendPending &&
+          !Client->bReactorFinished) {
+        Client->TearDown(TEXT("Metrics request served."), true, 1000);
+      }
+      if (Client->bStopping && !Client->bReactorFinished) {
+        Client->TearDown(TEXT("Socket loop finished."), true, 1000);
+      }
+      if (Client->bReactorFinished) {
+        ReactorPollSet->Remove(It.Key());
+        Client->ReleaseReactorConnection();
+        It.RemoveCurrent();
+      } else if (bSendPending != Client->bReactorWriteInterest) {
+        ReactorPollSet->SetWriteInterest(It.Key(), bSendPending);
+        Client->bReactorWriteInterest = bSendPending;
+      }
+    }
+  }
+
+  for (TPair<UPTRINT, TSharedPtr<FMcpBridgeWebSocket>> &Pair : Connections) {
+    if (!Pair.Value->bReactorFinished) {
+      Pair.Value->TearDown(TEXT("Socket loop finished."), true, 1000);
+    }
+    ReactorPollSet->Remove(Pair.Key);
+    Pair.Value->ReleaseReactorConnection();
+  }
+  Connections.Reset();
+
+  ReactorPollSet->Remove(ListenHandle);
+  McpNativeClose(ListenHandle);
+  bListening = false;
+#endif // MCP_BRIDGE_WITH_SOCKET_REACTOR
+  return 0;
+}
+
+void FMcpBridgeWebSocket::AcceptReactorClients(
+    UPTRINT ListenHandle,
+    TMap<UPTRINT, TSharedPtr<FMcpBridgeWebSocket>> &Connections) {
+  // Edge-triggered readiness: keep accepting until the backlog is empty.
+  for (;;) {
+    UPTRINT ClientHandle = 0;
+    const EMcpSocketIoResult Result =
+        McpNativeAccept(ListenHandle, ClientHandle);
+    if (Result == EMcpSocketIoResult::WouldBlock) {
+      return;
+    }
+    if (Result != EMcpSocketIoResult::Ok) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("Reactor accept failed on port %d."), Port);
+      return;
+    }
+    if (bStopping || !McpNativeConfigureStreamSocket(ClientHandle)) {
+      McpNativeClose(ClientHandle);
+      continue;
+    }
+
+    auto ClientWebSocket = MakeShared<FMcpBridgeWebSocket>(
+        static_cast<FSocket *>(nullptr), false, TlsCertificatePath,
+        TlsPrivateKeyPath);
+    ClientWebSocket->InitializeWeakSelf(ClientWebSocket);
+    ClientWebSocket->bReactorManaged = true;
+    ClientWebSocket->NativeSocketHandle = ClientHandle;
+    ClientWebSocket->bNativeSocketReleased = true;
+    ClientWebSocket->ReactorOwner = SelfWeakPtr;
+    TrackAcceptedClient(ClientWebSocket);
+
+    if (!ReactorPollSet->Add(ClientHandle)) {
+      ClientWebSocket->TearDown(TEXT("Failed to register client socket."),
+                                false, 4000);
+      ClientWebSocket->ReleaseReactorConnection();
+      continue;
+    }
+    Connections.Add(ClientHandle, ClientWebSocket);
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Accepted automation client on port %d (reactor, %d active)."),
+           Port, Connections.Num());
+
+    // Data that arrived with the connection will not raise a new edge.
+    ClientWebSocket->ServiceReactorReadable();
+  }
+}
+
+void FMcpBridgeWebSocket::ServiceReactorReadable() {
+  if (bReactorFinished || NativeSocketHandle == 0) {
+    return;
+  }
+
+  bool bPeerClosed = false;
+  for (;;) {
+    int32 BytesRead = 0;
+    EMcpSocketIoResult Result;
+    if (bReactorHandshakeComplete) {
+      // Read straight into the frame buffer; the recv is non-blocking.
+      FScopeLock Guard(&ReceiveMutex);
+      int32 Capacity = 0;
+      uint8 *Target = PendingReceived.PrepareWrite(ReceiveChunkBytes, Capacity);
+      Result = McpNativeRecv(NativeSocketHandle, Target, Capacity, BytesRead);
+      if (Result == EMcpSocketIoResult::Ok) {
+        PendingReceived.CommitWrite(BytesRead);
+        GMcpTotalBytesReceived += BytesRead;
+      }
+    } else {
+      uint8 Chunk[HandshakeChunkBytes];
+      Result = McpNativeRecv(NativeSocketHandle, Chunk, HandshakeChunkBytes,
+                             BytesRead);
+      if (Result == EMcpSocketIoResult::Ok) {
+        HandshakeBuffer.Append(Chunk, BytesRead);
+        GMcpTotalBytesReceived += BytesRead;
+      }
+    }
+    if (Result == EMcpSocketIoResult::Ok) {
+      continue;
+    }
+    bPeerClosed = Result != EMcpSocketIoResult::WouldBlock;
+    break;
+  }
+
+  if (!bReactorHandshakeComplete) {
+    TryCompleteReactorHandshake();
+  }
+
+  // A peer that closes right after its last frame still gets that frame
+  // delivered, even if the handler grace period has not elapsed.
+  PumpReactorFrames(bPeerClosed);
+
+  if (bPeerClosed && !bReactorFinished) {
+    if (bReactorHandshakeComplete) {
+      TearDown(TEXT("Failed to read WebSocket frame header."), false, 4001);
+    } else {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Server handshake recv failed while awaiting upgrade request "
+                  "(benign or client closed)."));
+      TearDown(TEXT("Failed to read WebSocket upgrade request."), false, 4000);
+    }
+  }
+}
+
+void FMcpBridgeWebSocket::TryCompleteReactorHandshake() {
+  int32 HeaderEndIndex = INDEX_NONE;
+  for (int32 Idx = 0; Idx + 3 < HandshakeBuffer.Num(); ++Idx) {
+    if (HandshakeBuffer[Idx] == '\r' && HandshakeBuffer[Idx + 1] == '\n' &&
+        HandshakeBuffer[Idx + 2] == '\r' && HandshakeBuffer[Idx + 3] == '\n') {
+      HeaderEndIndex = Idx + 4;
+      break;
+    }
+  }
+
+  if (HeaderEndIndex == INDEX_NONE) {
+    if (HandshakeBuffer.Num() > MaxHandshakeRequestBytes) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("Server handshake rejected: upgrade request exceeds %d "
+                  "bytes."),
+             MaxHandshakeRequestBytes);
+      TearDown(TEXT("Malformed WebSocket upgrade request."), false, 4000);
+    }
+    return;
+  }
+
+  bReactorHandshakeComplete = true;
+  const TArray<uint8> Request = MoveTemp(HandshakeBuffer);
+  HandshakeBuffer.Empty();
+  if (!CompleteServerHandshake(Request, HeaderEndIndex)) {
+    return;
+  }
+
+  BroadcastConnectionEstablished();
+  if (!bHandlerRegistered) {
+    ReactorHandlerDeadline =
+        FPlatformTime::Seconds() + HandlerRegistrationWaitSeconds;
+  }
+}
+
+void FMcpBridgeWebSocket::PumpReactorFrames(bool bForce) {
+  if (bReactorFinished || !bReactorHandshakeComplete || bStopping ||
+      bCloseAfterSendQueueDrains) {
+    return;
+  }
+
+  if (ReactorHandlerDeadline > 0.0) {
+    if (!bHandlerRegistered && !bForce &&
+        FPlatformTime::Seconds() < ReactorHandlerDeadline) {
+      return;
+    }
+    if (!bHandlerRegistered) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Message handler registration not observed in time; "
+                  "proceeding without explicit synchronization."));
+    }
+    ReactorHandlerDeadline = 0.0;
+  }
+
+  while (!bReactorFinished &&
+         TryConsumeBufferedFrame() == EBufferedFrameResult::Consumed) {
+  }
+}
+
+double FMcpBridgeWebSocket::GetReactorWakeDeadline() const {
+  return (ReactorHandlerDeadline > 0.0 && !bHandlerRegistered)
+             ? ReactorHandlerDeadline
+             : 0.0;
+}
+
+void FMcpBridgeWebSocket::ReleaseReactorConnection() {
+  // Senders check the handle under SendMutex, so closing it here cannot race
+  // a write on another thread.
+  FScopeLock Guard(&SendMutex);
+  CloseNativeSocket();
+  SendQueue.Empty();
+  SendQueueHead = 0;
+  SendQueueHeadOffset = 0;
+  QueuedSendBytes = 0;
+}
+
+void FMcpBridgeWebSocket::WakeReactor() {
+  if (ReactorPollSet) {
+    ReactorPollSet->Wake();
+    return;
+  }
+  if (TSharedPtr<FMcpBridgeWebSocket> Owner = ReactorOwner.Pin()) {
+    Owner->WakeReactor();
+  }
+}
+
+void FMcpBridgeWebSocket::TrackAcceptedClient(
+    const TSharedPtr<FMcpBridgeWebSocket> &ClientWebSocket) {
+  ClientWebSocket->bServerMode =
+      false; // Client connections are not in server mode
+  ClientWebSocket->bServerAcceptedConnection =
+      true; // This is a server-accepted connection
+  // Annotate the accepted client socket with the server listening port
+  // so diagnostic logs and handshake acknowledgements report a
+  // meaningful activePort instead of 0.
+  ClientWebSocket->Port = Port;
+  ClientWebSocket->MetricsProvider = MetricsProvider;
+
+  {
+    FScopeLock Lock(&ClientSocketsMutex);
+    ClientSockets.Add(ClientWebSocket);
+  }
+
+  TWeakPtr<FMcpBridgeWebSocket> LocalWeakThis = SelfWeakPtr;
+  auto RemoveFromClientList = [LocalWeakThis, ClientWebSocket] {
+    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
+      FScopeLock Lock(&Pinned->ClientSocketsMutex);
+      UE_LOG(LogMcpAutomationBridgeSubsystem, VeryVerbose,
+             TEXT("Removing client socket from server tracking (remaining "
+                  "before remove: %d)."),
+             Pinned->ClientSockets.Num());
+      Pinned->ClientSockets.Remove(ClientWebSocket);
+    }
+  };
+
+  ClientWebSocket->OnConnected().AddLambda(
+      [LocalWeakThis, ClientWebSocket](TSharedPtr<FMcpBridgeWebSocket>) {
+        if (TSharedPtr<FMcpBridgeWebSocket> Pinned = LocalWeakThis.Pin()) {
+          DispatchOnGameThread(
+              [ParentWeak = LocalWeakThis, ClientSocket = ClientWebSocket] {
+                if (TSharedPtr<FMcpBridgeWebSocket> DispatchPinned =
+                        ParentWeak.Pin()) {
+                  UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+                         TEXT("Broadcasting client connected delegate."));
+                  DispatchPinned->ClientConnectedDelegate.Broadcast(
+                      ClientSocket);
+                }
+              });
+        }
+      });
+
+  ClientWebSocket->OnClosed().AddLambda(
+      [RemoveFromClientList](TSharedPtr<FMcpBridgeWebSocket>, int32,
+                             const FString &,
+                             bool) { RemoveFromClientList(); });
+
+  ClientWebSocket->OnConnectionError().AddLambda(
+      [RemoveFromClientList](const FString &) { RemoveFromClientList(); });
+}
+
+bool FMcpBridgeWebSocket::ShouldUseReactor() const {
+#if MCP_BRIDGE_WITH_SOCKET_REACTOR
+  // TLS accept and record handling stay on dedicated blocking threads.
+  const UMcpAutomationBridgeSettings *Settings =
+      GetDefault<UMcpAutomationBridgeSettings>();
+  return bServerMode && !bUseTls && Settings && Settings->bUseSocketReactor;
+#else
+  return false;
+#endif
+}
+
 void FMcpBridgeWebSocket::Stop() {
   bStopping = true;
   if (StopEvent) {
     StopEvent->Trigger();
   }
+  ReadWakeup.Signal();
+  if (ReactorPollSet) {
+    ReactorPollSet->Wake();
+  }
+}
+
+void FMcpBridgeWebSocket::BroadcastConnectionEstablished() {
+  bConnected = true;
+  if (!bCountedAsOpen.Exchange(true)) {
+    ++GMcpOpenConnections;
+  }
+  UE_LOG(
+      LogMcpAutomationBridgeSubsystem, Log,
+      TEXT("FMcpBridgeWebSocket connection established (serverAccepted=%s)."),
+      bServerAcceptedConnection ? TEXT("true") : TEXT("false"));
+  DispatchOnGameThread([WeakThis = SelfWeakPtr] {
+    if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
+      Pinned->ConnectedDelegate.Broadcast(Pinned);
+    }
+  });
+}
+
+bool FMcpBridgeWebSocket::HasTransport() const {
+  if (bUseTls) {
+    return SslHandle != nullptr;
+  }
+  if (bReactorManaged) {
+    return NativeSocketHandle != 0;
+  }
+  return Socket != nullptr;
 }
 
 void FMcpBridgeWebSocket::TearDown(const FString &Reason, bool bWasClean,
                                    int32 StatusCode) {
+  if (!bReactorManaged) {
+    // Lets a close reply or final message that is already queued reach the
+    // peer before the socket is shut down under the sender.
+    FinishSendWorker(SendQueueCloseFlushSeconds);
+  }
   if (FSocket *LocalSocket = DetachSocket()) {
+    LocalSocket->Shutdown(ESocketShutdownMode::ReadWrite);
+    StopSendWorker();
     LocalSocket->Close();
     ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(LocalSocket);
+  } else if (!bReactorManaged) {
+    if (bUseTls) {
+      McpNativeShutdown(NativeSocketHandle);
+    }
+    StopSendWorker();
   }
 
   const bool bWasConnected = bConnected;
   bConnected = false;
+  if (bCountedAsOpen.Exchange(false)) {
+    --GMcpOpenConnections;
+  }
+  bReactorFinished = true;
   ResetFragmentState();
 
   DispatchOnGameThread([WeakThis = SelfWeakPtr, Reason, bWasClean, StatusCode,
@@ -1217,6 +1788,14 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
                    << TEXT("\r\n");
   }
 
+  const FMcpDeflateConfig DeflateConfig = McpReadDeflateConfig();
+  const FString DeflateOffer =
+      FMcpPerMessageDeflate::BuildClientOffer(DeflateConfig);
+  if (!DeflateOffer.IsEmpty()) {
+    RequestBuilder << TEXT("Sec-WebSocket-Extensions: ") << DeflateOffer
+                   << TEXT("\r\n");
+  }
+
   for (const TPair<FString, FString> &HeaderPair : Headers) {
     RequestBuilder << HeaderPair.Key << TEXT(": ") << HeaderPair.Value
                    << TEXT("\r\n");
@@ -1297,6 +1876,7 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
   }
 
   bool bAcceptValid = false;
+  FString AcceptedExtensions;
   for (int32 i = 1; i < HeaderLines.Num(); ++i) {
     FString Key;
     FString Value;
@@ -1305,6 +1885,11 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
       Value = Value.TrimStartAndEnd();
       if (Key.Equals(TEXT("Sec-WebSocket-Accept"), ESearchCase::IgnoreCase)) {
         bAcceptValid = Value.Equals(ExpectedAccept, ESearchCase::CaseSensitive);
+      } else if (Key.Equals(TEXT("Sec-WebSocket-Extensions"),
+                            ESearchCase::IgnoreCase)) {
+        AcceptedExtensions = AcceptedExtensions.IsEmpty()
+                                 ? Value
+                                 : AcceptedExtensions + TEXT(", ") + Value;
       }
     }
   }
@@ -1314,6 +1899,19 @@ bool FMcpBridgeWebSocket::PerformHandshake() {
     return false;
   }
 
+  if (!AcceptedExtensions.IsEmpty()) {
+    // A server may only accept what we offered (RFC 6455 section 9.1).
+    TUniquePtr<FMcpPerMessageDeflate> Negotiated =
+        MakeUnique<FMcpPerMessageDeflate>();
+    if (DeflateOffer.IsEmpty() ||
+        !Negotiated->ApplyServerResponse(AcceptedExtensions, DeflateConfig)) {
+      TearDown(TEXT("WebSocket server accepted an unsupported extension."),
+               false, 1010);
+      return false;
+    }
+    Deflate = MoveTemp(Negotiated);
+  }
+
   if (!ExtraData.IsEmpty()) {
     const FTCHARToUTF8 ExtraUtf8(*ExtraData);
     PendingReceived.Append(reinterpret_cast<const uint8 *>(ExtraUtf8.Get()),
@@ -1330,7 +1928,6 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
   constexpr int32 TempSize = 256;
   uint8 Temp[TempSize];
   bool bRequestComplete = false;
-  FString ClientKey;
 
   int32 HeaderEndIndex = -1;
   if (bUseTls) {
@@ -1380,8 +1977,18 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
     }
   }
 
-  FString RequestString = FString(
-      ANSI_TO_TCHAR(reinterpret_cast<const char *>(RequestBuffer.GetData())));
+  return CompleteServerHandshake(RequestBuffer, HeaderEndIndex);
+}
+
+bool FMcpBridgeWebSocket::CompleteServerHandshake(
+    const TArray<uint8> &RequestBuffer, int32 HeaderEndIndex) {
+  FString ClientKey;
+
+  // Only the header block is text; anything after it is frame data.
+  const FUTF8ToTCHAR RequestText(
+      reinterpret_cast<const ANSICHAR *>(RequestBuffer.GetData()),
+      HeaderEndIndex > 0 ? HeaderEndIndex : RequestBuffer.Num());
+  const FString RequestString(RequestText.Length(), RequestText.Get());
   TArray<FString> RequestLines;
   RequestString.ParseIntoArrayLines(RequestLines, false);
 
@@ -1413,12 +2020,15 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
   bool bValidConnection = false;
   bool bValidVersion = false;
   FString RequestedProtocols;
+  FString RequestedExtensions;
+  TMap<FString, FString> RequestHeaders;
 
   for (int32 i = 1; i < RequestLines.Num(); ++i) {
     FString Key, Value;
     if (RequestLines[i].Split(TEXT(":"), &Key, &Value)) {
       Key = Key.TrimStartAndEnd();
       Value = Value.TrimStartAndEnd();
+      RequestHeaders.Add(Key.ToLower(), Value);
 
       if (Key.Equals(TEXT("Upgrade"), ESearchCase::IgnoreCase) &&
           Value.Equals(TEXT("websocket"), ESearchCase::IgnoreCase)) {
@@ -1436,10 +2046,33 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
       } else if (Key.Equals(TEXT("Sec-WebSocket-Protocol"),
                             ESearchCase::IgnoreCase)) {
         RequestedProtocols = Value;
+      } else if (Key.Equals(TEXT("Sec-WebSocket-Extensions"),
+                            ESearchCase::IgnoreCase)) {
+        RequestedExtensions = RequestedExtensions.IsEmpty()
+                                  ? Value
+                                  : RequestedExtensions + TEXT(", ") + Value;
       }
     }
   }
 
+  // A scraper's plain GET /metrics is answered and the connection closed
+  // without ever becoming a WebSocket.
+  if (!bValidUpgrade && MetricsProvider.IsBound()) {
+    TArray<FString> RequestLineParts;
+    RequestLines[0].ParseIntoArrayWS(RequestLineParts);
+    FString Path = RequestLineParts.Num() >= 2 ? RequestLineParts[1] : FString();
+    int32 QueryStart = INDEX_NONE;
+    if (Path.FindChar(TEXT('?'), QueryStart)) {
+      Path.LeftInline(QueryStart);
+    }
+    if (RequestLineParts.Num() >= 2 &&
+        RequestLineParts[0].Equals(TEXT("GET"), ESearchCase::CaseSensitive) &&
+        Path.Equals(TEXT("/metrics"), ESearchCase::CaseSensitive)) {
+      ServeMetricsRequest(RequestHeaders);
+      return false;
+    }
+  }
+
   if (!bValidUpgrade || !bValidConnection || !bValidVersion ||
       ClientKey.IsEmpty()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
@@ -1511,17 +2144,38 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
                                 *SelectedProtocol);
   }
 
+  if (!RequestedExtensions.IsEmpty()) {
+    TUniquePtr<FMcpPerMessageDeflate> Negotiated =
+        MakeUnique<FMcpPerMessageDeflate>();
+    const FString AcceptedExtension = Negotiated->AcceptClientOffer(
+        RequestedExtensions, McpReadDeflateConfig());
+    if (!AcceptedExtension.IsEmpty()) {
+      Response += FString::Printf(TEXT("Sec-WebSocket-Extensions: %s\r\n"),
+                                  *AcceptedExtension);
+      Deflate = MoveTemp(Negotiated);
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+             TEXT("Server handshake negotiated %s."), *AcceptedExtension);
+    }
+  }
+
   Response += TEXT("\r\n");
 
+  // A non-blocking reactor socket may take only part of the response; the
+  // rest is queued ahead of any frame and written once the socket is
+  // writable again, like any other outbound data.
   FTCHARToUTF8 ResponseUtf8(*Response);
-  int32 BytesSent = 0;
-  if (!SendRaw(reinterpret_cast<const uint8 *>(ResponseUtf8.Get()),
-               ResponseUtf8.Length(), BytesSent) ||
-      BytesSent != ResponseUtf8.Length()) {
+  bool bResponseSent = false;
+  {
+    FScopeLock Guard(&SendMutex);
+    bResponseSent =
+        EnqueueFrame(reinterpret_cast<const uint8 *>(ResponseUtf8.Get()),
+                     ResponseUtf8.Length());
+  }
+  if (!bResponseSent) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
            TEXT("Server handshake failed: unable to send upgrade response "
-                "(sent %d expected %d)."),
-           BytesSent, ResponseUtf8.Length());
+                "(%d bytes)."),
+           ResponseUtf8.Length());
     TearDown(TEXT("Failed to send WebSocket upgrade response."), false, 4000);
     return false;
   }
@@ -1533,6 +2187,59 @@ bool FMcpBridgeWebSocket::PerformServerHandshake() {
   return true;
 }
 
+void FMcpBridgeWebSocket::ServeMetricsRequest(
+    const TMap<FString, FString> &RequestHeaders) {
+  FString Body;
+  const int32 Status = MetricsProvider.Execute(RequestHeaders, Body);
+
+  FString Head;
+  if (Status == 200) {
+    Head = FString::Printf(TEXT("HTTP/1.1 200 OK\r\nContent-Type: %s\r\n"),
+                           FMcpOpenMetricsWriter::GetContentType());
+  } else {
+    const TCHAR *Reason = Status == 401   ? TEXT("Unauthorized")
+                          : Status == 404 ? TEXT("Not Found")
+                                          : TEXT("Service Unavailable");
+    Head = FString::Printf(
+        TEXT("HTTP/1.1 %d %s\r\nContent-Type: text/plain; charset=utf-8\r\n"),
+        Status, Reason);
+    if (Status == 401) {
+      Head += TEXT("WWW-Authenticate: Bearer\r\n");
+    }
+    Body = FString::Printf(TEXT("%s\n"), Reason);
+  }
+
+  const FTCHARToUTF8 BodyUtf8(*Body);
+  Head += FString::Printf(
+      TEXT("Content-Length: %d\r\nConnection: close\r\n\r\n"),
+      BodyUtf8.Length());
+  const FTCHARToUTF8 HeadUtf8(*Head);
+  TArray<uint8> Response;
+  Response.Reserve(HeadUtf8.Length() + BodyUtf8.Length());
+  Response.Append(reinterpret_cast<const uint8 *>(HeadUtf8.Get()),
+                  HeadUtf8.Length());
+  Response.Append(reinterpret_cast<const uint8 *>(BodyUtf8.Get()),
+                  BodyUtf8.Length());
+
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("Serving GET /metrics on port %d (status %d, %d bytes)."), Port,
+         Status, Response.Num());
+
+  if (bReactorManaged) {
+    // The reactor writes whatever the socket does not take at once and
+    // closes the connection when the queue has drained.
+    FScopeLock Guard(&SendMutex);
+    EnqueueFrame(Response.GetData(), Response.Num(), &Response);
+    bCloseAfterSendQueueDrains = true;
+    return;
+  }
+
+  // Nothing else writes to a connection before its upgrade, so this
+  // thread can send the response itself.
+  SendFrame(Response.GetData(), Response.Num());
+  TearDown(TEXT("Metrics request served."), true, 1000);
+}
+
 bool FMcpBridgeWebSocket::ResolveEndpoint(TSharedPtr<FInternetAddr> &OutAddr) {
   ISocketSubsystem *SocketSubsystem =
       ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
@@ -1556,16 +2263,20 @@ bool FMcpBridgeWebSocket::ResolveEndpoint(TSharedPtr<FInternetAddr> &OutAddr) {
 }
 
 bool FMcpBridgeWebSocket::SendFrame(const TArray<uint8> &Frame) {
-  if (!Socket && !(bUseTls && SslHandle)) {
+  return SendFrame(Frame.GetData(), Frame.Num());
+}
+
+bool FMcpBridgeWebSocket::SendFrame(const uint8 *Frame, int32 FrameLength) {
+  if (!HasTransport()) {
     return false;
   }
 
   int32 TotalBytesSent = 0;
-  const int32 TotalBytesToSend = Frame.Num();
+  const int32 TotalBytesToSend = FrameLength;
 
   while (TotalBytesSent < TotalBytesToSend) {
     int32 BytesSent = 0;
-    if (!SendRaw(Frame.GetData() + TotalBytesSent,
+    if (!SendRaw(Frame + TotalBytesSent,
                  TotalBytesToSend - TotalBytesSent, BytesSent)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Error,
              TEXT("Socket Send failed after sending %d / %d bytes"),
@@ -1607,26 +2318,30 @@ bool FMcpBridgeWebSocket::SendCloseFrame(int32 StatusCode,
   return SendControlFrame(OpCodeClose, Payload);
 }
 
-bool FMcpBridgeWebSocket::SendTextFrame(const void *Data, SIZE_T Length) {
+bool FMcpBridgeWebSocket::SendDataFrame(uint8 DataOpCode, const void *Data,
+                                        SIZE_T Length) {
   const uint8 *Raw = static_cast<const uint8 *>(Data);
   TArray<uint8> Frame;
 
-  const uint8 Header = 0x80 | OpCodeText;
-  Frame.Add(Header);
-
-  const bool bMask = !bServerAcceptedConnection;
+  // The compressor's sliding window must see messages in wire order, so a
+  // compressed frame is built and sent under the same lock.
+  FScopeLock Guard(&SendMutex);
 
-  if (Length <= 125) {
-    Frame.Add((bMask ? 0x80 : 0x00) | static_cast<uint8>(Length));
-  } else if (Length <= 0xFFFF) {
-    Frame.Add((bMask ? 0x80 : 0x00) | 126);
-    const uint16 SizeShort = ToNetwork16(static_cast<uint16>(Length));
-    Frame.Append(reinterpret_cast<const uint8 *>(&SizeShort), sizeof(uint16));
-  } else {
-    Frame.Add((bMask ? 0x80 : 0x00) | 127);
-    const uint64 SizeLong = ToNetwork64(static_cast<uint64>(Length));
-    Frame.Append(reinterpret_cast<const uint8 *>(&SizeLong), sizeof(uint64));
+  uint8 Header = 0x80 | DataOpCode;
+  TArray<uint8> Compressed;
+  if (Deflate.IsValid() &&
+      Length >= static_cast<SIZE_T>(Deflate->GetMinMessageBytes()) &&
+      Length <= MaxWebSocketMessageBytes &&
+      Deflate->Compress(Raw, static_cast<int32>(Length), Compressed)) {
+    Header |= 0x40;
+    Raw = Compressed.GetData();
+    Length = Compressed.Num();
   }
+  const bool bMask = !bServerAcceptedConnection;
+  uint8 HeaderBytes[10];
+  const int32 HeaderSize = EncodeFrameHeader(HeaderBytes, Header, Length, bMask);
+  Frame.Reserve(HeaderSize + (bMask ? 4 : 0) + static_cast<int32>(Length));
+  Frame.Append(HeaderBytes, HeaderSize);
 
   if (bMask) {
     uint8 MaskKey[4];
@@ -1637,20 +2352,44 @@ bool FMcpBridgeWebSocket::SendTextFrame(const void *Data, SIZE_T Length) {
 
     const int64 Offset = Frame.Num();
     Frame.AddUninitialized(Length);
-    for (SIZE_T Index = 0; Index < Length; ++Index) {
-      Frame[Offset + Index] = Raw[Index] ^ MaskKey[Index % 4];
-    }
+    McpWebSocketMask::Apply(Frame.GetData() + Offset, Raw, Length, MaskKey);
   } else {
     Frame.Append(Raw, static_cast<int32>(Length));
   }
 
+  return EnqueueFrame(Frame.GetData(), Frame.Num(), &Frame);
+}
+
+bool FMcpBridgeWebSocket::SendTextWithReservedHeader(
+    TArray<uint8> &FrameBuffer, int32 HeaderReserve) {
+  if (!IsConnected() || !HasTransport()) {
+    return false;
+  }
+  check(HeaderReserve >= 10 && HeaderReserve <= FrameBuffer.Num());
+  const uint8 *Payload = FrameBuffer.GetData() + HeaderReserve;
+  const int32 Length = FrameBuffer.Num() - HeaderReserve;
+
+  // Masked (client-side) and compressed frames need a transformed copy of
+  // the payload; the buffer must stay intact in case the caller retries on
+  // another socket.
+  if (!bServerAcceptedConnection ||
+      (Deflate.IsValid() && Length >= Deflate->GetMinMessageBytes())) {
+    return SendDataFrame(OpCodeText, Payload, Length);
+  }
+
+  uint8 HeaderBytes[10];
+  const int32 HeaderSize =
+      EncodeFrameHeader(HeaderBytes, 0x80 | OpCodeText, Length, false);
+  uint8 *FrameStart = FrameBuffer.GetData() + HeaderReserve - HeaderSize;
+  FMemory::Memcpy(FrameStart, HeaderBytes, HeaderSize);
+
   FScopeLock Guard(&SendMutex);
-  return SendFrame(Frame);
+  return EnqueueFrame(FrameStart, HeaderSize + Length);
 }
 
 bool FMcpBridgeWebSocket::SendControlFrame(const uint8 ControlOpCode,
-                                           const TArray<uint8> &Payload) {
-  if (!Socket && !(bUseTls && SslHandle)) {
+                                           TArrayView<const uint8> Payload) {
+  if (!HasTransport()) {
     return false;
   }
 
@@ -1675,23 +2414,286 @@ bool FMcpBridgeWebSocket::SendControlFrame(const uint8 ControlOpCode,
     Frame.Append(MaskKey, 4);
     const int32 PayloadOffset = Frame.Num();
     Frame.AddUninitialized(Payload.Num());
-    for (int32 Index = 0; Index < Payload.Num(); ++Index) {
-      Frame[PayloadOffset + Index] = Payload[Index] ^ MaskKey[Index % 4];
-    }
+    McpWebSocketMask::Apply(Frame.GetData() + PayloadOffset, Payload.GetData(),
+                            Payload.Num(), MaskKey);
   } else if (Payload.Num() > 0) {
-    Frame.Append(Payload);
+    Frame.Append(Payload.GetData(), Payload.Num());
+  }
+
+  return EnqueueFrame(Frame.GetData(), Frame.Num(), &Frame);
+}
+
+void FMcpBridgeWebSocket::ReadSendQueueLimits() {
+  if (const UMcpAutomationBridgeSettings *Settings =
+          GetDefault<UMcpAutomationBridgeSettings>()) {
+    SendQueueHighWaterBytes = FMath::Max(0, Settings->SendQueueHighWaterBytes);
+    MaxSendQueueBytes = FMath::Max(0, Settings->MaxSendQueueBytes);
+  }
+}
+
+bool FMcpBridgeWebSocket::EnqueueFrame(const uint8 *Frame, int32 FrameLength,
+                                       TArray<uint8> *OwnedFrame) {
+  if (bSendQueueFailed || !HasTransport()) {
+    return false;
+  }
+  if (!bReactorManaged && !bSendWorkerActive) {
+    // No sender thread (never started or already stopped): write inline.
+    return SendFrame(Frame, FrameLength);
+  }
+
+  const bool bWasEmpty = SendQueueHead == SendQueue.Num();
+  if (bReactorManaged && bWasEmpty) {
+    // Nothing is queued ahead of this frame, so hand the socket whatever it
+    // takes right now without blocking and queue only the remainder. Most
+    // responses leave here without a trip through the reactor.
+    while (FrameLength > 0) {
+      int32 BytesSent = 0;
+      const EMcpSocketIoResult Result =
+          McpNativeSend(NativeSocketHandle, Frame, FrameLength, BytesSent);
+      if (Result == EMcpSocketIoResult::WouldBlock) {
+        break;
+      }
+      if (Result != EMcpSocketIoResult::Ok) {
+        AbortSendQueue(TEXT("socket write failed"));
+        return false;
+      }
+      GMcpTotalBytesSent += BytesSent;
+      Frame += BytesSent;
+      FrameLength -= BytesSent;
+      OwnedFrame = nullptr;
+    }
+    if (FrameLength == 0) {
+      return true;
+    }
+  }
+
+  // A single frame larger than the cap is still accepted into an empty
+  // queue; the cap is about a client falling behind, not message size.
+  const int64 Queued = QueuedSendBytes;
+  if (MaxSendQueueBytes > 0 && Queued > 0 &&
+      Queued + FrameLength > MaxSendQueueBytes) {
+    AbortSendQueue(TEXT("outbound queue limit exceeded"));
+    return false;
+  }
+
+  if (SendQueueHead > 0 && SendQueueHead * 2 >= SendQueue.Num()) {
+    SendQueue.RemoveAt(0, SendQueueHead);
+    SendQueueHead = 0;
+  }
+  if (OwnedFrame) {
+    SendQueue.Add(MoveTemp(*OwnedFrame));
+  } else {
+    SendQueue.Emplace(Frame, FrameLength);
+  }
+  QueuedSendBytes += FrameLength;
+
+  if (!bReactorManaged) {
+    SendQueueEvent->Trigger();
+  } else if (bWasEmpty) {
+    // The reactor only needs to start watching for writability; with an
+    // older frame still queued it already is.
+    WakeReactor();
+  }
+  return true;
+}
+
+bool FMcpBridgeWebSocket::FlushSendQueueNonBlocking() {
+  while (SendQueueHead < SendQueue.Num()) {
+    TArray<uint8> &Frame = SendQueue[SendQueueHead];
+    int32 BytesSent = 0;
+    const EMcpSocketIoResult Result = McpNativeSend(
+        NativeSocketHandle, Frame.GetData() + SendQueueHeadOffset,
+        Frame.Num() - SendQueueHeadOffset, BytesSent);
+    if (Result == EMcpSocketIoResult::WouldBlock) {
+      return true;
+    }
+    if (Result != EMcpSocketIoResult::Ok) {
+      return false;
+    }
+    SendQueueHeadOffset += BytesSent;
+    QueuedSendBytes -= BytesSent;
+    GMcpTotalBytesSent += BytesSent;
+    if (SendQueueHeadOffset == Frame.Num()) {
+      Frame.Empty();
+      ++SendQueueHead;
+      SendQueueHeadOffset = 0;
+    }
+  }
+  SendQueue.Reset();
+  SendQueueHead = 0;
+  return true;
+}
+
+bool FMcpBridgeWebSocket::FlushReactorSendQueue() {
+  FScopeLock Guard(&SendMutex);
+  if (bReactorFinished || NativeSocketHandle == 0) {
+    return false;
+  }
+  if (!FlushSendQueueNonBlocking()) {
+    AbortSendQueue(TEXT("socket write failed"));
+    return false;
+  }
+  return SendQueueHead < SendQueue.Num();
+}
+
+void FMcpBridgeWebSocket::AbortSendQueue(const TCHAR *Reason) {
+  if (!bSendQueueFailed) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Closing automation connection on port %d with %lld outbound "
+                "bytes queued: %s."),
+           Port, QueuedSendBytes.Load(), Reason);
+  }
+  bSendQueueFailed = true;
+  SendQueue.Empty();
+  SendQueueHead = 0;
+  SendQueueHeadOffset = 0;
+  QueuedSendBytes = 0;
+
+  // The connection's I/O thread tears it down once it sees the request.
+  bStopping = true;
+  ReadWakeup.Signal();
+  WakeReactor();
+}
+
+void FMcpBridgeWebSocket::StartSendWorker() {
+  FScopeLock WorkerGuard(&SendWorkerMutex);
+  if (SendThread) {
+    return;
+  }
+  if (!SendQueueEvent) {
+    SendQueueEvent = FPlatformProcess::GetSynchEventFromPool(false);
+  }
+  if (!SendWorkerExitedEvent) {
+    SendWorkerExitedEvent = FPlatformProcess::GetSynchEventFromPool(true);
+  }
+  SendWorkerExitedEvent->Reset();
+  bSendWorkerStopping = false;
+  SendWorker = MakeUnique<FMcpSendQueueRunnable>(*this);
+  SendThread = FRunnableThread::Create(
+      SendWorker.Get(), TEXT("FMcpBridgeWebSocketSender"), 0, TPri_Normal);
+  if (!SendThread) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Failed to create WebSocket sender thread; frames will be "
+                "written by the sending thread."));
+    SendWorker.Reset();
+    return;
+  }
+  FScopeLock Guard(&SendMutex);
+  bSendWorkerActive = true;
+}
+
+void FMcpBridgeWebSocket::StopSendWorker() {
+  FScopeLock WorkerGuard(&SendWorkerMutex);
+  if (!SendThread) {
+    return;
+  }
+  {
+    FScopeLock Guard(&SendMutex);
+    bSendWorkerActive = false;
+  }
+  SendThread->Kill(true);
+  delete SendThread;
+  SendThread = nullptr;
+  SendWorker.Reset();
+}
+
+uint32 FMcpBridgeWebSocket::RunSendQueue() {
+  for (;;) {
+    // Once asked to stop, make one more pass without waiting so frames
+    // queued before the request still go out.
+    const bool bFinalPass = bSendWorkerStopping;
+    if (!bFinalPass) {
+      SendQueueEvent->Wait();
+    }
+
+    // Write everything queued so far. Frames are written outside SendMutex
+    // so senders keep enqueueing while this thread waits on the peer.
+    for (;;) {
+      TArray<uint8> Frame;
+      {
+        FScopeLock Guard(&SendMutex);
+        if (SendQueueHead >= SendQueue.Num()) {
+          SendQueue.Reset();
+          SendQueueHead = 0;
+          break;
+        }
+        Frame = MoveTemp(SendQueue[SendQueueHead++]);
+      }
+
+      const bool bSent = SendFrame(Frame);
+      FScopeLock Guard(&SendMutex);
+      if (!bSent) {
+        AbortSendQueue(TEXT("socket write failed"));
+        break;
+      }
+      if (!bSendQueueFailed) {
+        QueuedSendBytes -= Frame.Num();
+      }
+    }
+    if (bFinalPass) {
+      break;
+    }
   }
+  SendWorkerExitedEvent->Trigger();
+  return 0;
+}
 
-  return SendFrame(Frame);
+void FMcpBridgeWebSocket::FinishSendWorker(double TimeoutSeconds) {
+  FScopeLock WorkerGuard(&SendWorkerMutex);
+  if (!SendThread) {
+    return;
+  }
+  // The sender makes a last pass over the queue before it exits, so its
+  // exit means the queue has been flushed. A sender stuck on a peer that
+  // stopped reading is released by the socket shutdown that follows.
+  bSendWorkerStopping = true;
+  SendQueueEvent->Trigger();
+  SendWorkerExitedEvent->Wait(FTimespan::FromSeconds(TimeoutSeconds));
+}
+
+void FMcpBridgeWebSocket::HandleTextPayload(TArrayView<const uint8> Payload) {
+  DispatchTextMessage(BytesToStringView(Payload));
 }
 
-void FMcpBridgeWebSocket::HandleTextPayload(const TArray<uint8> &Payload) {
-  const FString Message = BytesToStringView(Payload);
+void FMcpBridgeWebSocket::HandleBinaryPayload(
+    TArrayView<const uint8> Payload) {
+  // Binary frames carry MessagePack-encoded automation messages. They are
+  // transcoded to JSON text here so that everything above the transport
+  // (I/O-thread filter, HandleMessage) sees one message format.
+  FString Error;
+  const TSharedPtr<FJsonObject> Decoded =
+      McpMessagePack::Decode(Payload.GetData(), Payload.Num(), Error);
+  if (!Decoded.IsValid()) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Dropping malformed MessagePack frame (%d bytes): %s"),
+           Payload.Num(), *Error);
+    return;
+  }
+
+  FString Message;
+  const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>>
+      Writer =
+          TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(
+              &Message);
+  FJsonSerializer::Serialize(Decoded.ToSharedRef(), Writer);
+  DispatchTextMessage(MoveTemp(Message));
+}
+
+void FMcpBridgeWebSocket::DispatchTextMessage(FString Message) {
+  FMcpBridgeWebSocketMessageFilter Filter;
+  {
+    FScopeLock Guard(&MessageFilterMutex);
+    Filter = IoThreadMessageFilter;
+  }
+  if (Filter.IsBound() && Filter.Execute(SelfWeakPtr.Pin(), Message)) {
+    return;
+  }
+
   // Dispatch message handling to the game thread.
   // Many automation handlers touch editor/world state and must run on the
   // game thread. Keeping the socket receive loop thread-free also prevents
   // long-running actions (e.g. export_level) from stalling the connection.
-  DispatchOnGameThread([WeakThis = SelfWeakPtr, Message] {
+  DispatchOnGameThread([WeakThis = SelfWeakPtr, Message = MoveTemp(Message)] {
     if (TSharedPtr<FMcpBridgeWebSocket> Pinned = WeakThis.Pin()) {
       Pinned->MessageDelegate.Broadcast(Pinned, Message);
     }
@@ -1701,72 +2703,139 @@ void FMcpBridgeWebSocket::HandleTextPayload(const TArray<uint8> &Payload) {
 void FMcpBridgeWebSocket::ResetFragmentState() {
   FragmentAccumulator.Reset();
   bFragmentMessageActive = false;
+  bFragmentMessageBinary = false;
+  bFragmentMessageCompressed = false;
 }
 
 bool FMcpBridgeWebSocket::ReceiveFrame() {
-  uint8 Header[2];
-  if (!ReceiveExact(Header, 2)) {
-    TearDown(TEXT("Failed to read WebSocket frame header."), false, 4001);
-    return false;
-  }
-
-  const bool bFinalFrame = (Header[0] & 0x80) != 0;
-  const uint8 OpCode = Header[0] & 0x0F;
-  uint64 PayloadLength = Header[1] & 0x7F;
-  const bool bMasked = (Header[1] & 0x80) != 0;
-
-  if (bServerAcceptedConnection && !bMasked) {
-    TearDown(TEXT("Client frames must be masked."), false, 1002);
-    return false;
-  }
-
-  if (PayloadLength == 126) {
-    uint8 Extended[2];
-    if (!ReceiveExact(Extended, sizeof(Extended))) {
-      TearDown(TEXT("Failed to read extended payload length."), false, 4001);
+  for (;;) {
+    switch (TryConsumeBufferedFrame()) {
+    case EBufferedFrameResult::Consumed:
+      return true;
+    case EBufferedFrameResult::Closed:
       return false;
+    case EBufferedFrameResult::NeedMore:
+      break;
+    }
+
+    bool bMidFrame = false;
+    {
+      FScopeLock Guard(&ReceiveMutex);
+      bMidFrame = !PendingReceived.IsEmpty();
     }
-    uint16 ShortVal = 0;
-    FMemory::Memcpy(&ShortVal, Extended, sizeof(uint16));
-    PayloadLength = FromNetwork16(ShortVal);
-  } else if (PayloadLength == 127) {
-    uint8 Extended[8];
-    if (!ReceiveExact(Extended, sizeof(Extended))) {
-      TearDown(TEXT("Failed to read extended payload length."), false, 4001);
+    if (!FillReceiveBuffer()) {
+      TearDown(bMidFrame ? TEXT("Failed to read WebSocket payload.")
+                         : TEXT("Failed to read WebSocket frame header."),
+               false, 4001);
       return false;
     }
-    uint64 LongVal = 0;
-    FMemory::Memcpy(&LongVal, Extended, sizeof(uint64));
-    PayloadLength = FromNetwork64(LongVal);
   }
+}
 
-  if (PayloadLength > MaxWebSocketFramePayloadBytes) {
-    TearDown(TEXT("WebSocket message too large."), false, WebSocketCloseCodeMessageTooBig);
-    return false;
-  }
+FMcpBridgeWebSocket::EBufferedFrameResult
+FMcpBridgeWebSocket::TryConsumeBufferedFrame() {
+  bool bFinalFrame = false;
+  bool bCompressed = false;
+  uint8 OpCode = 0;
+  const uint8 *PayloadData = nullptr;
+  int32 PayloadSize = 0;
+  int32 FrameSize = 0;
+  const TCHAR *ProtocolError = nullptr;
+  int32 ProtocolErrorCode = 0;
+  {
+    FScopeLock Guard(&ReceiveMutex);
+    const int32 Available = PendingReceived.Num();
+    if (Available < 2) {
+      return EBufferedFrameResult::NeedMore;
+    }
+
+    uint8 *Data = PendingReceived.GetMutableData();
+    bFinalFrame = (Data[0] & 0x80) != 0;
+    bCompressed = (Data[0] & 0x40) != 0;
+    OpCode = Data[0] & 0x0F;
+    const bool bMasked = (Data[1] & 0x80) != 0;
+    uint64 PayloadLength = Data[1] & 0x7F;
+    int32 HeaderSize = 2;
+
+    if (bServerAcceptedConnection && !bMasked) {
+      ProtocolError = TEXT("Client frames must be masked.");
+      ProtocolErrorCode = 1002;
+    } else {
+      if (PayloadLength == 126) {
+        HeaderSize += 2;
+        if (Available < HeaderSize) {
+          return EBufferedFrameResult::NeedMore;
+        }
+        uint16 ShortVal = 0;
+        FMemory::Memcpy(&ShortVal, Data + 2, sizeof(uint16));
+        PayloadLength = FromNetwork16(ShortVal);
+      } else if (PayloadLength == 127) {
+        HeaderSize += 8;
+        if (Available < HeaderSize) {
+          return EBufferedFrameResult::NeedMore;
+        }
+        uint64 LongVal = 0;
+        FMemory::Memcpy(&LongVal, Data + 2, sizeof(uint64));
+        PayloadLength = FromNetwork64(LongVal);
+      }
 
-  uint8 MaskKey[4] = {0, 0, 0, 0};
-  if (bMasked) {
-    if (!ReceiveExact(MaskKey, 4)) {
-      TearDown(TEXT("Failed to read masking key."), false, 4001);
-      return false;
+      if (PayloadLength > MaxWebSocketFramePayloadBytes) {
+        ProtocolError = TEXT("WebSocket message too large.");
+        ProtocolErrorCode = WebSocketCloseCodeMessageTooBig;
+      }
     }
-  }
 
-  TArray<uint8> Payload;
-  if (PayloadLength > 0) {
-    Payload.SetNumUninitialized(static_cast<int32>(PayloadLength));
-    if (!ReceiveExact(Payload.GetData(), PayloadLength)) {
-      TearDown(TEXT("Failed to read WebSocket payload."), false, 4001);
-      return false;
-    }
-    if (bMasked) {
-      for (uint64 Index = 0; Index < PayloadLength; ++Index) {
-        Payload[Index] ^= MaskKey[Index % 4];
+    if (!ProtocolError) {
+      const uint8 *MaskKey = Data + HeaderSize;
+      if (bMasked) {
+        HeaderSize += 4;
+      }
+      const int64 FullSize =
+          static_cast<int64>(HeaderSize) + static_cast<int64>(PayloadLength);
+      if (Available < FullSize) {
+        return EBufferedFrameResult::NeedMore;
       }
+
+      // Unmask in place; the payload is handed on as a view into the buffer.
+      uint8 *Payload = Data + HeaderSize;
+      if (bMasked) {
+        McpWebSocketMask::Apply(Payload, Payload, PayloadLength, MaskKey);
+      }
+      PayloadData = Payload;
+      PayloadSize = static_cast<int32>(PayloadLength);
+      FrameSize = static_cast<int32>(FullSize);
     }
   }
 
+  if (ProtocolError) {
+    TearDown(ProtocolError, false, ProtocolErrorCode);
+    return EBufferedFrameResult::Closed;
+  }
+
+  // Only this thread reads or compacts the buffer, so the view stays valid
+  // until the frame is consumed below.
+  const bool bProcessed =
+      ProcessFrame(bFinalFrame, OpCode, bCompressed,
+                   TArrayView<const uint8>(PayloadData, PayloadSize));
+  {
+    FScopeLock Guard(&ReceiveMutex);
+    PendingReceived.Consume(FrameSize);
+  }
+  return bProcessed ? EBufferedFrameResult::Consumed
+                    : EBufferedFrameResult::Closed;
+}
+
+bool FMcpBridgeWebSocket::ProcessFrame(bool bFinalFrame, uint8 OpCode,
+                                       bool bCompressed,
+                                       TArrayView<const uint8> Payload) {
+  // RSV1 marks a compressed message and is only legal on the first frame of
+  // a data message once permessage-deflate was negotiated.
+  if (bCompressed && (!Deflate.IsValid() || (OpCode & 0x08) != 0 ||
+                      OpCode == OpCodeContinuation)) {
+    TearDown(TEXT("Unexpected RSV1 bit on WebSocket frame."), false, 1002);
+    return false;
+  }
+
   if (OpCode == OpCodeClose) {
     TearDown(TEXT("WebSocket closed by peer."), true, 1000);
     return false;
@@ -1808,11 +2877,14 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
       return false;
     }
 
-    FragmentAccumulator.Append(Payload);
+    FragmentAccumulator.Append(Payload.GetData(), Payload.Num());
 
     if (bFinalFrame) {
-      HandleTextPayload(FragmentAccumulator);
+      const bool bDelivered = DeliverDataMessage(
+          bFragmentMessageBinary, bFragmentMessageCompressed,
+          FragmentAccumulator);
       ResetFragmentState();
+      return bDelivered;
     }
     return true;
   }
@@ -1824,109 +2896,128 @@ bool FMcpBridgeWebSocket::ReceiveFrame() {
     return false;
   }
 
-  if (OpCode == OpCodeText) {
+  if (OpCode == OpCodeText || OpCode == OpCodeBinary) {
+    const bool bBinary = OpCode == OpCodeBinary;
     if (bFinalFrame) {
-      HandleTextPayload(Payload);
+      return DeliverDataMessage(bBinary, bCompressed, Payload);
     } else {
       if (static_cast<uint64>(Payload.Num()) > MaxWebSocketMessageBytes) {
         TearDown(TEXT("WebSocket message too large."), false, WebSocketCloseCodeMessageTooBig);
         return false;
       }
-      FragmentAccumulator = Payload;
+      FragmentAccumulator.Reset();
+      FragmentAccumulator.Append(Payload.GetData(), Payload.Num());
       bFragmentMessageActive = true;
+      bFragmentMessageBinary = bBinary;
+      bFragmentMessageCompressed = bCompressed;
     }
     return true;
   }
 
-  if (OpCode == OpCodeBinary) {
-    TearDown(TEXT("Binary frames are not supported."), false, 4003);
-    return false;
-  }
-
   TearDown(TEXT("Unsupported WebSocket opcode."), false, 4003);
   return false;
 }
 
-bool FMcpBridgeWebSocket::ReceiveExact(uint8 *Buffer, SIZE_T Length) {
-  SIZE_T Collected = 0;
-
-  {
-    FScopeLock Guard(&ReceiveMutex);
-    const SIZE_T Existing =
-        FMath::Min(static_cast<SIZE_T>(PendingReceived.Num()), Length);
-    if (Existing > 0) {
-      FMemory::Memcpy(Buffer, PendingReceived.GetData(), Existing);
-      PendingReceived.RemoveAt(0, Existing
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
-      // UE 5.4+: Uses EAllowShrinking enum
-      , EAllowShrinking::No
-#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-      // UE 5.1-5.3: Uses bool bAllowShrinking
-      , false
-#endif
-      );
-      Collected += Existing;
+bool FMcpBridgeWebSocket::DeliverDataMessage(bool bBinary, bool bCompressed,
+                                             TArrayView<const uint8> Payload) {
+  MCP_TRACE_SCOPE("McpBridge.Receive");
+  if (!bCompressed) {
+    if (bBinary) {
+      HandleBinaryPayload(Payload);
+    } else {
+      HandleTextPayload(Payload);
     }
+    return true;
   }
 
-  if (bUseTls && SslHandle) {
-    while (Collected < Length) {
-      if (bStopping) {
-        return false;
-      }
+  TArray<uint8> Inflated;
+  if (!Deflate->Decompress(Payload.GetData(), Payload.Num(),
+                           MaxWebSocketMessageBytes, Inflated)) {
+    TearDown(TEXT("Failed to inflate compressed WebSocket message."), false,
+             WebSocketCloseCodeMessageTooBig);
+    return false;
+  }
+  if (bBinary) {
+    HandleBinaryPayload(Inflated);
+  } else {
+    HandleTextPayload(Inflated);
+  }
+  return true;
+}
 
-      const int32 Remaining = static_cast<int32>(Length - Collected);
-      int32 BytesRead = 0;
-      if (!RecvRaw(Buffer + Collected, Remaining, BytesRead)) {
-        return false;
+bool FMcpBridgeWebSocket::WaitForReadable() {
+  while (!bStopping) {
+#if WITH_SSL
+    if (bUseTls && SslHandle) {
+      // Records already decrypted by OpenSSL never show up on the socket.
+      // Only those count: the bytes of a record OpenSSL has not completed
+      // yet need more input, so that case waits on the socket below.
+      if (SSL_pending(SslHandle) > 0) {
+        return true;
       }
-      if (BytesRead <= 0) {
-        if (StopEvent && StopEvent->Wait(FTimespan::FromMilliseconds(10))) {
-          return false;
-        }
-        continue;
+      if (bTlsReadWantsWrite) {
+        // Waiting for input here would return at once whenever the peer has
+        // sent something, and SSL_read would stall on the same write again.
+        // Wait (at most a slice) for room to send, then let SSL_read retry
+        // and surface any socket error.
+        McpWaitForWritable(NativeSocketHandle, ReadinessWaitSliceMs);
+        return true;
+      }
+      const EMcpSocketWaitResult Result = McpWaitForReadable(
+          NativeSocketHandle, &ReadWakeup,
+          ReadWakeup.IsPollable() ? -1 : ReadinessWaitSliceMs);
+      if (Result == EMcpSocketWaitResult::Readable) {
+        return true;
       }
-      Collected += static_cast<SIZE_T>(BytesRead);
+      if (Result == EMcpSocketWaitResult::Error) {
+        return false;
+      }
+      continue;
+    }
+#endif
+
+    FSocket *LocalSocket = Socket;
+    if (!LocalSocket) {
+      return false;
+    }
+    // FSocket does not expose its descriptor before UE 5.7, so the plain
+    // path blocks in FSocket::Wait (select/poll underneath). Close() shuts
+    // the socket down, which ends the wait without waiting out the slice.
+    if (LocalSocket->Wait(ESocketWaitConditions::WaitForRead,
+                          FTimespan::FromMilliseconds(ReadinessWaitSliceMs))) {
+      return true;
     }
-    return true;
   }
+  return false;
+}
 
-  while (Collected < Length) {
-    if (bStopping) {
+bool FMcpBridgeWebSocket::FillReceiveBuffer() {
+  while (!bStopping) {
+    if (!WaitForReadable()) {
       return false;
     }
 
-    uint32 PendingSize = 0;
-    if (!Socket->HasPendingData(PendingSize)) {
-      if (StopEvent && StopEvent->Wait(FTimespan::FromMilliseconds(50))) {
-        return false;
-      }
-      continue;
+    // Only this thread writes to the buffer, so the target stays valid
+    // between PrepareWrite and CommitWrite without holding the lock.
+    uint8 *Target = nullptr;
+    int32 Capacity = 0;
+    {
+      FScopeLock Guard(&ReceiveMutex);
+      Target = PendingReceived.PrepareWrite(ReceiveChunkBytes, Capacity);
     }
 
-    const uint32 ReadSize = FMath::Min<uint32>(PendingSize, 4096);
-    TArray<uint8> Temp;
-    Temp.SetNumUninitialized(ReadSize);
     int32 BytesRead = 0;
-    if (!RecvRaw(Temp.GetData(), ReadSize, BytesRead)) {
+    if (!RecvRaw(Target, Capacity, BytesRead)) {
       return false;
     }
-
     if (BytesRead <= 0) {
+      // Spurious wakeup or a TLS record that needs more bytes.
       continue;
     }
 
-    const uint32 CopyCount =
-        FMath::Min<uint32>(static_cast<uint32>(BytesRead),
-                           static_cast<uint32>(Length - Collected));
-    FMemory::Memcpy(Buffer + Collected, Temp.GetData(), CopyCount);
-    Collected += CopyCount;
-
-    if (static_cast<uint32>(BytesRead) > CopyCount) {
-      FScopeLock Guard(&ReceiveMutex);
-      PendingReceived.Append(Temp.GetData() + CopyCount, BytesRead - CopyCount);
-    }
+    FScopeLock Guard(&ReceiveMutex);
+    PendingReceived.CommitWrite(BytesRead);
+    return true;
   }
-
-  return true;
+  return false;
 }
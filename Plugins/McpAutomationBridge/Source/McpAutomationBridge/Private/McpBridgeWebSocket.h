@@ -1,12 +1,17 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/UnrealString.h"
 #include "Delegates/Delegate.h"
 #include "HAL/CriticalSection.h"
 #include "HAL/Runnable.h"
+#include "McpBridgeDeflate.h"
+#include "McpBridgeReceiveBuffer.h"
+#include "McpBridgeSocketPoller.h"
 #include "Templates/Atomic.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
 
 class FSocket;
 class FInternetAddr;
@@ -21,6 +26,7 @@ typedef struct ssl_st SSL;
 #endif
 
 class FMcpBridgeWebSocket;
+class FMcpSendQueueRunnable;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketConnectedEvent, TSharedPtr<FMcpBridgeWebSocket>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketConnectionErrorEvent, const FString& /*Error*/);
@@ -28,10 +34,23 @@ DECLARE_MULTICAST_DELEGATE_FourParams(FMcpBridgeWebSocketClosedEvent, TSharedPtr
 DECLARE_MULTICAST_DELEGATE_TwoParams(FMcpBridgeWebSocketMessageEvent, TSharedPtr<FMcpBridgeWebSocket>, const FString& /*Message*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketHeartbeatEvent, TSharedPtr<FMcpBridgeWebSocket>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMcpBridgeWebSocketClientConnectedEvent, TSharedPtr<FMcpBridgeWebSocket>);
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FMcpBridgeWebSocketMessageFilter, TSharedPtr<FMcpBridgeWebSocket>, const FString& /*Message*/);
+/**
+ * Answers a plain HTTP GET /metrics sent to a listener in place of a WebSocket upgrade. Runs on the
+ * connection's I/O thread with the request headers (lower-case names); returns the HTTP status and,
+ * for 200, fills OutBody with OpenMetrics text.
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(int32, FMcpBridgeWebSocketMetricsProvider, const TMap<FString, FString>& /*Headers*/, FString& /*OutBody*/);
 
 /**
  * Minimal WebSocket client/server used by the MCP Automation Bridge subsystem.
- * Supports text frames over ws:// and optional wss:// transports for local automation traffic.
+ * Supports text frames, plus binary frames carrying negotiated MessagePack automation traffic,
+ * over ws:// and optional wss:// transports for local automation traffic.
+ *
+ * Send calls never wait on the peer: each frame is built on the calling thread and appended to the
+ * connection's outbound queue, which its I/O thread writes out (the shared reactor thread for
+ * reactor-managed clients, a per-connection sender thread otherwise). A client that stops reading
+ * shows up as a growing GetQueuedSendBytes() rather than as a stalled game thread.
  */
 class FMcpBridgeWebSocket final : public TSharedFromThis<FMcpBridgeWebSocket>, public FRunnable
 {
@@ -48,15 +67,35 @@ public:
     void Close(int32 StatusCode = 1000, const FString& Reason = FString());
     bool Send(const FString& Data);
     bool Send(const void* Data, SIZE_T Length);
+    /** Sends Data as a single binary frame (negotiated MessagePack traffic). */
+    bool SendBinary(const void* Data, SIZE_T Length);
+    // Sends FrameBuffer[HeaderReserve..] as one text frame, writing the frame
+    // header into the reserved bytes in front of the payload instead of
+    // copying the payload into a new frame. HeaderReserve must be at least 10.
+    // The payload itself is left unmodified.
+    bool SendTextWithReservedHeader(TArray<uint8>& FrameBuffer, int32 HeaderReserve);
     bool IsConnected() const;
     bool IsListening() const;
 
+    /** Bytes accepted by the Send calls that have not been written to the socket yet. */
+    int64 GetQueuedSendBytes() const { return QueuedSendBytes; }
+    /** True while the outbound queue is above SendQueueHighWaterBytes; best-effort traffic should be skipped. */
+    bool IsSendQueueAboveHighWater() const;
+
     // Accessors for diagnostics
     FString GetListenHost() const { return ListenHost; }
     int32 GetPort() const { return Port; }
 
     void SendHeartbeatPing();
 
+    /** Set once bridge_hello negotiates MessagePack; automation responses are then sent as binary frames. */
+    void SetBinaryAutomationFrames(bool bEnable) { bBinaryAutomationFrames = bEnable; }
+    bool UsesBinaryAutomationFrames() const { return bBinaryAutomationFrames; }
+
+    /** Set once bridge_hello negotiates chunked responses; 0 means results are always sent whole. */
+    void SetResponseChunkBytes(int32 Bytes) { ResponseChunkBytes = Bytes; }
+    int32 GetResponseChunkBytes() const { return ResponseChunkBytes; }
+
     // Delegates
     FMcpBridgeWebSocketConnectedEvent ConnectedDelegate;
     FMcpBridgeWebSocketConnectionErrorEvent ConnectionErrorDelegate;
@@ -84,26 +123,85 @@ public:
     // before it begins draining frames.
     void NotifyMessageHandlerRegistered();
 
+    // Install a filter that sees each text message on the socket I/O thread
+    // before it is dispatched to the game thread. Returning true consumes the
+    // message; the filter must therefore be thread-safe. Pass an unbound
+    // delegate to remove it.
+    void SetIoThreadMessageFilter(FMcpBridgeWebSocketMessageFilter InFilter);
+
+    // Serve GET /metrics on this listener's port from Provider. Must be set
+    // before Listen(); accepted connections take a copy.
+    void SetMetricsProvider(FMcpBridgeWebSocketMetricsProvider InProvider) { MetricsProvider = MoveTemp(InProvider); }
+
+    // Process-wide traffic counters, across every connection and direction.
+    static int64 GetTotalBytesReceived();
+    static int64 GetTotalBytesSent();
+    /** Connections that completed the WebSocket handshake and are not closed yet. */
+    static int32 GetOpenConnectionCount();
+
     // FRunnable
     virtual bool Init() override;
     virtual uint32 Run() override;
     virtual void Stop() override;
 
 private:
+    enum class EBufferedFrameResult : uint8
+    {
+        Consumed,
+        NeedMore,
+        Closed
+    };
+
+    friend class FMcpSendQueueRunnable;
+
     uint32 RunClient();
     uint32 RunServer();
+    uint32 RunReactor();
+    bool ShouldUseReactor() const;
+    void TrackAcceptedClient(const TSharedPtr<FMcpBridgeWebSocket>& ClientWebSocket);
+    void AcceptReactorClients(UPTRINT ListenHandle, TMap<UPTRINT, TSharedPtr<FMcpBridgeWebSocket>>& Connections);
+    void ServiceReactorReadable();
+    void TryCompleteReactorHandshake();
+    void PumpReactorFrames(bool bForce);
+    double GetReactorWakeDeadline() const;
+    void ReleaseReactorConnection();
+    void WakeReactor();
+    bool HasTransport() const;
+    void BroadcastConnectionEstablished();
     void TearDown(const FString& Reason, bool bWasClean, int32 StatusCode);
     bool PerformHandshake();
     bool PerformServerHandshake();
+    bool CompleteServerHandshake(const TArray<uint8>& RequestBuffer, int32 HeaderEndIndex);
+    void ServeMetricsRequest(const TMap<FString, FString>& RequestHeaders);
     bool ResolveEndpoint(TSharedPtr<FInternetAddr>& OutAddr);
     bool SendFrame(const TArray<uint8>& Frame);
+    bool SendFrame(const uint8* Frame, int32 FrameLength);
     bool SendCloseFrame(int32 StatusCode, const FString& Reason);
-    bool SendTextFrame(const void* Data, SIZE_T Length);
-    bool SendControlFrame(uint8 ControlOpCode, const TArray<uint8>& Payload);
-    void HandleTextPayload(const TArray<uint8>& Payload);
+    bool SendDataFrame(uint8 DataOpCode, const void* Data, SIZE_T Length);
+    bool SendControlFrame(uint8 ControlOpCode, TArrayView<const uint8> Payload);
+    // Outbound queue. EnqueueFrame, FlushSendQueueNonBlocking and
+    // AbortSendQueue require SendMutex to be held.
+    void ReadSendQueueLimits();
+    bool EnqueueFrame(const uint8* Frame, int32 FrameLength, TArray<uint8>* OwnedFrame = nullptr);
+    bool FlushSendQueueNonBlocking();
+    bool FlushReactorSendQueue();
+    void AbortSendQueue(const TCHAR* Reason);
+    void StartSendWorker();
+    void StopSendWorker();
+    uint32 RunSendQueue();
+    // Lets the sender write what is already queued and exit, waiting at most
+    // TimeoutSeconds for it. StopSendWorker still has to join it.
+    void FinishSendWorker(double TimeoutSeconds);
+    void HandleTextPayload(TArrayView<const uint8> Payload);
+    void HandleBinaryPayload(TArrayView<const uint8> Payload);
+    void DispatchTextMessage(FString Message);
     void ResetFragmentState();
     bool ReceiveFrame();
-    bool ReceiveExact(uint8* Buffer, SIZE_T Length);
+    bool ProcessFrame(bool bFinalFrame, uint8 OpCode, bool bCompressed, TArrayView<const uint8> Payload);
+    bool DeliverDataMessage(bool bBinary, bool bCompressed, TArrayView<const uint8> Payload);
+    EBufferedFrameResult TryConsumeBufferedFrame();
+    bool FillReceiveBuffer();
+    bool WaitForReadable();
     bool SendRaw(const uint8* Data, int32 Length, int32& OutBytesSent);
     bool RecvRaw(uint8* Data, int32 Length, int32& OutBytesRead);
 #if WITH_SSL
@@ -123,9 +221,17 @@ private:
 
     // Server tuning (moved later to ensure proper initialization order)
 
-    TArray<uint8> PendingReceived;
+    // Bytes read from the socket but not yet parsed into frames. Written and
+    // consumed only by the connection's receive thread (or its reactor).
+    FMcpReceiveBuffer PendingReceived;
     TArray<uint8> FragmentAccumulator;
     bool bFragmentMessageActive;
+    bool bFragmentMessageBinary = false;
+    bool bFragmentMessageCompressed = false;
+
+    // permessage-deflate state, set during the opening handshake when both
+    // sides agreed on it; null means frames are never compressed.
+    TUniquePtr<FMcpPerMessageDeflate> Deflate;
 
     TWeakPtr<FMcpBridgeWebSocket> SelfWeakPtr;
 
@@ -135,6 +241,13 @@ private:
     FSocket* ListenSocket;
     FRunnableThread* Thread;
     FEvent* StopEvent;
+    // Pollable wakeup signalled by Stop()/Close() so a reader blocked in
+    // WaitForReadable() returns immediately instead of on its next slice.
+    FMcpSocketWakeup ReadWakeup;
+    // Set when the last SSL_read stopped because OpenSSL needs to write
+    // (a handshake or key update message); the reader then waits for the
+    // socket to drain rather than for input.
+    bool bTlsReadWantsWrite = false;
     FCriticalSection ClientSocketsMutex;
     TArray<TSharedPtr<FMcpBridgeWebSocket>> ClientSockets;
 
@@ -142,6 +255,19 @@ private:
     int32 ListenBacklog = 10;
     float AcceptSleepSeconds = 0.01f;
 
+    // Shared reactor state. A listener owns ReactorPollSet and services all
+    // of its accepted clients from its own thread; accepted clients keep a
+    // weak pointer back so Close() and handler registration can wake it.
+    // The reactor thread is the only one that reads from or closes a
+    // managed client's descriptor.
+    TUniquePtr<FMcpSocketPollSet> ReactorPollSet;
+    TWeakPtr<FMcpBridgeWebSocket> ReactorOwner;
+    TArray<uint8> HandshakeBuffer;
+    double ReactorHandlerDeadline = 0.0;
+    bool bReactorManaged = false;
+    bool bReactorHandshakeComplete = false;
+    bool bReactorFinished = false;
+
     // Connection state
     bool bConnected;
     bool bListening;
@@ -177,4 +303,45 @@ private:
     // Set to true by the game thread when it has registered the message
     // handler for this client connection.
     TAtomic<bool> bHandlerRegistered;
+
+    // Frames waiting to be written, oldest at SendQueueHead; the head frame
+    // may be partly sent already (SendQueueHeadOffset bytes). Guarded by
+    // SendMutex, which also keeps frames in the order they were built.
+    TArray<TArray<uint8>> SendQueue;
+    int32 SendQueueHead = 0;
+    int32 SendQueueHeadOffset = 0;
+    TAtomic<int64> QueuedSendBytes{0};
+    int64 SendQueueHighWaterBytes = 0;
+    int64 MaxSendQueueBytes = 0;
+    // Set once a write failed or the queue overflowed; later sends fail fast.
+    TAtomic<bool> bSendQueueFailed{false};
+    // Per-connection sender for connections not serviced by a reactor.
+    // SendWorkerMutex serializes starting and joining it.
+    TUniquePtr<FMcpSendQueueRunnable> SendWorker;
+    FRunnableThread* SendThread = nullptr;
+    FEvent* SendQueueEvent = nullptr;
+    // Triggered when RunSendQueue returns.
+    FEvent* SendWorkerExitedEvent = nullptr;
+    TAtomic<bool> bSendWorkerStopping{false};
+    FCriticalSection SendWorkerMutex;
+    // Whether frames go through SendWorker; guarded by SendMutex.
+    bool bSendWorkerActive = false;
+    // Reactor thread only: whether the poll set reports this socket writable.
+    bool bReactorWriteInterest = false;
+
+    // Negotiated per connection; read by whichever thread sends a response.
+    TAtomic<bool> bBinaryAutomationFrames{false};
+    TAtomic<int32> ResponseChunkBytes{0};
+
+    // Optional I/O-thread message filter; guarded because it is installed
+    // from the game thread while the socket thread may be reading frames.
+    FMcpBridgeWebSocketMessageFilter IoThreadMessageFilter;
+    FCriticalSection MessageFilterMutex;
+
+    FMcpBridgeWebSocketMetricsProvider MetricsProvider;
+    // Set once a /metrics response is queued; the reactor closes the
+    // connection when its outbound queue has drained.
+    bool bCloseAfterSendQueueDrains = false;
+    // Whether this connection is included in GetOpenConnectionCount().
+    TAtomic<bool> bCountedAsOpen{false};
 };
@@ -0,0 +1,106 @@
+#include "McpBridgeWebSocketMask.h"
+
+// SSE2 is part of the x64 baseline and NEON of AArch64, so neither needs a
+// runtime CPU check. Wider AVX2 kernels would; at 16 bytes per XOR the loop
+// is already bound by memory bandwidth on payloads that miss the cache.
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_64BITS
+#define MCP_WEBSOCKET_MASK_SSE2 1
+#include <emmintrin.h>
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#define MCP_WEBSOCKET_MASK_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifndef MCP_WEBSOCKET_MASK_SSE2
+#define MCP_WEBSOCKET_MASK_SSE2 0
+#endif
+#ifndef MCP_WEBSOCKET_MASK_NEON
+#define MCP_WEBSOCKET_MASK_NEON 0
+#endif
+
+namespace McpWebSocketMask {
+const TCHAR *KernelName() {
+#if MCP_WEBSOCKET_MASK_SSE2
+  return TEXT("sse2");
+#elif MCP_WEBSOCKET_MASK_NEON
+  return TEXT("neon");
+#else
+  return TEXT("scalar64");
+#endif
+}
+
+void Apply(uint8 *Dest, const uint8 *Src, SIZE_T Length,
+           const uint8 MaskKey[4]) {
+  // Copying the key bytes into a word keeps their memory order, so the
+  // vector lanes line up with the payload bytes on any endianness.
+  uint32 Key32 = 0;
+  FMemory::Memcpy(&Key32, MaskKey, sizeof(Key32));
+  SIZE_T Index = 0;
+
+#if MCP_WEBSOCKET_MASK_SSE2
+  const __m128i Key = _mm_set1_epi32(static_cast<int32>(Key32));
+  for (; Index + 64 <= Length; Index += 64) {
+    const __m128i A =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index));
+    const __m128i B =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 16));
+    const __m128i C =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 32));
+    const __m128i D =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index + 48));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dest + Index),
+                     _mm_xor_si128(A, Key));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dest + Index + 16),
+                     _mm_xor_si128(B, Key));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dest + Index + 32),
+                     _mm_xor_si128(C, Key));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dest + Index + 48),
+                     _mm_xor_si128(D, Key));
+  }
+  for (; Index + 16 <= Length; Index += 16) {
+    const __m128i A =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Src + Index));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(Dest + Index),
+                     _mm_xor_si128(A, Key));
+  }
+#elif MCP_WEBSOCKET_MASK_NEON
+  const uint8x16_t Key = vreinterpretq_u8_u32(vdupq_n_u32(Key32));
+  for (; Index + 64 <= Length; Index += 64) {
+    const uint8x16_t A = vld1q_u8(Src + Index);
+    const uint8x16_t B = vld1q_u8(Src + Index + 16);
+    const uint8x16_t C = vld1q_u8(Src + Index + 32);
+    const uint8x16_t D = vld1q_u8(Src + Index + 48);
+    vst1q_u8(Dest + Index, veorq_u8(A, Key));
+    vst1q_u8(Dest + Index + 16, veorq_u8(B, Key));
+    vst1q_u8(Dest + Index + 32, veorq_u8(C, Key));
+    vst1q_u8(Dest + Index + 48, veorq_u8(D, Key));
+  }
+  for (; Index + 16 <= Length; Index += 16) {
+    vst1q_u8(Dest + Index, veorq_u8(vld1q_u8(Src + Index), Key));
+  }
+#endif
+
+  // Word-at-a-time pass: the whole input on builds without a vector kernel,
+  // at most one word otherwise.
+  const uint64 Key64 = static_cast<uint64>(Key32) |
+                       (static_cast<uint64>(Key32) << 32);
+  for (; Index + 8 <= Length; Index += 8) {
+    uint64 Word;
+    FMemory::Memcpy(&Word, Src + Index, sizeof(Word));
+    Word ^= Key64;
+    FMemory::Memcpy(Dest + Index, &Word, sizeof(Word));
+  }
+
+  // Index is a multiple of 8 here, so the mask phase restarts at byte 0.
+  for (; Index < Length; ++Index) {
+    Dest[Index] = Src[Index] ^ MaskKey[Index & 3];
+  }
+}
+
+void ApplyScalar(uint8 *Dest, const uint8 *Src, SIZE_T Length,
+                 const uint8 MaskKey[4]) {
+  for (SIZE_T Index = 0; Index < Length; ++Index) {
+    Dest[Index] = Src[Index] ^ MaskKey[Index % 4];
+  }
+}
+} // namespace McpWebSocketMask
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * RFC 6455 payload masking. The XOR is its own inverse, so the same kernels
+ * mask outgoing client frames and unmask incoming server-side frames.
+ */
+namespace McpWebSocketMask
+{
+	/** Name of the vector kernel compiled into this build ("sse2", "neon" or "scalar64"). */
+	const TCHAR* KernelName();
+
+	/**
+	 * Writes Src XOR the repeating 4-byte MaskKey to Dest, starting at mask
+	 * byte 0. Dest may equal Src for in-place unmasking; other overlaps are
+	 * not supported.
+	 */
+	void Apply(uint8* Dest, const uint8* Src, SIZE_T Length, const uint8 MaskKey[4]);
+
+	/** Byte-at-a-time reference implementation, kept for benchmarking. */
+	void ApplyScalar(uint8* Dest, const uint8* Src, SIZE_T Length, const uint8 MaskKey[4]);
+}
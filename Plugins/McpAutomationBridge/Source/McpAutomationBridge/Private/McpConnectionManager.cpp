@@ -1,10 +1,16 @@
 #include "McpConnectionManager.h"
+#include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/PlatformMisc.h"
 #include "McpAutomationBridgeSettings.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBridgeJsonStreamWriter.h"
+#include "McpBridgeMessagePack.h"
+#include "McpBridgeOpenMetrics.h"
+#include "McpBridgeResponseStream.h"
+#include "McpBridgeTrace.h"
 #include "McpBridgeWebSocket.h"
 #include "Misc/Guid.h"
 #include "Serialization/JsonReader.h"
@@ -30,6 +36,69 @@ static inline FString SanitizeForLogConnMgr(const FString &In) {
   return Out;
 }
 
+// Binds the socket-thread fast path for automation requests. Only a weak
+// reference is held so sockets never keep the manager alive.
+static FMcpBridgeWebSocketMessageFilter
+MakeIoThreadMessageFilter(TWeakPtr<FMcpConnectionManager> WeakSelf) {
+  return FMcpBridgeWebSocketMessageFilter::CreateLambda(
+      [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock, const FString &Msg) {
+        if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
+          return StrongSelf->TryHandleMessageOnIoThread(Sock, Msg);
+        }
+        return false;
+      });
+}
+
+// Payload fields that name the resource a request reads or writes, in the
+// order they are consulted. Requests on one socket that share a resource keep
+// their submission order when pipelining is negotiated.
+static const TCHAR *const GMcpOrderingKeyFields[] = {
+    TEXT("assetPath"), TEXT("blueprintPath"), TEXT("objectPath"),
+    TEXT("actorName"), TEXT("levelPath"),     TEXT("materialPath"),
+    TEXT("sequencePath"), TEXT("path")};
+
+static FString McpExtractOrderingKey(const TSharedPtr<FJsonObject> &Root,
+                                     const TSharedPtr<FJsonObject> &Payload) {
+  FString Key;
+  if (Root.IsValid() && Root->TryGetStringField(TEXT("orderingKey"), Key) &&
+      !Key.IsEmpty()) {
+    return Key.ToLower();
+  }
+  if (Payload.IsValid()) {
+    for (const TCHAR *Field : GMcpOrderingKeyFields) {
+      if (Payload->TryGetStringField(Field, Key) && !Key.IsEmpty()) {
+        return Key.ToLower();
+      }
+    }
+  }
+  return FString();
+}
+
+// Reads the optional envelope "priority"; unknown names keep the handler's
+// default rather than failing the request.
+static bool McpExtractRequestPriority(const TSharedPtr<FJsonObject> &Root,
+                                      EMcpRequestPriority &OutPriority) {
+  FString Name;
+  if (!Root.IsValid() || !Root->TryGetStringField(TEXT("priority"), Name)) {
+    return false;
+  }
+  if (McpParseRequestPriority(Name, OutPriority)) {
+    return true;
+  }
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+         TEXT("Ignoring unknown request priority '%s'."), *Name.Left(32));
+  return false;
+}
+
+// Smallest response_chunk size granted in bridge_ack; below this the per-chunk
+// envelope dominates and a large result turns into thousands of frames.
+static constexpr int32 McpMinResponseChunkBytes = 4096;
+
+// Distinct action names given their own telemetry entry; later ones share
+// "other", so clients sending arbitrary action names cannot grow it without
+// bound.
+static constexpr int32 McpMaxTelemetryActions = 256;
+
 FMcpConnectionManager::FMcpConnectionManager() {}
 
 FMcpConnectionManager::~FMcpConnectionManager() { Stop(); }
@@ -61,6 +130,10 @@ void FMcpConnectionManager::Initialize(
       TlsCertificatePath = Settings->TlsCertificatePath;
     if (!Settings->TlsPrivateKeyPath.IsEmpty())
       TlsPrivateKeyPath = Settings->TlsPrivateKeyPath;
+    MaxInFlightRequestsPerConnection =
+        FMath::Max(0, Settings->MaxInFlightRequestsPerConnection);
+    bAllowMessagePackEncoding = Settings->bAllowMessagePackEncoding;
+    MaxResponseChunkBytes = FMath::Max(0, Settings->MaxResponseChunkBytes);
   }
 
   // Allow environment variable overrides for rate limiting (useful for tests)
@@ -133,11 +206,15 @@ void FMcpConnectionManager::Stop() {
       Socket->OnClosed().RemoveAll(this);
       Socket->OnMessage().RemoveAll(this);
       Socket->OnHeartbeat().RemoveAll(this);
+      Socket->SetIoThreadMessageFilter(FMcpBridgeWebSocketMessageFilter());
       Socket->Close();
     }
   }
   ActiveSockets.Empty();
-  AuthenticatedSockets.Empty();
+  {
+    FScopeLock Lock(&AuthenticatedSocketsMutex);
+    AuthenticatedSockets.Empty();
+  }
   {
     FScopeLock Lock(&RateLimitMutex);
     SocketRateLimits.Empty();
@@ -145,6 +222,12 @@ void FMcpConnectionManager::Stop() {
   {
     FScopeLock Lock(&PendingRequestsMutex);
     PendingRequestsToSockets.Empty();
+    RequestPriorities.Empty();
+  }
+  {
+    FScopeLock Lock(&PipelineMutex);
+    PipelineWindows.Empty();
+    InFlightRequests.Empty();
   }
 
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
@@ -164,6 +247,21 @@ void FMcpConnectionManager::SetOnMessageReceived(
   OnMessageReceived = InCallback;
 }
 
+void FMcpConnectionManager::SetOnConcurrentRequest(
+    FMcpConcurrentRequestCallback InCallback) {
+  OnConcurrentRequest = InCallback;
+}
+
+void FMcpConnectionManager::SetOnCollectMetrics(
+    FMcpCollectMetricsCallback InCallback) {
+  OnCollectMetrics = InCallback;
+}
+
+void FMcpConnectionManager::SetOnSocketClosed(
+    FMcpSocketClosedCallback InCallback) {
+  OnSocketClosed = InCallback;
+}
+
 bool FMcpConnectionManager::Tick(float DeltaTime) {
   // Handle reconnect countdown
   if (bReconnectEnabled && TimeUntilReconnect > 0.0f) {
@@ -260,6 +358,19 @@ void FMcpConnectionManager::AttemptConnection() {
                                           bEnableTls, TlsCertificatePath,
                                           TlsPrivateKeyPath);
       ServerSocket->InitializeWeakSelf(ServerSocket);
+      if (Settings->bEnableMetricsEndpoint) {
+        ServerSocket->SetMetricsProvider(
+            FMcpBridgeWebSocketMetricsProvider::CreateLambda(
+                [WeakSelf](const TMap<FString, FString> &RequestHeaders,
+                           FString &OutBody) -> int32 {
+                  if (TSharedPtr<FMcpConnectionManager> StrongSelf =
+                          WeakSelf.Pin()) {
+                    return StrongSelf->HandleMetricsRequest(RequestHeaders,
+                                                            OutBody);
+                  }
+                  return 503;
+                }));
+      }
 
       ServerSocket->OnConnected().AddLambda(
           [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock) {
@@ -334,6 +445,8 @@ void FMcpConnectionManager::AttemptConnection() {
               StrongSelf->HandleMessage(Sock, Message);
             }
           });
+      ClientSocket->SetIoThreadMessageFilter(
+          MakeIoThreadMessageFilter(AsShared()));
 
       ActiveSockets.Add(ClientSocket);
       ClientSocket->Connect();
@@ -359,6 +472,7 @@ void FMcpConnectionManager::ForceReconnect(const FString &Reason,
   {
     FScopeLock Lock(&PendingRequestsMutex);
     PendingRequestsToSockets.Empty();
+    RequestPriorities.Empty();
   }
 
   bBridgeAvailable = false;
@@ -391,7 +505,10 @@ void FMcpConnectionManager::HandleClientConnected(
     TSharedPtr<FMcpBridgeWebSocket> ClientSocket) {
   if (!ClientSocket.IsValid())
     return;
-  AuthenticatedSockets.Remove(ClientSocket.Get());
+  {
+    FScopeLock Lock(&AuthenticatedSocketsMutex);
+    AuthenticatedSockets.Remove(ClientSocket.Get());
+  }
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
          TEXT("Client socket connected (port=%d)"), ClientSocket->GetPort());
 
@@ -407,6 +524,7 @@ void FMcpConnectionManager::HandleClientConnected(
         if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin())
           StrongSelf->HandleMessage(Sock, Msg);
       });
+  ClientSocket->SetIoThreadMessageFilter(MakeIoThreadMessageFilter(AsShared()));
 
   ClientSocket->OnClosed().AddLambda(
       [WeakSelf](TSharedPtr<FMcpBridgeWebSocket> Sock, int32 Code,
@@ -446,15 +564,20 @@ void FMcpConnectionManager::HandleConnectionError(
          TEXT("Automation bridge socket error (port=%d): %s"), Port, *Error);
 
   if (Socket.IsValid()) {
-    AuthenticatedSockets.Remove(Socket.Get());
+    {
+      FScopeLock Lock(&AuthenticatedSocketsMutex);
+      AuthenticatedSockets.Remove(Socket.Get());
+    }
     {
       FScopeLock Lock(&RateLimitMutex);
       SocketRateLimits.Remove(Socket.Get());
     }
+    ReleaseSocketInFlightRequests(Socket.Get());
     Socket->OnMessage().RemoveAll(this);
     Socket->OnClosed().RemoveAll(this);
     Socket->OnConnectionError().RemoveAll(this);
     Socket->OnHeartbeat().RemoveAll(this);
+    Socket->SetIoThreadMessageFilter(FMcpBridgeWebSocketMessageFilter());
     Socket->Close();
     ActiveSockets.Remove(Socket);
   }
@@ -483,12 +606,17 @@ void FMcpConnectionManager::HandleClosed(TSharedPtr<FMcpBridgeWebSocket> Socket,
          TEXT("Socket closed: port=%d code=%d reason=%s clean=%s"), Port,
          StatusCode, *Reason, bWasClean ? TEXT("true") : TEXT("false"));
   if (Socket.IsValid()) {
-    AuthenticatedSockets.Remove(Socket.Get());
+    {
+      FScopeLock Lock(&AuthenticatedSocketsMutex);
+      AuthenticatedSockets.Remove(Socket.Get());
+    }
     {
       FScopeLock Lock(&RateLimitMutex);
       SocketRateLimits.Remove(Socket.Get());
     }
+    ReleaseSocketInFlightRequests(Socket.Get());
     ActiveSockets.Remove(Socket);
+    OnSocketClosed.ExecuteIfBound(Socket);
   }
   if (ActiveSockets.Num() == 0 && bReconnectEnabled) {
     TimeUntilReconnect = AutoReconnectDelaySeconds;
@@ -515,24 +643,21 @@ void FMcpConnectionManager::HandleMessage(
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
            TEXT("Rate limit exceeded for incoming messages: %s"),
            *RateLimitReason);
-    TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-    Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-    Err->SetStringField(TEXT("error"), TEXT("RATE_LIMIT_EXCEEDED"));
-    Err->SetStringField(TEXT("message"), RateLimitReason);
-    FString Serialized;
-    const TSharedRef<TJsonWriter<>> Writer =
-        TJsonWriterFactory<>::Create(&Serialized);
-    FJsonSerializer::Serialize(Err, Writer);
-    if (Socket.IsValid() && Socket->IsConnected()) {
-      Socket->Send(Serialized);
-      Socket->Close(4008, TEXT("Rate limit exceeded"));
-    }
+    SendBridgeErrorAndClose(Socket, TEXT("RATE_LIMIT_EXCEEDED"),
+                            RateLimitReason, 4008,
+                            TEXT("Rate limit exceeded"));
     return;
   }
 
   TSharedPtr<FJsonObject> RootObj;
-  TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-  if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()) {
+  bool bParsed = false;
+  {
+    MCP_TRACE_SCOPE("McpBridge.Parse");
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+    bParsed =
+        FJsonSerializer::Deserialize(Reader, RootObj) && RootObj.IsValid();
+  }
+  if (!bParsed) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
            TEXT("Failed to parse incoming automation message JSON: %s"),
            *SanitizeForLogConnMgr(Message));
@@ -547,39 +672,41 @@ void FMcpConnectionManager::HandleMessage(
     return;
   }
 
-  if (Type.Equals(TEXT("automation_request"), ESearchCase::IgnoreCase)) {
+  // automation_batch frames carry their sub-requests at the top level and run
+  // as the "automation_batch" action, so every item shares one game-thread
+  // dispatch, one telemetry entry and one response frame.
+  const bool bIsBatch =
+      Type.Equals(TEXT("automation_batch"), ESearchCase::IgnoreCase);
+  if (bIsBatch ||
+      Type.Equals(TEXT("automation_request"), ESearchCase::IgnoreCase)) {
     if (!UpdateRateLimit(SocketPtr, false, true, RateLimitReason)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("Rate limit exceeded for automation requests: %s"),
              *RateLimitReason);
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("RATE_LIMIT_EXCEEDED"));
-      Err->SetStringField(TEXT("message"), RateLimitReason);
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
-        Socket->Close(4008, TEXT("Rate limit exceeded"));
-      }
+      SendBridgeErrorAndClose(Socket, TEXT("RATE_LIMIT_EXCEEDED"),
+                              RateLimitReason, 4008,
+                              TEXT("Rate limit exceeded"));
       return;
     }
 
     FString RequestId;
     FString Action;
     RootObj->TryGetStringField(TEXT("requestId"), RequestId);
-    RootObj->TryGetStringField(TEXT("action"), Action);
     TSharedPtr<FJsonObject> Payload = nullptr;
-    const TSharedPtr<FJsonValue> *PayloadVal =
-        RootObj->Values.Find(TEXT("payload"));
-    if (PayloadVal && (*PayloadVal)->Type == EJson::Object) {
-      Payload = (*PayloadVal)->AsObject();
-    } else if (PayloadVal) {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-             TEXT("automation_request payload must be a JSON object."));
-      return;
+    if (bIsBatch) {
+      Action = TEXT("automation_batch");
+      Payload = RootObj;
+    } else {
+      RootObj->TryGetStringField(TEXT("action"), Action);
+      const TSharedPtr<FJsonValue> *PayloadVal =
+          RootObj->Values.Find(TEXT("payload"));
+      if (PayloadVal && (*PayloadVal)->Type == EJson::Object) {
+        Payload = (*PayloadVal)->AsObject();
+      } else if (PayloadVal) {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+               TEXT("automation_request payload must be a JSON object."));
+        return;
+      }
     }
 
     if (RequestId.IsEmpty() || Action.IsEmpty()) {
@@ -595,58 +722,45 @@ void FMcpConnectionManager::HandleMessage(
       return;
     }
 
-    if (!SocketPtr || !AuthenticatedSockets.Contains(SocketPtr)) {
+    if (!IsSocketAuthenticated(SocketPtr)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("Automation request received before bridge_hello handshake."));
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("HANDSHAKE_REQUIRED"));
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
-        Socket->Close(4004, TEXT("Handshake required"));
-      }
+      SendBridgeErrorAndClose(Socket, TEXT("HANDSHAKE_REQUIRED"), FString(),
+                              4004, TEXT("Handshake required"));
       return;
     }
 
-    // Skip logging for console_command - Unreal already logs the command
-    const bool bSkipLogging = Action.Equals(TEXT("console_command"), ESearchCase::IgnoreCase);
-
-    // Log incoming request: action + filtered payload (exclude type/requestId)
-    if (!bSkipLogging) {
-      FString PayloadPreview;
-      if (Payload.IsValid()) {
-        TArray<FString> Parts;
-        for (auto& Pair : Payload->Values) {
-          if (Pair.Key != TEXT("type") && Pair.Key != TEXT("requestId")) {
-            FString Val;
-            if (Pair.Value->Type == EJson::String) {
-              Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(50));
-            } else if (Pair.Value->Type == EJson::Boolean) {
-              Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
-            } else if (Pair.Value->Type == EJson::Number) {
-              Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
-            } else {
-              Val = TEXT("...");
-            }
-            Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
-          }
-        }
-        PayloadPreview = Parts.Num() > 0 ? FString::Join(Parts, TEXT(" ")) : TEXT("{}");
-      }
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
-             TEXT("Request: %s %s"),
-             *Action,
-             *PayloadPreview.Left(200));
+    LogAutomationRequest(Action, Payload);
+
+    if (!BeginRequestTelemetry(SocketPtr, RequestId, Action)) {
+      RejectDuplicateRequest(Socket, RequestId, Action);
+      return;
+    }
+
+    const EInFlightAdmission Admission = AdmitInFlightRequest(
+        Socket, RequestId, Action, RootObj, Payload, false);
+    if (Admission == EInFlightAdmission::Rejected) {
+      SendAutomationResponse(
+          Socket, RequestId, false,
+          TEXT("Too many requests in flight on this connection."), nullptr,
+          TEXT("IN_FLIGHT_LIMIT_EXCEEDED"));
+      return;
     }
 
     // Map request to socket for response routing
+    EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
+    const bool bHasPriority = McpExtractRequestPriority(RootObj, Priority);
     {
       FScopeLock Lock(&PendingRequestsMutex);
       PendingRequestsToSockets.Add(RequestId, Socket);
+      if (bHasPriority) {
+        RequestPriorities.Add({SocketPtr, RequestId}, Priority);
+      }
+    }
+
+    // Parked requests are dispatched when the request they wait on completes.
+    if (Admission == EInFlightAdmission::Parked) {
+      return;
     }
 
     // Dispatch to subsystem via callback
@@ -664,26 +778,67 @@ void FMcpConnectionManager::HandleMessage(
       UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
              TEXT("Capability token mismatch."));
       if (SocketPtr) {
+        FScopeLock Lock(&AuthenticatedSocketsMutex);
         AuthenticatedSockets.Remove(SocketPtr);
       }
-      TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
-      Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
-      Err->SetStringField(TEXT("error"), TEXT("INVALID_CAPABILITY_TOKEN"));
-      FString Serialized;
-      const TSharedRef<TJsonWriter<>> Writer =
-          TJsonWriterFactory<>::Create(&Serialized);
-      FJsonSerializer::Serialize(Err, Writer);
-      if (Socket.IsValid() && Socket->IsConnected()) {
-        Socket->Send(Serialized);
-        Socket->Close(4005, TEXT("Invalid capability token"));
-      }
+      SendBridgeErrorAndClose(Socket, TEXT("INVALID_CAPABILITY_TOKEN"),
+                              FString(), 4005,
+                              TEXT("Invalid capability token"));
       return;
     }
 
     if (SocketPtr) {
+      FScopeLock Lock(&AuthenticatedSocketsMutex);
       AuthenticatedSockets.Add(SocketPtr);
     }
 
+    // Pipelining is opt-in: the client asks for a window and gets at most the
+    // configured one. Clients that do not ask keep one request at a time.
+    int32 RequestedInFlight = 0;
+    RootObj->TryGetNumberField(TEXT("maxInFlight"), RequestedInFlight);
+    const int32 GrantedInFlight =
+        FMath::Clamp(RequestedInFlight, 0, MaxInFlightRequestsPerConnection);
+    if (SocketPtr) {
+      FScopeLock Lock(&PipelineMutex);
+      if (GrantedInFlight > 0) {
+        PipelineWindows.FindOrAdd(SocketPtr).MaxInFlight = GrantedInFlight;
+      } else {
+        PipelineWindows.Remove(SocketPtr);
+      }
+    }
+
+    // Encoding is also opt-in: JSON text stays the default unless the client
+    // lists msgpack among its accepted encodings. Binary frames are always
+    // accepted inbound; this only selects how automation responses are sent.
+    bool bUseMessagePack = false;
+    const TArray<TSharedPtr<FJsonValue>> *Encodings = nullptr;
+    if (bAllowMessagePackEncoding &&
+        RootObj->TryGetArrayField(TEXT("encodings"), Encodings) && Encodings) {
+      for (const TSharedPtr<FJsonValue> &Encoding : *Encodings) {
+        FString Name;
+        if (Encoding.IsValid() && Encoding->TryGetString(Name) &&
+            Name.Equals(McpMessagePack::EncodingName(),
+                        ESearchCase::IgnoreCase)) {
+          bUseMessagePack = true;
+          break;
+        }
+      }
+    }
+    Socket->SetBinaryAutomationFrames(bUseMessagePack);
+
+    // Chunked responses are opt-in as well: the client names the chunk size
+    // it wants and gets it clamped to the configured range.
+    int32 RequestedChunkBytes = 0;
+    RootObj->TryGetNumberField(TEXT("responseChunkBytes"), RequestedChunkBytes);
+    const int32 GrantedChunkBytes =
+        RequestedChunkBytes > 0 && MaxResponseChunkBytes > 0
+            ? FMath::Clamp(RequestedChunkBytes,
+                           FMath::Min(McpMinResponseChunkBytes,
+                                      MaxResponseChunkBytes),
+                           MaxResponseChunkBytes)
+            : 0;
+    Socket->SetResponseChunkBytes(GrantedChunkBytes);
+
     TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
     Ack->SetStringField(TEXT("type"), TEXT("bridge_ack"));
     Ack->SetStringField(TEXT("message"), TEXT("Automation bridge ready"));
@@ -701,6 +856,7 @@ void FMcpConnectionManager::HandleMessage(
 
     TArray<TSharedPtr<FJsonValue>> SupportedOps;
     SupportedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_request")));
+    SupportedOps.Add(MakeShared<FJsonValueString>(TEXT("automation_batch")));
     Ack->SetArrayField(TEXT("supportedOpcodes"), SupportedOps);
 
     TArray<TSharedPtr<FJsonValue>> ExpectedOps;
@@ -710,10 +866,30 @@ void FMcpConnectionManager::HandleMessage(
     TArray<TSharedPtr<FJsonValue>> Caps;
     Caps.Add(MakeShared<FJsonValueString>(TEXT("console_commands")));
     Caps.Add(MakeShared<FJsonValueString>(TEXT("native_plugin")));
+    if (MaxInFlightRequestsPerConnection > 0)
+      Caps.Add(MakeShared<FJsonValueString>(TEXT("pipelining")));
+    if (GrantedInFlight > 0)
+      Caps.Add(MakeShared<FJsonValueString>(TEXT("out_of_order_responses")));
+    if (bAllowMessagePackEncoding)
+      Caps.Add(MakeShared<FJsonValueString>(McpMessagePack::EncodingName()));
+    if (MaxResponseChunkBytes > 0)
+      Caps.Add(MakeShared<FJsonValueString>(TEXT("response_chunks")));
     Ack->SetArrayField(TEXT("capabilities"), Caps);
+    Ack->SetStringField(TEXT("encoding"), bUseMessagePack
+                                              ? McpMessagePack::EncodingName()
+                                              : TEXT("json"));
 
     Ack->SetNumberField(TEXT("heartbeatIntervalMs"), 0);
 
+    Ack->SetNumberField(TEXT("maxInFlight"), GrantedInFlight);
+    Ack->SetNumberField(TEXT("responseChunkBytes"), GrantedChunkBytes);
+    if (GrantedInFlight > 0) {
+      TArray<TSharedPtr<FJsonValue>> KeyFields;
+      for (const TCHAR *Field : GMcpOrderingKeyFields)
+        KeyFields.Add(MakeShared<FJsonValueString>(Field));
+      Ack->SetArrayField(TEXT("orderingKeyFields"), KeyFields);
+    }
+
     FString Serialized;
     const TSharedRef<TJsonWriter<>> Writer =
         TJsonWriterFactory<>::Create(&Serialized);
@@ -722,6 +898,334 @@ void FMcpConnectionManager::HandleMessage(
   }
 }
 
+bool FMcpConnectionManager::TryHandleMessageOnIoThread(
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString &Message) {
+  if (!Socket.IsValid() || !OnConcurrentRequest.IsBound()) {
+    return false;
+  }
+  // Only automation requests can skip the game thread. Everything else,
+  // including malformed input that HandleMessage reports, takes the normal
+  // path without paying for a parse here.
+  if (!Message.Contains(TEXT("automation_request"))) {
+    return false;
+  }
+
+  TSharedPtr<FJsonObject> RootObj;
+  bool bParsed = false;
+  {
+    MCP_TRACE_SCOPE("McpBridge.Parse");
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+    bParsed =
+        FJsonSerializer::Deserialize(Reader, RootObj) && RootObj.IsValid();
+  }
+  if (!bParsed) {
+    return false;
+  }
+
+  FString Type;
+  FString RequestId;
+  FString Action;
+  RootObj->TryGetStringField(TEXT("type"), Type);
+  RootObj->TryGetStringField(TEXT("requestId"), RequestId);
+  RootObj->TryGetStringField(TEXT("action"), Action);
+  if (!Type.Equals(TEXT("automation_request"), ESearchCase::IgnoreCase) ||
+      RequestId.IsEmpty() || Action.IsEmpty() || RequestId.Len() > 128 ||
+      Action.Len() > 128) {
+    return false;
+  }
+
+  TSharedPtr<FJsonObject> Payload = nullptr;
+  const TSharedPtr<FJsonValue> *PayloadVal =
+      RootObj->Values.Find(TEXT("payload"));
+  if (PayloadVal && (*PayloadVal)->Type == EJson::Object) {
+    Payload = (*PayloadVal)->AsObject();
+  } else if (PayloadVal) {
+    return false;
+  }
+
+  // A request sent right behind bridge_hello stays queued after it on the
+  // game thread until the handshake has been processed there.
+  FMcpBridgeWebSocket *SocketPtr = Socket.Get();
+  if (!IsSocketAuthenticated(SocketPtr)) {
+    return false;
+  }
+
+  // From here on this thread owns the request, so it is counted exactly once.
+  TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
+  FString RateLimitReason;
+  if (!UpdateRateLimit(SocketPtr, true, true, RateLimitReason)) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Rate limit exceeded for automation requests: %s"),
+           *RateLimitReason);
+    AsyncTask(ENamedThreads::GameThread, [WeakSelf, Socket, RateLimitReason] {
+      if (TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin()) {
+        StrongSelf->SendBridgeErrorAndClose(Socket, TEXT("RATE_LIMIT_EXCEEDED"),
+                                            RateLimitReason, 4008,
+                                            TEXT("Rate limit exceeded"));
+      }
+    });
+    return true;
+  }
+
+  LogAutomationRequest(Action, Payload);
+
+  if (!BeginRequestTelemetry(SocketPtr, RequestId, Action)) {
+    RejectDuplicateRequest(Socket, RequestId, Action);
+    return true;
+  }
+
+  const EInFlightAdmission Admission =
+      AdmitInFlightRequest(Socket, RequestId, Action, RootObj, Payload, true);
+  if (Admission == EInFlightAdmission::Rejected) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        TEXT("Too many requests in flight on this connection."), nullptr,
+        TEXT("IN_FLIGHT_LIMIT_EXCEEDED"));
+    return true;
+  }
+
+  EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
+  const bool bHasPriority = McpExtractRequestPriority(RootObj, Priority);
+  {
+    FScopeLock Lock(&PendingRequestsMutex);
+    PendingRequestsToSockets.Add(RequestId, Socket);
+    if (bHasPriority) {
+      RequestPriorities.Add({SocketPtr, RequestId}, Priority);
+    }
+  }
+
+  if (Admission == EInFlightAdmission::Parked) {
+    return true;
+  }
+
+  if (Admission == EInFlightAdmission::Dispatch &&
+      OnConcurrentRequest.Execute(RequestId, Action, Payload, Socket)) {
+    return true;
+  }
+
+  // Not eligible for a worker lane, its lane is saturated, or it must stay
+  // behind earlier work on the same resource: hand the already-parsed request
+  // to the game thread as usual.
+  MarkInFlightRequestOrdered(SocketPtr, RequestId);
+  ForwardToGameThread(RequestId, Action, Payload, Socket);
+  return true;
+}
+
+FMcpConnectionManager::EInFlightAdmission
+FMcpConnectionManager::AdmitInFlightRequest(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, const FString &RequestId,
+    const FString &Action, const TSharedPtr<FJsonObject> &Root,
+    const TSharedPtr<FJsonObject> &Payload, bool bWantsWorkerLane) {
+  FMcpBridgeWebSocket *SocketPtr = Socket.Get();
+  FScopeLock Lock(&PipelineMutex);
+  FSocketPipelineWindow *Window = PipelineWindows.Find(SocketPtr);
+  if (!Window) {
+    return EInFlightAdmission::Dispatch;
+  }
+  if (Window->InFlight >= Window->MaxInFlight) {
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+           TEXT("Rejecting %s (%s): %d requests already in flight on this "
+                "connection."),
+           *Action, *RequestId, Window->InFlight);
+    return EInFlightAdmission::Rejected;
+  }
+
+  FInFlightAutomationRequest Entry;
+  Entry.Socket = SocketPtr;
+  Entry.OrderingKey = McpExtractOrderingKey(Root, Payload);
+
+  // A worker-lane request on the same resource could still be running ahead
+  // of anything queued on the game thread, so later work on that resource
+  // waits for it, as it does behind a request just released from parking. Any
+  // other same-resource request keeps this one off the worker lane, because
+  // the game thread already preserves arrival order.
+  bool bSharesResource = false;
+  FInFlightAutomationRequest *Blocker = nullptr;
+  if (!Entry.OrderingKey.IsEmpty()) {
+    for (TPair<FRequestKey, FInFlightAutomationRequest> &Pair :
+         InFlightRequests) {
+      if (Pair.Value.Socket == SocketPtr &&
+          Pair.Value.OrderingKey == Entry.OrderingKey) {
+        bSharesResource = true;
+        if (Pair.Value.bBlocksResource) {
+          Blocker = &Pair.Value;
+        }
+      }
+    }
+  }
+
+  ++Window->InFlight;
+  EInFlightAdmission Admission = EInFlightAdmission::Ordered;
+  if (Blocker) {
+    Blocker->Waiters.Add({RequestId, Action, Payload, Socket});
+    Admission = EInFlightAdmission::Parked;
+  } else if (bWantsWorkerLane && !bSharesResource) {
+    Entry.bBlocksResource = true;
+    Admission = EInFlightAdmission::Dispatch;
+  }
+  InFlightRequests.Add({SocketPtr, RequestId}, MoveTemp(Entry));
+  return Admission;
+}
+
+void FMcpConnectionManager::RejectDuplicateRequest(
+    const TSharedPtr<FMcpBridgeWebSocket> &Socket, const FString &RequestId,
+    const FString &Action) {
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+         TEXT("Rejecting %s (%s): a request with this id is already in "
+              "progress on this connection."),
+         *Action, *RequestId);
+  // The id belongs to the request already in progress, so this response
+  // must not settle its telemetry or free its window slot.
+  DeliverAutomationResponse(
+      Socket, RequestId, false,
+      TEXT("A request with this requestId is already in progress on this "
+           "connection."),
+      TEXT("DUPLICATE_REQUEST_ID"), nullptr, nullptr, false);
+}
+
+void FMcpConnectionManager::MarkInFlightRequestOrdered(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId) {
+  FScopeLock Lock(&PipelineMutex);
+  if (FInFlightAutomationRequest *Entry =
+          InFlightRequests.Find({Socket, RequestId})) {
+    Entry->bBlocksResource = false;
+  }
+}
+
+void FMcpConnectionManager::ReleaseInFlightRequest(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId) {
+  TArray<FParkedAutomationRequest> Released;
+  {
+    FScopeLock Lock(&PipelineMutex);
+    FInFlightAutomationRequest Entry;
+    if (!InFlightRequests.RemoveAndCopyValue({Socket, RequestId}, Entry)) {
+      return;
+    }
+    if (FSocketPipelineWindow *Window = PipelineWindows.Find(Entry.Socket)) {
+      Window->InFlight = FMath::Max(0, Window->InFlight - 1);
+    }
+    // Parked requests are released one at a time: the first takes over the
+    // rest and blocks the resource before the lock is dropped, so a
+    // same-resource request arriving before it reaches the game thread parks
+    // behind it instead of overtaking it.
+    while (Entry.Waiters.Num() > 0) {
+      FParkedAutomationRequest Next = MoveTemp(Entry.Waiters[0]);
+      Entry.Waiters.RemoveAt(0);
+      FInFlightAutomationRequest *NextEntry =
+          InFlightRequests.Find({Next.Socket.Get(), Next.RequestId});
+      Released.Add(MoveTemp(Next));
+      if (NextEntry) {
+        NextEntry->bBlocksResource = true;
+        NextEntry->Waiters = MoveTemp(Entry.Waiters);
+        break;
+      }
+    }
+  }
+  for (FParkedAutomationRequest &Waiter : Released) {
+    ForwardToGameThread(Waiter.RequestId, Waiter.Action, Waiter.Payload,
+                        Waiter.Socket);
+  }
+}
+
+void FMcpConnectionManager::ReleaseSocketInFlightRequests(
+    FMcpBridgeWebSocket *SocketPtr) {
+  TArray<FParkedAutomationRequest> Waiters;
+  {
+    FScopeLock Lock(&PipelineMutex);
+    PipelineWindows.Remove(SocketPtr);
+    for (auto It = InFlightRequests.CreateIterator(); It; ++It) {
+      if (It->Value.Socket == SocketPtr) {
+        Waiters.Append(MoveTemp(It->Value.Waiters));
+        It.RemoveCurrent();
+      }
+    }
+  }
+  // Requests that were accepted still run, exactly as queued requests on a
+  // legacy connection do; their responses take the usual fallback route.
+  for (FParkedAutomationRequest &Waiter : Waiters) {
+    ForwardToGameThread(Waiter.RequestId, Waiter.Action, Waiter.Payload,
+                        Waiter.Socket);
+  }
+}
+
+void FMcpConnectionManager::ForwardToGameThread(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+  TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
+  AsyncTask(ENamedThreads::GameThread,
+            [WeakSelf, RequestId, Action, Payload, Socket] {
+              TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin();
+              if (StrongSelf.IsValid() &&
+                  StrongSelf->OnMessageReceived.IsBound()) {
+                StrongSelf->OnMessageReceived.Execute(RequestId, Action,
+                                                      Payload, Socket);
+              }
+            });
+}
+
+bool FMcpConnectionManager::IsSocketAuthenticated(
+    FMcpBridgeWebSocket *SocketPtr) const {
+  if (!SocketPtr) {
+    return false;
+  }
+  FScopeLock Lock(&AuthenticatedSocketsMutex);
+  return AuthenticatedSockets.Contains(SocketPtr);
+}
+
+void FMcpConnectionManager::SendBridgeErrorAndClose(
+    TSharedPtr<FMcpBridgeWebSocket> Socket, const FString &ErrorCode,
+    const FString &Message, int32 CloseCode, const FString &CloseReason) {
+  TSharedRef<FJsonObject> Err = MakeShared<FJsonObject>();
+  Err->SetStringField(TEXT("type"), TEXT("bridge_error"));
+  Err->SetStringField(TEXT("error"), ErrorCode);
+  if (!Message.IsEmpty()) {
+    Err->SetStringField(TEXT("message"), Message);
+  }
+  FString Serialized;
+  const TSharedRef<TJsonWriter<>> Writer =
+      TJsonWriterFactory<>::Create(&Serialized);
+  FJsonSerializer::Serialize(Err, Writer);
+  if (Socket.IsValid() && Socket->IsConnected()) {
+    Socket->Send(Serialized);
+    Socket->Close(CloseCode, CloseReason);
+  }
+}
+
+void FMcpConnectionManager::LogAutomationRequest(
+    const FString &Action, const TSharedPtr<FJsonObject> &Payload) const {
+  // Skip logging for console_command - Unreal already logs the command
+  const bool bSkipLogging = Action.Equals(TEXT("console_command"), ESearchCase::IgnoreCase);
+
+  // Log incoming request: action + filtered payload (exclude type/requestId)
+  if (!bSkipLogging) {
+    FString PayloadPreview;
+    if (Payload.IsValid()) {
+      TArray<FString> Parts;
+      for (auto& Pair : Payload->Values) {
+        if (Pair.Key != TEXT("type") && Pair.Key != TEXT("requestId")) {
+          FString Val;
+          if (Pair.Value->Type == EJson::String) {
+            Val = FString::Printf(TEXT("\"%s\""), *Pair.Value->AsString().Left(50));
+          } else if (Pair.Value->Type == EJson::Boolean) {
+            Val = Pair.Value->AsBool() ? TEXT("true") : TEXT("false");
+          } else if (Pair.Value->Type == EJson::Number) {
+            Val = FString::Printf(TEXT("%g"), Pair.Value->AsNumber());
+          } else {
+            Val = TEXT("...");
+          }
+          Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
+        }
+      }
+      PayloadPreview = Parts.Num() > 0 ? FString::Join(Parts, TEXT(" ")) : TEXT("{}");
+    }
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
+           TEXT("Request: %s %s"),
+           *Action,
+           *PayloadPreview.Left(200));
+  }
+}
+
 bool FMcpConnectionManager::UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr,
                                            bool bIncrementMessage,
                                            bool bIncrementAutomation,
@@ -756,6 +1260,7 @@ bool FMcpConnectionManager::UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr,
   }
 
   if (MaxMessagesPerMinute > 0 && State.MessageCount >= MaxMessagesPerMinute) {
+    ++NumRateLimitedMessages;
     OutReason = FString::Printf(TEXT("message rate %d/%d per minute"),
                                 State.MessageCount, MaxMessagesPerMinute);
     return false;
@@ -763,6 +1268,7 @@ bool FMcpConnectionManager::UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr,
 
   if (bIncrementAutomation && MaxAutomationRequestsPerMinute > 0 &&
       State.AutomationRequestCount >= MaxAutomationRequestsPerMinute) {
+    ++NumRateLimitedAutomationRequests;
     OutReason = FString::Printf(TEXT("automation request rate %d/%d per minute"),
                                 State.AutomationRequestCount,
                                 MaxAutomationRequestsPerMinute);
@@ -787,6 +1293,20 @@ bool FMcpConnectionManager::SendRawMessage(const FString &Message) {
   return bSent;
 }
 
+bool FMcpConnectionManager::SendBestEffortMessage(const FString &Message) {
+  if (Message.IsEmpty())
+    return false;
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+    if (!Sock.IsValid() || !Sock->IsConnected())
+      continue;
+    if (Sock->IsSendQueueAboveHighWater())
+      continue;
+    if (Sock->Send(Message))
+      return true;
+  }
+  return false;
+}
+
 void FMcpConnectionManager::SendControlMessage(
     const TSharedPtr<FJsonObject> &Message) {
   if (!Message.IsValid())
@@ -798,30 +1318,155 @@ void FMcpConnectionManager::SendControlMessage(
   SendRawMessage(Serialized);
 }
 
+// Writes the automation_response envelope up to (not including) the result
+// field, leaving the top-level object open.
+static void WriteAutomationResponseEnvelope(FMcpJsonStreamWriter &Writer,
+                                            const FString &RequestId,
+                                            bool bSuccess,
+                                            const FString &Message,
+                                            const FString &ErrorCode) {
+  Writer.BeginObject();
+  Writer.WriteString(TEXT("type"), TEXT("automation_response"));
+  Writer.WriteString(TEXT("requestId"), RequestId);
+  Writer.WriteBool(TEXT("success"), bSuccess);
+  if (!Message.IsEmpty())
+    Writer.WriteString(TEXT("message"), Message);
+  // Always include error field as empty string when no error (required by JSON schema: error: { type: 'string' })
+  Writer.WriteString(TEXT("error"), ErrorCode);
+}
+
 void FMcpConnectionManager::SendAutomationResponse(
     TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
     bool bSuccess, const FString &Message,
     const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
-  TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
-  Response->SetStringField(TEXT("type"), TEXT("automation_response"));
-  Response->SetStringField(TEXT("requestId"), RequestId);
-  Response->SetBoolField(TEXT("success"), bSuccess);
-  if (!Message.IsEmpty())
-    Response->SetStringField(TEXT("message"), Message);
-  // Always include error field as empty string when no error (required by JSON schema: error: { type: 'string' })
-  Response->SetStringField(TEXT("error"), ErrorCode.IsEmpty() ? TEXT("") : ErrorCode);
-  if (Result.IsValid())
-    Response->SetObjectField(TEXT("result"), Result.ToSharedRef());
+  MarkRequestResponseStart(TargetSocket.Get(), RequestId);
+  DeliverAutomationResponse(TargetSocket, RequestId, bSuccess, Message,
+                            ErrorCode, Result, nullptr);
+}
 
-  FString Serialized;
-  const TSharedRef<TJsonWriter<>> Writer =
-      TJsonWriterFactory<>::Create(&Serialized);
-  FJsonSerializer::Serialize(Response, Writer);
+void FMcpConnectionManager::SendAutomationResponseStreamed(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    bool bSuccess, const FString &Message, const FString &ErrorCode,
+    TFunctionRef<void(FMcpJsonStreamWriter &)> WriteResult) {
+  MarkRequestResponseStart(TargetSocket.Get(), RequestId);
+  // Arrays written through FMcpStreamedArray go out ahead of the response as
+  // response_chunk frames when the socket negotiated chunking. MessagePack
+  // sockets still get one whole response, written as MessagePack directly.
+  const bool bMessagePack =
+      TargetSocket.IsValid() && TargetSocket->UsesBinaryAutomationFrames();
+  TUniquePtr<FMcpResponseChunkSink> ChunkSink;
+  if (TargetSocket.IsValid() && TargetSocket->IsConnected() && !bMessagePack &&
+      TargetSocket->GetResponseChunkBytes() > 0) {
+    ChunkSink = MakeUnique<FMcpResponseChunkSink>(
+        TargetSocket, RequestId, TargetSocket->GetResponseChunkBytes());
+  }
+
+  FMcpJsonStreamWriter Writer(bMessagePack ? EMcpStreamFormat::MessagePack
+                                           : EMcpStreamFormat::Json);
+  Writer.SetChunkSink(ChunkSink.Get());
+  {
+    MCP_TRACE_SCOPE("McpBridge.Serialize");
+    WriteAutomationResponseEnvelope(Writer, RequestId, bSuccess, Message,
+                                    ErrorCode);
+    Writer.BeginObject(TEXT("result"));
+    WriteResult(Writer);
+    Writer.EndObject();
+  }
+  Writer.SetChunkSink(nullptr);
+
+  if (ChunkSink.IsValid() && ChunkSink->HasFailed()) {
+    // Some items never reached the client; a response claiming success
+    // would hand it a truncated result.
+    DeliverAutomationResponse(TargetSocket, RequestId, false,
+                              ChunkSink->GetFailureMessage(),
+                              TEXT("RESPONSE_STREAM_INTERRUPTED"), nullptr,
+                              nullptr);
+    return;
+  }
+  if (ChunkSink.IsValid() && ChunkSink->GetNumChunksSent() > 0) {
+    // Tells the client how many response_chunk frames to merge into result.
+    Writer.WriteInteger(TEXT("chunks"), ChunkSink->GetNumChunksSent());
+  }
+  Writer.EndObject();
+  DeliverAutomationResponse(TargetSocket, RequestId, bSuccess, Message,
+                            ErrorCode, nullptr, &Writer);
+}
+
+void FMcpConnectionManager::DeliverAutomationResponse(
+    TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+    bool bSuccess, const FString &Message, const FString &ErrorCode,
+    TSharedPtr<FJsonObject> Result, FMcpJsonStreamWriter *StreamedText,
+    bool bTrackedRequest) {
+  // Each encoding is produced at most once, and only if some socket we try
+  // actually uses it. JSON text is written as UTF-8 straight into a pooled
+  // frame buffer; the DOM is only rebuilt from a streamed response when a
+  // socket that uses the other encoding or the fallback path needs it.
+  auto GetResult = [&]() -> const TSharedPtr<FJsonObject> & {
+    if (!Result.IsValid() && StreamedText) {
+      if (const TSharedPtr<FJsonObject> Parsed = StreamedText->ParsePayload()) {
+        const TSharedPtr<FJsonObject> *ResultObject = nullptr;
+        if (Parsed->TryGetObjectField(TEXT("result"), ResultObject)) {
+          Result = *ResultObject;
+        }
+      }
+    }
+    return Result;
+  };
+  TUniquePtr<FMcpJsonStreamWriter> OwnedText;
+  auto GetText = [&]() -> FMcpJsonStreamWriter & {
+    if (StreamedText && !StreamedText->IsMessagePack()) {
+      return *StreamedText;
+    }
+    if (!OwnedText.IsValid()) {
+      MCP_TRACE_SCOPE("McpBridge.Serialize");
+      OwnedText = MakeUnique<FMcpJsonStreamWriter>();
+      WriteAutomationResponseEnvelope(*OwnedText, RequestId, bSuccess, Message,
+                                      ErrorCode);
+      if (GetResult().IsValid()) {
+        OwnedText->WriteKey(TEXT("result"));
+        OwnedText->WriteJsonObject(*GetResult());
+      }
+      OwnedText->EndObject();
+    }
+    return *OwnedText;
+  };
+  TArray<uint8> Packed;
+  auto SendTo = [&](const TSharedPtr<FMcpBridgeWebSocket> &Sock) -> bool {
+    if (Sock->UsesBinaryAutomationFrames()) {
+      if (StreamedText && StreamedText->IsMessagePack()) {
+        MCP_TRACE_SCOPE("McpBridge.Send");
+        return Sock->SendBinary(StreamedText->GetPayloadData(),
+                                StreamedText->GetPayloadSize());
+      }
+      if (Packed.Num() == 0) {
+        MCP_TRACE_SCOPE("McpBridge.Serialize");
+        TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+        Response->SetStringField(TEXT("type"), TEXT("automation_response"));
+        Response->SetStringField(TEXT("requestId"), RequestId);
+        Response->SetBoolField(TEXT("success"), bSuccess);
+        if (!Message.IsEmpty())
+          Response->SetStringField(TEXT("message"), Message);
+        Response->SetStringField(TEXT("error"), ErrorCode);
+        if (GetResult().IsValid())
+          Response->SetObjectField(TEXT("result"), GetResult().ToSharedRef());
+        McpMessagePack::Encode(Response, Packed);
+      }
+      MCP_TRACE_SCOPE("McpBridge.Send");
+      return Sock->SendBinary(Packed.GetData(), Packed.Num());
+    }
+    FMcpJsonStreamWriter &Text = GetText();
+    MCP_TRACE_SCOPE("McpBridge.Send");
+    return Sock->SendTextWithReservedHeader(
+        Text.GetFrameBuffer(), FMcpJsonStreamWriter::FrameHeaderReserve);
+  };
 
   // Get action from telemetry for better logging context
   FString ActionName = TEXT("unknown");
-  if (FAutomationRequestTelemetry* Entry = ActiveRequestTelemetry.Find(RequestId)) {
-    ActionName = Entry->Action;
+  {
+    FScopeLock Lock(&TelemetryMutex);
+    if (FAutomationRequestTelemetry* Entry = ActiveRequestTelemetry.Find({TargetSocket.Get(), RequestId})) {
+      ActionName = Entry->Action;
+    }
   }
 
   // Skip logging for console_command - Unreal already logs the command
@@ -850,6 +1495,9 @@ void FMcpConnectionManager::SendAutomationResponse(
         Parts.Add(FString::Printf(TEXT("%s=%s"), *Pair.Key, *Val));
       }
       ResultPreview = FString::Printf(TEXT(" (%s)"), *FString::Join(Parts, TEXT(" ")));
+    } else if (StreamedText) {
+      ResultPreview = FString::Printf(TEXT(" (streamed %d bytes)"),
+                                      StreamedText->GetPayloadSize());
     }
     UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
            TEXT("Response: %s %s%s%s"),
@@ -859,12 +1507,6 @@ void FMcpConnectionManager::SendAutomationResponse(
            *ResultPreview);
   }
 
-  RecordAutomationTelemetry(RequestId, bSuccess, Message, ErrorCode);
-
-  bool bSent = false;
-  TArray<FString> AttemptDetails;
-  const int MaxAttempts = 3;
-
   TSharedPtr<FMcpBridgeWebSocket> MappedSocket;
   {
     FScopeLock Lock(&PendingRequestsMutex);
@@ -874,64 +1516,104 @@ void FMcpConnectionManager::SendAutomationResponse(
     }
   }
 
-  for (int Attempt = 1; Attempt <= MaxAttempts && !bSent; ++Attempt) {
-    if (TargetSocket.IsValid() && TargetSocket->IsConnected()) {
-      if (TargetSocket->Send(Serialized)) {
-        bSent = true;
-        break;
+  // Sends only queue the frame, so a failure means that socket is closed or
+  // has overflowed its queue; retrying the same socket cannot help.
+  bool bSent = false;
+  if (TargetSocket.IsValid() && TargetSocket->IsConnected()) {
+    bSent = SendTo(TargetSocket);
+  }
+  if (!bSent && MappedSocket.IsValid() && MappedSocket != TargetSocket &&
+      MappedSocket->IsConnected()) {
+    bSent = SendTo(MappedSocket);
+  }
+  // ActiveSockets is only touched on the game thread.
+  if (!bSent && IsInGameThread()) {
+    bSent = SendToOtherActiveSocket(GetText().ToString(), TargetSocket,
+                                    MappedSocket);
+  }
+  McpTraceResponseSent(RequestId, bSuccess, bSent);
+  if (bTrackedRequest) {
+    // Recorded once the frame is queued so the send phase covers
+    // serialization.
+    RecordAutomationTelemetry(TargetSocket.Get(), RequestId, bSuccess,
+                              Message, ErrorCode);
+    {
+      FScopeLock Lock(&PendingRequestsMutex);
+      // Another connection may have sent the same id since.
+      const TSharedPtr<FMcpBridgeWebSocket> *Mapped =
+          PendingRequestsToSockets.Find(RequestId);
+      if (Mapped && *Mapped == TargetSocket) {
+        PendingRequestsToSockets.Remove(RequestId);
       }
+      RequestPriorities.Remove({TargetSocket.Get(), RequestId});
     }
+    ReleaseInFlightRequest(TargetSocket.Get(), RequestId);
+  }
 
-    if (!bSent && MappedSocket.IsValid() && MappedSocket->IsConnected()) {
-      if (MappedSocket->Send(Serialized)) {
-        bSent = true;
-        break;
-      }
-    }
+  if (bSent) {
+    return;
+  }
 
-    if (!bSent) {
-      for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
-        if (!Sock.IsValid() || !Sock->IsConnected())
-          continue;
-        if (Sock == TargetSocket)
-          continue;
-        if (MappedSocket == Sock)
-          continue;
-        if (Sock->Send(Serialized)) {
-          bSent = true;
-          break;
-        }
-      }
-    }
+  if (!IsInGameThread()) {
+    // A worker-lane response whose socket went away: finish the fallback
+    // delivery on the game thread where the socket list lives.
+    TWeakPtr<FMcpConnectionManager> WeakSelf = AsShared();
+    AsyncTask(ENamedThreads::GameThread,
+              [WeakSelf, Serialized = GetText().ToString(), RequestId,
+               bSuccess, Message, Result = GetResult(), ErrorCode] {
+                TSharedPtr<FMcpConnectionManager> StrongSelf = WeakSelf.Pin();
+                if (StrongSelf.IsValid() &&
+                    !StrongSelf->SendToOtherActiveSocket(Serialized, nullptr,
+                                                         nullptr)) {
+                  StrongSelf->SendResponseFallbackEvent(
+                      RequestId, bSuccess, Message, Result, ErrorCode);
+                }
+              });
+    return;
   }
 
-  if (!bSent) {
-    UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-           TEXT("Failed to deliver automation_response for RequestId=%s"),
-           *RequestId);
+  SendResponseFallbackEvent(RequestId, bSuccess, Message, GetResult(),
+                            ErrorCode);
+}
 
-    TSharedPtr<FJsonObject> FallbackEvent = MakeShared<FJsonObject>();
-    FallbackEvent->SetStringField(TEXT("type"), TEXT("automation_event"));
-    FallbackEvent->SetStringField(TEXT("event"), TEXT("response_fallback"));
-    FallbackEvent->SetStringField(TEXT("requestId"), RequestId);
+bool FMcpConnectionManager::SendToOtherActiveSocket(
+    const FString &Serialized, const TSharedPtr<FMcpBridgeWebSocket> &SkipA,
+    const TSharedPtr<FMcpBridgeWebSocket> &SkipB) {
+  for (const TSharedPtr<FMcpBridgeWebSocket> &Sock : ActiveSockets) {
+    if (!Sock.IsValid() || !Sock->IsConnected())
+      continue;
+    if (Sock == SkipA || Sock == SkipB)
+      continue;
+    if (Sock->Send(Serialized)) {
+      return true;
+    }
+  }
+  return false;
+}
 
-    TSharedPtr<FJsonObject> EventResult = MakeShared<FJsonObject>();
-    EventResult->SetBoolField(TEXT("success"), bSuccess);
-    if (!Message.IsEmpty())
-      EventResult->SetStringField(TEXT("message"), Message);
-    if (!ErrorCode.IsEmpty())
-      EventResult->SetStringField(TEXT("error"), ErrorCode);
-    if (Result.IsValid())
-      EventResult->SetObjectField(TEXT("payload"), Result.ToSharedRef());
-    FallbackEvent->SetObjectField(TEXT("result"), EventResult);
+void FMcpConnectionManager::SendResponseFallbackEvent(
+    const FString &RequestId, bool bSuccess, const FString &Message,
+    const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
+  UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+         TEXT("Failed to deliver automation_response for RequestId=%s"),
+         *RequestId);
 
-    SendControlMessage(FallbackEvent);
-  }
+  TSharedPtr<FJsonObject> FallbackEvent = MakeShared<FJsonObject>();
+  FallbackEvent->SetStringField(TEXT("type"), TEXT("automation_event"));
+  FallbackEvent->SetStringField(TEXT("event"), TEXT("response_fallback"));
+  FallbackEvent->SetStringField(TEXT("requestId"), RequestId);
 
-  {
-    FScopeLock Lock(&PendingRequestsMutex);
-    PendingRequestsToSockets.Remove(RequestId);
-  }
+  TSharedPtr<FJsonObject> EventResult = MakeShared<FJsonObject>();
+  EventResult->SetBoolField(TEXT("success"), bSuccess);
+  if (!Message.IsEmpty())
+    EventResult->SetStringField(TEXT("message"), Message);
+  if (!ErrorCode.IsEmpty())
+    EventResult->SetStringField(TEXT("error"), ErrorCode);
+  if (Result.IsValid())
+    EventResult->SetObjectField(TEXT("payload"), Result.ToSharedRef());
+  FallbackEvent->SetObjectField(TEXT("result"), EventResult);
+
+  SendControlMessage(FallbackEvent);
 }
 
 void FMcpConnectionManager::SendProgressUpdate(
@@ -972,6 +1654,15 @@ void FMcpConnectionManager::SendProgressUpdate(
     }
   }
   
+  if (TargetSocket.IsValid() && TargetSocket->IsSendQueueAboveHighWater()) {
+    // The client is behind on reading; a newer update will follow.
+    UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
+           TEXT("Skipped progress update for RequestId=%s (%lld bytes "
+                "queued)"),
+           *RequestId, TargetSocket->GetQueuedSendBytes());
+    return;
+  }
+
   if (TargetSocket.IsValid() && TargetSocket->IsConnected()) {
     if (!TargetSocket->Send(Serialized)) {
       UE_LOG(LogMcpAutomationBridgeSubsystem, Verbose,
@@ -987,22 +1678,41 @@ void FMcpConnectionManager::SendProgressUpdate(
 }
 
 void FMcpConnectionManager::RecordAutomationTelemetry(
-    const FString &RequestId, bool bSuccess, const FString &Message,
-    const FString &ErrorCode) {
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId,
+    bool bSuccess, const FString &Message, const FString &ErrorCode) {
   const double NowSeconds = FPlatformTime::Seconds();
 
+  FScopeLock Lock(&TelemetryMutex);
   FAutomationRequestTelemetry Entry;
-  if (!ActiveRequestTelemetry.RemoveAndCopyValue(RequestId, Entry)) {
+  if (!ActiveRequestTelemetry.RemoveAndCopyValue({Socket, RequestId},
+                                                 Entry)) {
     return;
   }
 
-  const FString ActionKey =
-      Entry.Action.IsEmpty() ? TEXT("unknown") : Entry.Action;
+  FString ActionKey = Entry.Action.IsEmpty() ? TEXT("unknown") : Entry.Action;
+  if (AutomationActionTelemetry.Num() >= McpMaxTelemetryActions &&
+      !AutomationActionTelemetry.Contains(ActionKey)) {
+    ActionKey = TEXT("other");
+  }
   FAutomationActionStats &Stats =
       AutomationActionTelemetry.FindOrAdd(ActionKey);
 
-  const double DurationSeconds =
-      FMath::Max(0.0, NowSeconds - Entry.StartTimeSeconds);
+  // Stamps a request never reached (answered before dispatch, or a handler
+  // that replied without the dispatcher) collapse onto the next one, so the
+  // phases always add up to the total.
+  const double DispatchSeconds =
+      Entry.StartTimeSeconds > 0.0 ? Entry.StartTimeSeconds : NowSeconds;
+  const double ReceivedSeconds =
+      Entry.ReceivedSeconds > 0.0 ? Entry.ReceivedSeconds : DispatchSeconds;
+  const double ResponseSeconds =
+      Entry.ResponseStartSeconds > 0.0 ? Entry.ResponseStartSeconds
+                                       : NowSeconds;
+  const double HandlerSeconds =
+      Entry.HandlerStartSeconds > 0.0 ? Entry.HandlerStartSeconds
+                                      : FMath::Min(DispatchSeconds,
+                                                   ResponseSeconds);
+
+  const double DurationSeconds = FMath::Max(0.0, NowSeconds - DispatchSeconds);
   if (bSuccess) {
     ++Stats.SuccessCount;
     Stats.TotalSuccessDurationSeconds += DurationSeconds;
@@ -1013,6 +1723,173 @@ void FMcpConnectionManager::RecordAutomationTelemetry(
 
   Stats.LastDurationSeconds = DurationSeconds;
   Stats.LastUpdatedSeconds = NowSeconds;
+
+  Stats.Total.Record(NowSeconds - ReceivedSeconds);
+  Stats.QueueWait.Record(DispatchSeconds - ReceivedSeconds);
+  Stats.Dispatch.Record(HandlerSeconds - DispatchSeconds);
+  Stats.Handler.Record(ResponseSeconds - HandlerSeconds);
+  Stats.Send.Record(NowSeconds - ResponseSeconds);
+}
+
+TSharedRef<FJsonObject> FMcpConnectionManager::GetAutomationMetrics(
+    const TSet<FString> &ActionFilter) const {
+  TArray<TSharedPtr<FJsonValue>> Actions;
+  int32 RequestsInProgress = 0;
+  {
+    FScopeLock Lock(&TelemetryMutex);
+    RequestsInProgress = ActiveRequestTelemetry.Num();
+    for (const TPair<FString, FAutomationActionStats> &Pair :
+         AutomationActionTelemetry) {
+      if (ActionFilter.Num() > 0 && !ActionFilter.Contains(Pair.Key)) {
+        continue;
+      }
+      const FAutomationActionStats &Stats = Pair.Value;
+      TSharedRef<FJsonObject> Latency = MakeShared<FJsonObject>();
+      Latency->SetObjectField(TEXT("total"), Stats.Total.ToJson());
+      Latency->SetObjectField(TEXT("queueWait"), Stats.QueueWait.ToJson());
+      Latency->SetObjectField(TEXT("dispatch"), Stats.Dispatch.ToJson());
+      Latency->SetObjectField(TEXT("handler"), Stats.Handler.ToJson());
+      Latency->SetObjectField(TEXT("send"), Stats.Send.ToJson());
+
+      TSharedRef<FJsonObject> Action = MakeShared<FJsonObject>();
+      Action->SetStringField(TEXT("action"), Pair.Key);
+      Action->SetNumberField(TEXT("success"), Stats.SuccessCount);
+      Action->SetNumberField(TEXT("failure"), Stats.FailureCount);
+      Action->SetObjectField(TEXT("latency"), Latency);
+      Actions.Add(MakeShared<FJsonValueObject>(Action));
+    }
+  }
+  Actions.Sort([](const TSharedPtr<FJsonValue> &A,
+                  const TSharedPtr<FJsonValue> &B) {
+    return A->AsObject()->GetStringField(TEXT("action")) <
+           B->AsObject()->GetStringField(TEXT("action"));
+  });
+
+  TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+  Metrics->SetNumberField(TEXT("requestsInProgress"), RequestsInProgress);
+  Metrics->SetArrayField(TEXT("actions"), Actions);
+  return Metrics;
+}
+
+int32 FMcpConnectionManager::HandleMetricsRequest(
+    const TMap<FString, FString> &Headers, FString &OutBody) const {
+  if (bRequireCapabilityToken) {
+    // Prometheus sends credentials as "Authorization: Bearer <token>".
+    FString Token;
+    if (const FString *Authorization = Headers.Find(TEXT("authorization"))) {
+      if (Authorization->StartsWith(TEXT("Bearer "))) {
+        Token = Authorization->Mid(7).TrimStartAndEnd();
+      }
+    } else if (const FString *Header =
+                   Headers.Find(TEXT("x-mcp-capability-token"))) {
+      Token = *Header;
+    }
+    if (Token.IsEmpty() || Token != CapabilityToken) {
+      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+             TEXT("Rejected metrics request without a valid capability "
+                  "token."));
+      return 401;
+    }
+  }
+  OutBody = BuildOpenMetricsText();
+  return 200;
+}
+
+FString FMcpConnectionManager::BuildOpenMetricsText() const {
+  FMcpOpenMetricsWriter Writer;
+  {
+    FScopeLock Lock(&TelemetryMutex);
+    TArray<FString> Actions;
+    AutomationActionTelemetry.GetKeys(Actions);
+    Actions.Sort();
+
+    Writer.BeginFamily(TEXT("mcp_bridge_requests"), TEXT("counter"),
+                       TEXT("Automation requests answered, by action and "
+                            "outcome."));
+    for (const FString &Action : Actions) {
+      const FAutomationActionStats &Stats =
+          AutomationActionTelemetry.FindChecked(Action);
+      const FMcpMetricLabel Success[] = {{TEXT("action"), Action},
+                                         {TEXT("outcome"), TEXT("success")}};
+      const FMcpMetricLabel Failure[] = {{TEXT("action"), Action},
+                                         {TEXT("outcome"), TEXT("failure")}};
+      Writer.WriteSample(TEXT("mcp_bridge_requests_total"), Stats.SuccessCount,
+                         Success);
+      Writer.WriteSample(TEXT("mcp_bridge_requests_total"), Stats.FailureCount,
+                         Failure);
+    }
+
+    Writer.BeginFamily(TEXT("mcp_bridge_request_duration_seconds"),
+                       TEXT("histogram"),
+                       TEXT("Automation request latency by action and phase: "
+                            "total, queue_wait, dispatch, handler, send."),
+                       TEXT("seconds"));
+    for (const FString &Action : Actions) {
+      const FAutomationActionStats &Stats =
+          AutomationActionTelemetry.FindChecked(Action);
+      const TPair<const TCHAR *, const FMcpLatencyHistogram *> Phases[] = {
+          {TEXT("total"), &Stats.Total},
+          {TEXT("queue_wait"), &Stats.QueueWait},
+          {TEXT("dispatch"), &Stats.Dispatch},
+          {TEXT("handler"), &Stats.Handler},
+          {TEXT("send"), &Stats.Send}};
+      for (const TPair<const TCHAR *, const FMcpLatencyHistogram *> &Phase :
+           Phases) {
+        if (Phase.Value->GetCount() == 0) {
+          continue;
+        }
+        const FMcpMetricLabel Labels[] = {{TEXT("action"), Action},
+                                          {TEXT("phase"), Phase.Key}};
+        Writer.WriteHistogram(TEXT("mcp_bridge_request_duration_seconds"),
+                              *Phase.Value, Labels);
+      }
+    }
+
+    Writer.BeginFamily(TEXT("mcp_bridge_requests_in_progress"), TEXT("gauge"),
+                       TEXT("Automation requests received and not yet "
+                            "answered."));
+    Writer.WriteSample(TEXT("mcp_bridge_requests_in_progress"),
+                       ActiveRequestTelemetry.Num());
+  }
+
+  Writer.BeginFamily(TEXT("mcp_bridge_connections"), TEXT("gauge"),
+                     TEXT("Open WebSocket connections."));
+  Writer.WriteSample(TEXT("mcp_bridge_connections"),
+                     FMcpBridgeWebSocket::GetOpenConnectionCount());
+  {
+    FScopeLock Lock(&AuthenticatedSocketsMutex);
+    Writer.BeginFamily(TEXT("mcp_bridge_authenticated_connections"),
+                       TEXT("gauge"),
+                       TEXT("Connections that completed bridge_hello."));
+    Writer.WriteSample(TEXT("mcp_bridge_authenticated_connections"),
+                       AuthenticatedSockets.Num());
+  }
+  {
+    FScopeLock Lock(&RateLimitMutex);
+    Writer.BeginFamily(TEXT("mcp_bridge_rate_limit_rejections"),
+                       TEXT("counter"),
+                       TEXT("Messages and automation requests refused by the "
+                            "per-connection rate limits."));
+    const FMcpMetricLabel Messages[] = {{TEXT("limit"), TEXT("messages")}};
+    const FMcpMetricLabel Requests[] = {
+        {TEXT("limit"), TEXT("automation_requests")}};
+    Writer.WriteSample(TEXT("mcp_bridge_rate_limit_rejections_total"),
+                       NumRateLimitedMessages, Messages);
+    Writer.WriteSample(TEXT("mcp_bridge_rate_limit_rejections_total"),
+                       NumRateLimitedAutomationRequests, Requests);
+  }
+
+  Writer.BeginFamily(TEXT("mcp_bridge_received_bytes"), TEXT("counter"),
+                     TEXT("Bytes read from bridge sockets."), TEXT("bytes"));
+  Writer.WriteSample(TEXT("mcp_bridge_received_bytes_total"),
+                     FMcpBridgeWebSocket::GetTotalBytesReceived());
+  Writer.BeginFamily(TEXT("mcp_bridge_sent_bytes"), TEXT("counter"),
+                     TEXT("Bytes written to bridge sockets."), TEXT("bytes"));
+  Writer.WriteSample(TEXT("mcp_bridge_sent_bytes_total"),
+                     FMcpBridgeWebSocket::GetTotalBytesSent());
+
+  OnCollectMetrics.ExecuteIfBound(Writer);
+  return Writer.Finish();
 }
 
 void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
@@ -1024,6 +1901,7 @@ void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
     return;
 
   LastTelemetrySummaryLogSeconds = NowSeconds;
+  FScopeLock Lock(&TelemetryMutex);
   if (AutomationActionTelemetry.Num() == 0)
     return;
 
@@ -1042,11 +1920,13 @@ void FMcpConnectionManager::EmitAutomationTelemetrySummaryIfNeeded(
         Stats.FailureCount > 0
             ? (Stats.TotalFailureDurationSeconds / Stats.FailureCount)
             : 0.0;
-    Lines.Add(FString::Printf(TEXT("%s success=%d failure=%d last=%.3fs "
-                                   "avgSuccess=%.3fs avgFailure=%.3fs"),
-                              *ActionKey, Stats.SuccessCount,
-                              Stats.FailureCount, Stats.LastDurationSeconds,
-                              AvgSuccess, AvgFailure));
+    Lines.Add(FString::Printf(
+        TEXT("%s success=%d failure=%d last=%.3fs avgSuccess=%.3fs "
+             "avgFailure=%.3fs p50=%.3fs p99=%.3fs"),
+        *ActionKey, Stats.SuccessCount, Stats.FailureCount,
+        Stats.LastDurationSeconds, AvgSuccess, AvgFailure,
+        Stats.Total.GetPercentileSeconds(50.0),
+        Stats.Total.GetPercentileSeconds(99.0)));
   }
   Lines.Sort();
   UE_LOG(LogMcpAutomationBridgeSubsystem, Log,
@@ -1066,15 +1946,65 @@ void FMcpConnectionManager::RegisterRequestSocket(
   }
 }
 
-void FMcpConnectionManager::StartRequestTelemetry(const FString &RequestId,
-                                                  const FString &Action) {
-  if (!ActiveRequestTelemetry.Contains(RequestId)) {
-    FAutomationRequestTelemetry Entry;
+bool FMcpConnectionManager::FindRequestPriority(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId,
+    EMcpRequestPriority &OutPriority) const {
+  FScopeLock Lock(&PendingRequestsMutex);
+  if (const EMcpRequestPriority *Found =
+          RequestPriorities.Find({Socket, RequestId})) {
+    OutPriority = *Found;
+    return true;
+  }
+  return false;
+}
+
+bool FMcpConnectionManager::BeginRequestTelemetry(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId,
+    const FString &Action) {
+  FScopeLock Lock(&TelemetryMutex);
+  const FRequestKey Key{Socket, RequestId};
+  if (ActiveRequestTelemetry.Contains(Key)) {
+    return false;
+  }
+  McpTraceRequestReceived(RequestId, Action);
+  FAutomationRequestTelemetry &Entry = ActiveRequestTelemetry.Add(Key);
+  const FString LowerAction = Action.ToLower();
+  Entry.Action = LowerAction.IsEmpty() ? Action : LowerAction;
+  Entry.ReceivedSeconds = FPlatformTime::Seconds();
+  return true;
+}
+
+void FMcpConnectionManager::StartRequestTelemetry(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId,
+    const FString &Action) {
+  FScopeLock Lock(&TelemetryMutex);
+  FAutomationRequestTelemetry &Entry =
+      ActiveRequestTelemetry.FindOrAdd({Socket, RequestId});
+  if (Entry.Action.IsEmpty()) {
     // Store lowercase action for consistent aggregation, similar to original
     // logic
     const FString LowerAction = Action.ToLower();
     Entry.Action = LowerAction.IsEmpty() ? Action : LowerAction;
-    Entry.StartTimeSeconds = FPlatformTime::Seconds();
-    ActiveRequestTelemetry.Add(RequestId, Entry);
+  }
+  Entry.StartTimeSeconds = FPlatformTime::Seconds();
+}
+
+void FMcpConnectionManager::MarkRequestHandlerStart(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId) {
+  FScopeLock Lock(&TelemetryMutex);
+  if (FAutomationRequestTelemetry *Entry =
+          ActiveRequestTelemetry.Find({Socket, RequestId})) {
+    Entry->HandlerStartSeconds = FPlatformTime::Seconds();
+  }
+}
+
+void FMcpConnectionManager::MarkRequestResponseStart(
+    const FMcpBridgeWebSocket *Socket, const FString &RequestId) {
+  FScopeLock Lock(&TelemetryMutex);
+  if (FAutomationRequestTelemetry *Entry =
+          ActiveRequestTelemetry.Find({Socket, RequestId})) {
+    if (Entry->ResponseStartSeconds <= 0.0) {
+      Entry->ResponseStartSeconds = FPlatformTime::Seconds();
+    }
   }
 }
@@ -126,6 +126,98 @@ public:
     UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0.0"))
     float AcceptSleepSeconds;
 
+    /** When true, each listener serves all of its accepted ws:// clients from a single reactor thread
+     * (epoll on Linux, poll/WSAPoll elsewhere) instead of spawning one thread per client.
+     * Requires UE 5.7+; TLS connections and older engines always use a thread per client.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection")
+    bool bUseSocketReactor;
+
+    /** Maximum number of read-only requests (e.g. search_assets) that may run concurrently on worker threads
+     * per action, bypassing the game-thread request queue. Handlers opt in when they are registered.
+     * 0 disables the worker lane so every request runs on the game thread.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0"))
+    int32 ConcurrentReadOnlyRequestLimit;
+
+    /** Largest in-flight request window offered to clients that negotiate pipelining in bridge_hello (maxInFlight).
+     * Requests on different resources may then complete out of order; requests touching the same resource keep
+     * their submission order. 0 disables pipelining so every client keeps the legacy request/response behaviour.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0"))
+    int32 MaxInFlightRequestsPerConnection;
+
+    /** When true, clients may negotiate MessagePack in bridge_hello ("encodings": ["msgpack", ...]) and receive
+     * automation responses as binary frames. JSON text stays the default for clients that do not ask.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection")
+    bool bAllowMessagePackEncoding;
+
+    /** Largest response_chunk payload granted to clients that ask for chunked responses in bridge_hello
+     * (responseChunkBytes). Large result arrays are then sent incrementally as response_chunk frames ahead of the
+     * automation_response instead of inside one frame. 0 disables chunking for every client.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0"))
+    int32 MaxResponseChunkBytes;
+
+    /** Outbound bytes a connection may have queued before it counts as falling behind. Above this mark log streaming
+     * and progress updates to that client are skipped. Streamed responses keep being queued; they are only cut
+     * short when the connection fails, e.g. by exceeding MaxSendQueueBytes.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0"))
+    int32 SendQueueHighWaterBytes;
+
+    /** Hard cap on a connection's queued outbound bytes. A client that falls this far behind is disconnected
+     * instead of letting the editor buffer without bound. 0 disables the cap.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0"))
+    int32 MaxSendQueueBytes;
+
+    /** Game-thread time per frame, in milliseconds, shared by handlers running as time-sliced jobs (generate_lods,
+     * bulk_delete_assets). The editor renders between slices. 0 runs every job to completion inside its request.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0.0"))
+    float JobFrameBudgetMs;
+
+    /** Minimum interval, in seconds, between the progress_update messages sent automatically for a running job. */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "0.0"))
+    float JobProgressIntervalSeconds;
+
+    /** Interval, in milliseconds, at which captured editor log lines are sent to subscribed clients as log_batch events. */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "1"))
+    int32 LogBatchIntervalMs;
+
+    /** Most log lines per log_batch event. A batch is sent early once this many lines are waiting. */
+    UPROPERTY(config, EditAnywhere, Category = "Connection", meta = (ClampMin = "1"))
+    int32 LogBatchMaxRecords;
+
+    /** When true, the WebSocket handshake negotiates permessage-deflate (RFC 7692) with clients that offer it.
+     * Mostly useful for LAN clients (see bAllowNonLoopback); on loopback the CPU cost usually outweighs the savings.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Compression")
+    bool bEnablePerMessageDeflate;
+
+    /** Largest LZ77 window (in bits) used for compression and requested from the peer. Smaller windows use less memory per connection. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (ClampMin = "9", ClampMax = "15", EditCondition = "bEnablePerMessageDeflate"))
+    int32 DeflateMaxWindowBits;
+
+    /** Messages smaller than this many bytes are sent uncompressed even when permessage-deflate is active. */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (ClampMin = "0", EditCondition = "bEnablePerMessageDeflate"))
+    int32 DeflateMinMessageBytes;
+
+    /** When true, both sides reset their compression context after every message (no_context_takeover),
+     * lowering memory use at the cost of compression ratio on repetitive traffic.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (EditCondition = "bEnablePerMessageDeflate"))
+    bool bDeflateNoContextTakeover;
+
+    /** When true, listeners also answer a plain HTTP GET /metrics (no WebSocket upgrade) with OpenMetrics text for
+     * Prometheus: per-action request counters and latency histograms, connections, rate-limit rejections, queue depth,
+     * traffic and GC/save deferrals. With bRequireCapabilityToken the scraper must send the token as a bearer token.
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Debug")
+    bool bEnableMetricsEndpoint;
+
     /** Frequency, in seconds, for the subsystem ticker. If <= 0, engine default will be used. */
     UPROPERTY(config, EditAnywhere, Category = "Debug", meta = (ClampMin = "0.0"))
     float TickerIntervalSeconds;
@@ -1,12 +1,16 @@
 #pragma once
 
+#include "Containers/Queue.h"
 #include "Containers/Ticker.h"
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 #include "EditorSubsystem.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Atomic.h"
 #include "Templates/SharedPointer.h"
 #include "Engine/DataAsset.h"
+#include "McpBridgeRequestPriority.h"
 #include "McpAutomationBridgeSubsystem.generated.h"
 
 // Define MCP_HAS_CONTROLRIG_FACTORY based on UE version
@@ -73,7 +77,11 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMcpAutomationMessageReceived,
                                             const FMcpAutomationMessage &,
                                             Message);
 
+class FMcpAutomationJob;
 class FMcpBridgeWebSocket;
+class FMcpJsonStreamWriter;
+class FMcpLogStream;
+class FMcpOpenMetricsWriter;
 DECLARE_LOG_CATEGORY_EXTERN(LogMcpAutomationBridgeSubsystem, Log, All);
 
 UCLASS()
@@ -111,6 +119,20 @@ public:
                            const FString &RequestId, const FString &Message,
                            const FString &ErrorCode);
 
+  /**
+   * Send a successful response whose result members are written by
+   * WriteResult straight into the UTF-8 send buffer (see
+   * FMcpJsonStreamWriter), avoiding an FJsonObject tree for large results.
+   * WriteResult is called exactly once, before this returns, inside the
+   * already open result object. Large arrays written through
+   * FMcpStreamedArray are sent ahead as response_chunk frames to clients
+   * that negotiated chunked responses.
+   */
+  void SendAutomationResponseStreamed(
+      TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString &RequestId,
+      const FString &Message,
+      TFunctionRef<void(FMcpJsonStreamWriter &)> WriteResult);
+
   /**
    * Send a progress update message during long-running operations.
    * This keeps the request alive by extending its timeout on the server side.
@@ -123,6 +145,13 @@ public:
   void SendProgressUpdate(const FString &RequestId, float Percent = -1.0f, 
                           const FString &Message = TEXT(""), bool bStillWorking = true);
 
+  /**
+   * Send a message that may be dropped, such as a streamed log line. Clients
+   * that are behind on reading (outbound queue above SendQueueHighWaterBytes)
+   * are skipped.
+   */
+  bool SendBestEffortMessage(const FString &Message);
+
   bool ExecuteEditorCommands(const TArray<FString> &Commands,
                              FString &OutErrorMessage);
 #if MCP_HAS_CONTROLRIG_FACTORY
@@ -137,12 +166,80 @@ public:
                                             const TSharedPtr<FJsonObject> &,
                                             TSharedPtr<FMcpBridgeWebSocket>)>;
 
+  /** Execution traits a handler declares when it is registered. */
+  struct FAutomationHandlerTraits {
+    /**
+     * The handler only reads thread-safe state (AssetRegistry queries,
+     * payload parsing) and never touches UObjects, the world or editor
+     * subsystems. Such handlers may run on a worker thread instead of
+     * waiting in the game-thread request queue.
+     */
+    bool bThreadSafeReadOnly = false;
+    /**
+     * Maximum concurrent worker executions of this action. Requests beyond
+     * the limit fall back to the game-thread queue. <= 0 uses the
+     * ConcurrentReadOnlyRequestLimit setting.
+     */
+    int32 MaxConcurrency = 0;
+    /**
+     * Boolean payload field a request must set to true to be taken by the
+     * worker lane; requests without it stay on the game thread. Lets a
+     * handler whose worker-thread answer differs (e.g. on-disk assets only,
+     * because a worker cannot enumerate in-memory ones) serve that answer
+     * only to clients that asked for it. Empty to take every request.
+     */
+    FString ConcurrentPayloadFlag;
+    /**
+     * Scheduling class while the request waits in the game-thread queue,
+     * unless the client names one in the request envelope.
+     */
+    EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
+    /**
+     * Every effect of the handler is recorded in the editor transaction
+     * buffer: it only Modify()s existing objects and never creates, saves or
+     * deletes assets or files. Undoing an enclosing transaction (a rolled
+     * back automation_batch) therefore reverts it completely.
+     */
+    bool bTransactional = false;
+  };
+
   /**
    * Registers a handler for a specific automation action.
    * This allows for O(1) dispatch of automation requests and runtime
    * extensibility.
    */
-  void RegisterHandler(const FString &Action, FAutomationHandler Handler);
+  void RegisterHandler(const FString &Action, FAutomationHandler Handler,
+                       const FAutomationHandlerTraits &Traits =
+                           FAutomationHandlerTraits());
+
+  /** Registered action names, for diagnostics and the dispatch benchmark. */
+  TArray<FString> GetRegisteredAutomationActions() const;
+
+  /**
+   * Resolves the handler route for Action without running it, as the
+   * dispatcher does for every request. Returns the number of candidate
+   * handlers; 0 means the action would be rejected as unknown.
+   */
+  int32 CountAutomationRouteCandidates(const FString &Action) const;
+
+  /**
+   * Continues a request as a time-sliced job instead of finishing it inside
+   * the handler, so the editor keeps rendering while it runs. The job's
+   * first slice runs before this returns; after that it is advanced once per
+   * frame within JobFrameBudgetMs, with a progress_update sent for RequestId
+   * at most every JobProgressIntervalSeconds, until it sends the final
+   * response. The handler returns true straight after calling this. Batch
+   * items and a zero budget run the job to completion immediately.
+   */
+  void StartAutomationJob(const FString &RequestId,
+                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+                          TSharedRef<FMcpAutomationJob> Job);
+
+  /**
+   * Game-thread queue depth and queue wait time (count, average, maximum)
+   * per priority class since startup.
+   */
+  TSharedPtr<FJsonObject> GetPendingQueueMetrics() const;
 
 private:
   // Telemetry structs moved to McpConnectionManager
@@ -159,31 +256,159 @@ private:
   bool bCurrentBlueprintBusyMarked = false;
   bool bCurrentBlueprintBusyScheduled = false;
 
-  // Pending automation request queue (thread-safe). Inbound socket threads
-  // will enqueue requests here; the queue is drained sequentially on the
-  // game thread to ensure deterministic processing order and avoid
-  // reentrancy issues.
+  // Pending automation request queue. Requests arriving off the game thread,
+  // deferred by GC/save/async loading, or received while another request is
+  // dispatching are enqueued here from any thread without locking; the game
+  // thread drains it on the engine tick after the first enqueue.
   struct FPendingAutomationRequest {
     FString RequestId;
     FString Action;
     TSharedPtr<FJsonObject> Payload;
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket;
+    double EnqueueSeconds = 0.0;
+    // Resolved on the game thread when the request is scheduled.
+    EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
   };
-  TArray<FPendingAutomationRequest> PendingAutomationRequests;
-  FCriticalSection PendingAutomationRequestsMutex;
-  bool bPendingRequestsScheduled = false;
+  TQueue<FPendingAutomationRequest, EQueueMode::Mpsc> PendingAutomationRequests;
+  // Requests in PendingAutomationRequests plus those already scheduled.
+  TAtomic<int32> NumPendingAutomationRequests{0};
+  // Set while a one-shot drain is registered with the core ticker.
+  TAtomic<bool> bPendingDrainScheduled{false};
+  // Requests put back in the queue because the engine was saving, collecting
+  // garbage or async loading when they came up; reported on /metrics.
+  TAtomic<int64> NumDeferredForSaving{0};
+  TAtomic<int64> NumDeferredForGarbageCollection{0};
+  TAtomic<int64> NumDeferredForAsyncLoading{0};
+  void EnqueuePendingAutomationRequest(FPendingAutomationRequest &&Request);
+  void SchedulePendingAutomationDrain();
   void ProcessPendingAutomationRequests();
 
-  void RecordAutomationTelemetry(const FString &RequestId, bool bSuccess,
-                                 const FString &Message,
-                                 const FString &ErrorCode);
+  // Game-thread scheduler the drain moves requests into. Each priority class
+  // keeps one FIFO per requesting socket and serves those round-robin, so a
+  // client flooding the bridge cannot push another client's requests back;
+  // classes are served by weight so low priority work still progresses.
+  struct FPendingSocketQueue {
+    const FMcpBridgeWebSocket *Socket = nullptr;
+    TArray<FPendingAutomationRequest> Requests;
+  };
+  struct FPendingPriorityClass {
+    TArray<FPendingSocketQueue> SocketQueues;
+    int32 NextSocketQueue = 0;
+    int32 NumQueued = 0;
+    int32 Credits = 0;
+    // Queue wait of every request dispatched from this class.
+    int64 NumDispatched = 0;
+    double TotalWaitSeconds = 0.0;
+    double MaxWaitSeconds = 0.0;
+  };
+  FPendingPriorityClass
+      PendingPriorityClasses[static_cast<int32>(EMcpRequestPriority::Count)];
+  int32 NumScheduledAutomationRequests = 0;
+  void SchedulePendingAutomationRequest(FPendingAutomationRequest &&Request);
+  bool PopScheduledAutomationRequest(FPendingAutomationRequest &OutRequest);
+  EMcpRequestPriority
+  ResolveRequestPriority(const FMcpBridgeWebSocket *RequestingSocket,
+                         const FString &RequestId,
+                         const FString &Action) const;
+  /** Whether Action's handler is registered with bTransactional. */
+  bool IsTransactionalAction(const FString &Action) const;
+
+  // Jobs started by StartAutomationJob, advanced round-robin by a per-frame
+  // core ticker that is registered only while any are running.
+  struct FRunningAutomationJob {
+    FString RequestId;
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket;
+    TSharedPtr<FMcpAutomationJob> Job;
+    float ProgressPercent = -1.0f;
+    FString ProgressMessage;
+    double LastProgressSeconds = 0.0;
+  };
+  TArray<FRunningAutomationJob> RunningAutomationJobs;
+  int32 NextAutomationJob = 0;
+  FTSTicker::FDelegateHandle AutomationJobTickHandle;
+  bool TickAutomationJobs(float DeltaTime);
+  bool StepAutomationJob(FRunningAutomationJob &Running, double DeadlineSeconds);
+  void AbortAutomationJobs();
+
+  void RecordAutomationTelemetry(
+      const TSharedPtr<FMcpBridgeWebSocket> &RequestingSocket,
+      const FString &RequestId, bool bSuccess, const FString &Message,
+      const FString &ErrorCode);
+
+  // Active log capture; set while any socket is subscribed to log_batch events.
+  TSharedPtr<FMcpLogStream> LogCaptureDevice;
+  // Unsubscribes Socket from log_batch events, stopping capture when it was
+  // the last subscriber.
+  void RemoveLogSubscriber(const TSharedPtr<FMcpBridgeWebSocket> &Socket);
+
+  // Action handlers (implemented in separate translation units). Every action
+  // name a handler understands is registered up front, keyed by FName so a
+  // request resolves with hashed, case-insensitive lookups instead of probing
+  // each handler in turn. See ResolveAutomationRoute().
+  struct FAutomationRouteCandidate {
+    FString Label;
+    FAutomationHandler Handler;
+  };
+  struct FAutomationActionRoute {
+    // Tried in order until one consumes the request. More than one entry
+    // means the action is shared (e.g. system_control sub-tools).
+    TArray<FAutomationRouteCandidate, TInlineAllocator<1>> Candidates;
+    bool bHasRegisteredHandler = false;
+    EMcpRequestPriority Priority = EMcpRequestPriority::Normal;
+    bool bTransactional = false;
+  };
+  struct FAutomationPrefixRoute {
+    FString Prefix;
+    FAutomationRouteCandidate Candidate;
+  };
+  using FAutomationMemberHandler = bool (UMcpAutomationBridgeSubsystem::*)(
+      const FString &, const FString &, const TSharedPtr<FJsonObject> &,
+      TSharedPtr<FMcpBridgeWebSocket>);
+  using FAutomationRouteCandidates =
+      TArray<const FAutomationRouteCandidate *, TInlineAllocator<8>>;
 
-  // Active Log Device
-  TSharedPtr<FOutputDevice> LogCaptureDevice;
+  TMap<FName, FAutomationActionRoute> AutomationHandlers;
+  // Open-ended action families (e.g. "audio_*"), bucketed by the action's
+  // leading segment so only same-segment prefixes are compared.
+  TMap<FName, TArray<FAutomationPrefixRoute>> AutomationPrefixRoutes;
+  // Tolerant matcher for blueprint/SCS action spellings.
+  FAutomationRouteCandidate BlueprintActionRoute;
+  // Handlers that dispatch on the payload's subAction; consulted only when a
+  // known action's own handlers decline the request.
+  TArray<FAutomationRouteCandidate> PayloadRoutedHandlers;
+  int32 DuplicateActionRegistrations = 0;
 
-  // Action handlers (implemented in separate translation units)
-  TMap<FString, FAutomationHandler> AutomationHandlers;
   void InitializeHandlers();
+  void InitializeActionAliases();
+  void RegisterActionAliases(const TCHAR *Label,
+                             FAutomationMemberHandler Handler,
+                             std::initializer_list<const TCHAR *> Actions);
+  void RegisterActionPrefixes(const TCHAR *Label,
+                              FAutomationMemberHandler Handler,
+                              std::initializer_list<const TCHAR *> Prefixes);
+  void ReportSharedActionClaims() const;
+  bool ResolveAutomationRoute(const FString &Action,
+                              FAutomationRouteCandidates &OutCandidates) const;
+
+  // Worker lane for handlers registered with bThreadSafeReadOnly. Lanes are
+  // looked up from socket I/O threads, so the map is guarded and each lane
+  // carries its own copy of the handler and an in-flight counter.
+  struct FConcurrentHandlerLane {
+    FAutomationHandler Handler;
+    int32 MaxConcurrency = 1;
+    FString ConcurrentPayloadFlag;
+    FThreadSafeCounter InFlight;
+  };
+  TMap<FString, TSharedPtr<FConcurrentHandlerLane, ESPMode::ThreadSafe>>
+      ConcurrentHandlerLanes;
+  FRWLock ConcurrentHandlerLanesLock;
+  FThreadSafeCounter ConcurrentRequestsInFlight;
+  TAtomic<bool> bAcceptingConcurrentRequests{false};
+  bool TryDispatchConcurrentRequest(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  void CollectBridgeMetrics(FMcpOpenMetricsWriter &Writer);
 
   /**
    * Handle lightweight, well-known editor function invocations sent from the
@@ -1238,4 +1463,35 @@ private:
   ProcessAutomationRequest(const FString &RequestId, const FString &Action,
                            const TSharedPtr<FJsonObject> &Payload,
                            TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+
+  /**
+   * Runs Action through its registered route on the game thread, replying
+   * UNKNOWN_ACTION when no handler consumes it. Returns the label of the
+   * handler that consumed the request.
+   */
+  FString
+  DispatchAutomationAction(const FString &RequestId, const FString &Action,
+                           const TSharedPtr<FJsonObject> &Payload,
+                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+
+  // automation_batch: items run back to back inside one dispatch, and the
+  // response each item's handler sends is captured here instead of being
+  // written to the socket as its own frame.
+  struct FAutomationBatchItemResponse {
+    bool bResponded = false;
+    bool bSuccess = false;
+    FString Message;
+    TSharedPtr<FJsonObject> Result;
+    FString ErrorCode;
+  };
+  FString CapturingBatchItemId;
+  FAutomationBatchItemResponse CapturedBatchItemResponse;
+
+  bool HandleAutomationBatch(const FString &RequestId, const FString &Action,
+                             const TSharedPtr<FJsonObject> &Payload,
+                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+
+  bool HandleGetBridgeMetrics(const FString &RequestId, const FString &Action,
+                              const TSharedPtr<FJsonObject> &Payload,
+                              TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
 };
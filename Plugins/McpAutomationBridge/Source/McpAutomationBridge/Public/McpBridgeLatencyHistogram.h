@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Fixed-memory latency histogram with HDR-style log-linear buckets: each
+ * power of two of microseconds is split into 16 linear sub-buckets, so any
+ * percentile it reports is within about 6% of the true value, from 1 us up to
+ * about 19 hours. Bucket storage is allocated on the first sample.
+ *
+ * Not thread-safe; FMcpConnectionManager records under its telemetry lock.
+ */
+class FMcpLatencyHistogram
+{
+public:
+	void Record(double Seconds);
+
+	int64 GetCount() const { return Count; }
+	double GetMeanSeconds() const { return Count > 0 ? SumSeconds / Count : 0.0; }
+	double GetMaxSeconds() const { return MaxSeconds; }
+	double GetSumSeconds() const { return SumSeconds; }
+
+	/**
+	 * Samples at or below Seconds, to bucket precision: only buckets that end
+	 * at or below Seconds count, so no larger sample is ever included but
+	 * samples in the bucket straddling Seconds are left out. Used for
+	 * cumulative histogram exposition, whose le buckets must not overcount.
+	 */
+	int64 GetCountAtOrBelow(double Seconds) const;
+
+	/** Value at Percentile (0-100) of the recorded samples; 0 when empty. */
+	double GetPercentileSeconds(double Percentile) const;
+
+	/** {"count","meanMs","p50Ms","p90Ms","p99Ms","p999Ms","maxMs"} */
+	TSharedRef<FJsonObject> ToJson() const;
+
+private:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxExponent = 36;
+	static constexpr int32 NumBuckets = SubBucketCount + (MaxExponent - SubBucketBits + 1) * SubBucketCount;
+
+	static int32 BucketForMicros(uint64 Micros);
+	/** Midpoint of the bucket's range, in microseconds. */
+	static double BucketMidpointMicros(int32 Bucket);
+	/** Exclusive upper edge of the bucket's range, in microseconds. */
+	static uint64 BucketEndMicros(int32 Bucket);
+
+	TArray<uint32> Buckets;
+	int64 Count = 0;
+	double SumSeconds = 0.0;
+	double MaxSeconds = 0.0;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Scheduling class of an automation request that has to wait in the
+ * game-thread queue. A handler declares its default when it is registered;
+ * a client may override it per request with the envelope's "priority"
+ * field ("high", "normal" or "low").
+ */
+enum class EMcpRequestPriority : uint8
+{
+	/** Cheap status queries a client is blocked on (PIE state, pings). */
+	High,
+	Normal,
+	/** Bulk edits and long-running jobs. */
+	Low,
+	Count
+};
+
+inline const TCHAR* LexToString(EMcpRequestPriority Priority)
+{
+	switch (Priority)
+	{
+	case EMcpRequestPriority::High:
+		return TEXT("high");
+	case EMcpRequestPriority::Low:
+		return TEXT("low");
+	default:
+		return TEXT("normal");
+	}
+}
+
+/** Parses a client-supplied priority name (case-insensitive). */
+inline bool McpParseRequestPriority(const FString& Text, EMcpRequestPriority& OutPriority)
+{
+	for (int32 Index = 0; Index < static_cast<int32>(EMcpRequestPriority::Count); ++Index)
+	{
+		const EMcpRequestPriority Candidate = static_cast<EMcpRequestPriority>(Index);
+		if (Text.Equals(LexToString(Candidate), ESearchCase::IgnoreCase))
+		{
+			OutPriority = Candidate;
+			return true;
+		}
+	}
+	return false;
+}
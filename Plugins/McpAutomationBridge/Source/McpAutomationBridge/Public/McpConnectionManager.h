@@ -5,8 +5,12 @@
 #include "Dom/JsonObject.h"
 #include "Templates/SharedPointer.h"
 #include "Misc/ScopeLock.h"
+#include "McpBridgeLatencyHistogram.h"
+#include "McpBridgeRequestPriority.h"
 
 class FMcpBridgeWebSocket;
+class FMcpJsonStreamWriter;
+class FMcpOpenMetricsWriter;
 class UMcpAutomationBridgeSettings;
 
 /**
@@ -15,6 +19,25 @@ class UMcpAutomationBridgeSettings;
  */
 DECLARE_DELEGATE_FourParams(FMcpMessageReceivedCallback, const FString&, const FString&, const TSharedPtr<FJsonObject>&, TSharedPtr<FMcpBridgeWebSocket>);
 
+/**
+ * Offers an authenticated automation request to a worker lane from the socket I/O thread.
+ * Returns true if the request was scheduled; false sends it down the game-thread path instead.
+ * Params: RequestId, Action, Payload, RequestingSocket
+ */
+DECLARE_DELEGATE_RetVal_FourParams(bool, FMcpConcurrentRequestCallback, const FString&, const FString&, const TSharedPtr<FJsonObject>&, TSharedPtr<FMcpBridgeWebSocket>);
+
+/**
+ * Appends metric families kept outside the connection manager (queue depth, deferrals) to a
+ * GET /metrics response. Runs on a socket I/O thread.
+ */
+DECLARE_DELEGATE_OneParam(FMcpCollectMetricsCallback, FMcpOpenMetricsWriter&);
+
+/**
+ * Tells the owner a client connection has closed, so it can drop whatever it keeps per socket
+ * (log subscriptions). Runs on the game thread.
+ */
+DECLARE_DELEGATE_OneParam(FMcpSocketClosedCallback, TSharedPtr<FMcpBridgeWebSocket>);
+
 /**
  * Manages WebSocket connections for the MCP Automation Bridge.
  * Handles listening, connecting, reconnecting, heartbeats, and message dispatching.
@@ -34,12 +57,27 @@ public:
 	bool IsReconnectPending() const { return TimeUntilReconnect > 0.0f; }
 
     bool SendRawMessage(const FString& Message);
+    /**
+     * Like SendRawMessage, but for traffic that may be dropped (streamed log lines): sockets whose
+     * outbound queue is above its high-water mark are skipped. Returns false if nothing was sent.
+     */
+    bool SendBestEffortMessage(const FString& Message);
     void SendAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode);
+
+    /**
+     * Like SendAutomationResponse, but the result object's members are written by WriteResult
+     * directly into the UTF-8 send buffer instead of being built as an FJsonObject first.
+     * WriteResult runs once, synchronously, inside an already open "result" object. When TargetSocket
+     * negotiated responseChunkBytes, the writer carries a chunk sink so FMcpStreamedArray can send
+     * response_chunk frames before the response itself.
+     */
+    void SendAutomationResponseStreamed(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode, TFunctionRef<void(FMcpJsonStreamWriter&)> WriteResult);
     void SendControlMessage(const TSharedPtr<FJsonObject>& Message);
 
     /**
      * Send a progress update message to extend request timeout during long operations.
      * Used for heartbeat/keepalive to prevent timeouts while UE is actively working.
+     * Skipped while the requesting socket's outbound queue is above its high-water mark.
      * 
      * @param RequestId The request ID being tracked
      * @param Percent Optional progress percent (0-100)
@@ -50,13 +88,49 @@ public:
 
 	void SetOnMessageReceived(FMcpMessageReceivedCallback InCallback);
 
+	/** Must be bound before Start(); it is read from socket I/O threads afterwards. */
+	void SetOnConcurrentRequest(FMcpConcurrentRequestCallback InCallback);
+
+	/** Must be bound before Start(); called from socket I/O threads for each metrics scrape. */
+	void SetOnCollectMetrics(FMcpCollectMetricsCallback InCallback);
+
+	void SetOnSocketClosed(FMcpSocketClosedCallback InCallback);
+
+	/**
+	 * Socket I/O thread entry point for inbound text. Returns true when an
+	 * authenticated automation_request was taken over (worker lane or direct
+	 * game-thread dispatch); false leaves the message to HandleMessage.
+	 */
+	bool TryHandleMessageOnIoThread(TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& Message);
+
 	// Request tracking helpers
 	int32 GetActiveSocketCount() const;
 	void RegisterRequestSocket(const FString& RequestId, TSharedPtr<FMcpBridgeWebSocket> Socket);
+	/** Priority the client gave in the request envelope; false when it gave none. */
+	bool FindRequestPriority(const FMcpBridgeWebSocket* Socket, const FString& RequestId, EMcpRequestPriority& OutPriority) const;
+
+	// Telemetry helpers. A request's latency is split into phases stamped as it
+	// moves through the bridge: received on the socket, dispatch started (left
+	// the queue), handler started, response handed to the connection manager,
+	// response sent. Requests are identified by socket and id, since clients
+	// pick their own ids.
+	void StartRequestTelemetry(const FMcpBridgeWebSocket* Socket, const FString& RequestId, const FString& Action);
+	void MarkRequestHandlerStart(const FMcpBridgeWebSocket* Socket, const FString& RequestId);
+	void RecordAutomationTelemetry(const FMcpBridgeWebSocket* Socket, const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode);
+
+	/**
+	 * Per-action request counts and latency percentiles for the whole request
+	 * and each phase (queueWait, dispatch, handler, send), as returned by
+	 * get_bridge_metrics. A non-empty ActionFilter limits the actions reported.
+	 */
+	TSharedRef<FJsonObject> GetAutomationMetrics(const TSet<FString>& ActionFilter) const;
 
-	// Telemetry helpers
-	void StartRequestTelemetry(const FString& RequestId, const FString& Action);
-	void RecordAutomationTelemetry(const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode);
+	/**
+	 * OpenMetrics exposition served on the listeners' GET /metrics when bEnableMetricsEndpoint is set:
+	 * the telemetry above as counters and histograms plus connection, rate-limit and traffic figures.
+	 * Safe to call from any thread.
+	 */
+	FString BuildOpenMetricsText() const;
 
 	bool Tick(float DeltaTime);
 
@@ -71,16 +145,75 @@ private:
 	void HandleClosed(TSharedPtr<FMcpBridgeWebSocket> Socket, int32 StatusCode, const FString& Reason, bool bWasClean);
 	void HandleMessage(TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& Message);
 	void HandleHeartbeat(TSharedPtr<FMcpBridgeWebSocket> Socket);
+	bool IsSocketAuthenticated(FMcpBridgeWebSocket* SocketPtr) const;
+	void SendBridgeErrorAndClose(TSharedPtr<FMcpBridgeWebSocket> Socket, const FString& ErrorCode, const FString& Message, int32 CloseCode, const FString& CloseReason);
+	void LogAutomationRequest(const FString& Action, const TSharedPtr<FJsonObject>& Payload) const;
+	/** bTrackedRequest is false for requests refused on arrival, which own no telemetry or in-flight entry. */
+	void DeliverAutomationResponse(TSharedPtr<FMcpBridgeWebSocket> TargetSocket, const FString& RequestId, bool bSuccess, const FString& Message, const FString& ErrorCode, TSharedPtr<FJsonObject> Result, FMcpJsonStreamWriter* StreamedText, bool bTrackedRequest = true);
+	bool SendToOtherActiveSocket(const FString& Serialized, const TSharedPtr<FMcpBridgeWebSocket>& SkipA, const TSharedPtr<FMcpBridgeWebSocket>& SkipB);
+	void SendResponseFallbackEvent(const FString& RequestId, bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode);
 
+	/** Outcome of admitting an automation request into its socket's in-flight window. */
+	enum class EInFlightAdmission : uint8
+	{
+		/** Legacy socket, or pipelined and free to run on a worker lane. */
+		Dispatch,
+		/** Pipelined and must run in submission order on the game thread. */
+		Ordered,
+		/** Waiting for an earlier worker-lane request on the same resource. */
+		Parked,
+		/** The negotiated window is full; the request was rejected. */
+		Rejected
+	};
+
+	/** Answers a request whose id the socket already has in progress, leaving that request's state alone. */
+	void RejectDuplicateRequest(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const FString& RequestId, const FString& Action);
+	EInFlightAdmission AdmitInFlightRequest(const TSharedPtr<FMcpBridgeWebSocket>& Socket, const FString& RequestId, const FString& Action, const TSharedPtr<FJsonObject>& Root, const TSharedPtr<FJsonObject>& Payload, bool bWantsWorkerLane);
+	void MarkInFlightRequestOrdered(const FMcpBridgeWebSocket* Socket, const FString& RequestId);
+	void ReleaseInFlightRequest(const FMcpBridgeWebSocket* Socket, const FString& RequestId);
+	void ReleaseSocketInFlightRequests(FMcpBridgeWebSocket* SocketPtr);
+	void ForwardToGameThread(const FString& RequestId, const FString& Action, const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket);
+
+	/** Starts tracking a received request. False, tracking nothing, when the socket already has a request with this id in progress. */
+	bool BeginRequestTelemetry(const FMcpBridgeWebSocket* Socket, const FString& RequestId, const FString& Action);
+	void MarkRequestResponseStart(const FMcpBridgeWebSocket* Socket, const FString& RequestId);
 	void EmitAutomationTelemetrySummaryIfNeeded(double NowSeconds);
 	bool UpdateRateLimit(FMcpBridgeWebSocket* SocketPtr, bool bIncrementMessage, bool bIncrementAutomation, FString& OutReason);
+	int32 HandleMetricsRequest(const TMap<FString, FString>& Headers, FString& OutBody) const;
 
 private:
+	/**
+	 * A request as the bridge tracks it. Ids are chosen by clients, so two
+	 * connections may use the same one; they are only unique per socket.
+	 */
+	struct FRequestKey
+	{
+		const FMcpBridgeWebSocket* Socket = nullptr;
+		FString RequestId;
+
+		bool operator==(const FRequestKey& Other) const
+		{
+			return Socket == Other.Socket && RequestId.Equals(Other.RequestId, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FRequestKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Socket), GetTypeHash(Key.RequestId));
+		}
+	};
+
 	TArray<TSharedPtr<FMcpBridgeWebSocket>> ActiveSockets;
+	// Last socket each id arrived on, for progress updates and as a delivery
+	// fallback when a response names no socket.
 	TMap<FString, TSharedPtr<FMcpBridgeWebSocket>> PendingRequestsToSockets;
+	// Envelope "priority" overrides, guarded by PendingRequestsMutex like the map above.
+	TMap<FRequestKey, EMcpRequestPriority> RequestPriorities;
 	TSet<FMcpBridgeWebSocket*> AuthenticatedSockets;
 	FTSTicker::FDelegateHandle TickerHandle;
 	FMcpMessageReceivedCallback OnMessageReceived;
+	FMcpConcurrentRequestCallback OnConcurrentRequest;
+	FMcpCollectMetricsCallback OnCollectMetrics;
+	FMcpSocketClosedCallback OnSocketClosed;
 
 	// Configuration
 	FString EnvListenHost;
@@ -101,6 +234,8 @@ private:
 	bool bEnableTls = false;
 	bool bEnvListenPortsSet = false;
 	bool bHeartbeatTrackingEnabled = false;
+	bool bAllowMessagePackEncoding = false;
+	int32 MaxResponseChunkBytes = 0;
 
 	// State
 	bool bBridgeAvailable = false;
@@ -114,7 +249,10 @@ private:
 	struct FAutomationRequestTelemetry
 	{
 		FString Action;
+		double ReceivedSeconds = 0.0;
 		double StartTimeSeconds = 0.0;
+		double HandlerStartSeconds = 0.0;
+		double ResponseStartSeconds = 0.0;
 	};
 
 	struct FAutomationActionStats
@@ -125,6 +263,12 @@ private:
 		double TotalFailureDurationSeconds = 0.0;
 		double LastDurationSeconds = 0.0;
 		double LastUpdatedSeconds = 0.0;
+		// Receipt to response sent, then the phases it is made of.
+		FMcpLatencyHistogram Total;
+		FMcpLatencyHistogram QueueWait;
+		FMcpLatencyHistogram Dispatch;
+		FMcpLatencyHistogram Handler;
+		FMcpLatencyHistogram Send;
 	};
 
 	struct FSocketRateState
@@ -134,12 +278,54 @@ private:
 		int32 AutomationRequestCount = 0;
 	};
 
-	TMap<FString, FAutomationRequestTelemetry> ActiveRequestTelemetry;
+	// Pipelining. Sockets without an entry in PipelineWindows use the legacy
+	// one-at-a-time protocol and are not tracked here.
+	struct FParkedAutomationRequest
+	{
+		FString RequestId;
+		FString Action;
+		TSharedPtr<FJsonObject> Payload;
+		TSharedPtr<FMcpBridgeWebSocket> Socket;
+	};
+
+	struct FInFlightAutomationRequest
+	{
+		FMcpBridgeWebSocket* Socket = nullptr;
+		/** Resource the request touches; empty means it is independent of every other request. */
+		FString OrderingKey;
+		/**
+		 * Set while later same-resource requests must park behind this one: it runs on a worker lane and may
+		 * overtake game-thread work, or it was just released from parking and has yet to reach the game thread.
+		 */
+		bool bBlocksResource = false;
+		/** Same-resource requests parked behind this one, in arrival order. */
+		TArray<FParkedAutomationRequest> Waiters;
+	};
+
+	struct FSocketPipelineWindow
+	{
+		int32 MaxInFlight = 0;
+		int32 InFlight = 0;
+	};
+
+	TMap<FMcpBridgeWebSocket*, FSocketPipelineWindow> PipelineWindows;
+	TMap<FRequestKey, FInFlightAutomationRequest> InFlightRequests;
+	int32 MaxInFlightRequestsPerConnection = 0;
+
+	TMap<FRequestKey, FAutomationRequestTelemetry> ActiveRequestTelemetry;
 	TMap<FString, FAutomationActionStats> AutomationActionTelemetry;
 	TMap<FMcpBridgeWebSocket*, FSocketRateState> SocketRateLimits;
+	// Messages and automation requests refused by UpdateRateLimit, guarded by RateLimitMutex.
+	int64 NumRateLimitedMessages = 0;
+	int64 NumRateLimitedAutomationRequests = 0;
 	double TelemetrySummaryIntervalSeconds = 120.0;
 	double LastTelemetrySummaryLogSeconds = 0.0;
 
 	mutable FCriticalSection PendingRequestsMutex;
 	mutable FCriticalSection RateLimitMutex;
+	// Worker-lane requests authenticate and report telemetry off the game thread.
+	mutable FCriticalSection AuthenticatedSocketsMutex;
+	mutable FCriticalSection TelemetryMutex;
+	// Admission runs on socket I/O threads; release runs wherever a response is sent.
+	mutable FCriticalSection PipelineMutex;
 };